@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <core/common/crypto/cryptohelper.hpp>
+#include <core/common/crypto/cryptoprovider.hpp>
+#include <core/common/tests/mocks/certprovidermock.hpp>
+#include <core/common/tools/fs.hpp>
+#include <core/iam/tests/mocks/certloadermock.hpp>
+
+#include "runner.hpp"
+
+namespace aos::benchmark {
+
+using namespace crypto;
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+constexpr auto cFileSize   = 4 * 1024 * 1024;
+constexpr auto cBlockAlg   = "AES256/CBC/PKCS7PADDING";
+constexpr auto cKeySize    = 32;
+constexpr auto cEmptyCerts = "empty.pem";
+
+// Crypto provider which skips CA certificates parsing, so crypto helper can be initialized without certificates.
+class CryptoProviderStub : public DefaultCryptoProvider {
+public:
+    Error PEMToX509Certs(const String& pemBlob, Array<x509::Certificate>& resultCerts) override
+    {
+        (void)pemBlob;
+
+        resultCerts.Clear();
+
+        return ErrorEnum::eNone;
+    }
+};
+
+struct CryptoHelperFixture {
+    CryptoProviderStub                             mCryptoProvider;
+    testing::NiceMock<iamclient::CertProviderMock> mCertProvider;
+    CertLoaderMock                                 mCertLoader;
+    CryptoHelper                                   mCryptoHelper;
+    DecryptInfo                                    mDecryptInfo;
+    std::string                                    mWorkDir;
+    StaticString<cFilePathLen>                     mEncryptedFile;
+    StaticString<cFilePathLen>                     mDecryptedFile;
+
+    Error Init();
+    Error CreateEncryptedFile();
+};
+
+Error CryptoHelperFixture::Init()
+{
+    mWorkDir = (std::filesystem::temp_directory_path() / "aos_benchmark_cryptohelper").string();
+
+    if (auto err = fs::ClearDir(mWorkDir.c_str()); !err.IsNone()) {
+        return err;
+    }
+
+    if (auto err = mCryptoProvider.Init(); !err.IsNone()) {
+        return err;
+    }
+
+    auto emptyCerts = fs::JoinPath(mWorkDir.c_str(), cEmptyCerts);
+
+    if (auto err = fs::WriteStringToFile(emptyCerts, "", 0600); !err.IsNone()) {
+        return err;
+    }
+
+    if (auto err = mCryptoHelper.Init(mCertProvider, mCryptoProvider, mCertLoader, "", emptyCerts); !err.IsNone()) {
+        return err;
+    }
+
+    mDecryptInfo.mBlockAlg = cBlockAlg;
+
+    mDecryptInfo.mBlockKey.Resize(cKeySize);
+    mDecryptInfo.mBlockIV.Resize(AESCipherItf::cBlockSize);
+
+    for (size_t i = 0; i < mDecryptInfo.mBlockKey.Size(); i++) {
+        mDecryptInfo.mBlockKey[i] = static_cast<uint8_t>(i);
+    }
+
+    for (size_t i = 0; i < mDecryptInfo.mBlockIV.Size(); i++) {
+        mDecryptInfo.mBlockIV[i] = static_cast<uint8_t>(0xff - i);
+    }
+
+    mEncryptedFile = fs::JoinPath(mWorkDir.c_str(), "file.enc");
+    mDecryptedFile = fs::JoinPath(mWorkDir.c_str(), "file.dec");
+
+    return CreateEncryptedFile();
+}
+
+Error CryptoHelperFixture::CreateEncryptedFile()
+{
+    auto [encoder, err] = mCryptoProvider.CreateAESEncoder("CBC", mDecryptInfo.mBlockKey, mDecryptInfo.mBlockIV);
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    auto inBlock  = std::make_unique<StaticArray<uint8_t, cFileChunkSize>>();
+    auto outBlock = std::make_unique<StaticArray<uint8_t, cFileChunkSize + AESCipherItf::cBlockSize>>();
+
+    fs::File file;
+
+    if (err = file.Open(mEncryptedFile, fs::File::Mode::Write); !err.IsNone()) {
+        return err;
+    }
+
+    for (size_t offset = 0; offset < cFileSize; offset += inBlock->Size()) {
+        inBlock->Resize(Min(inBlock->MaxSize(), cFileSize - offset));
+
+        for (size_t i = 0; i < inBlock->Size(); i++) {
+            (*inBlock)[i] = static_cast<uint8_t>(offset + i);
+        }
+
+        if (err = encoder->EncryptBlock(*inBlock, *outBlock); !err.IsNone()) {
+            return err;
+        }
+
+        if (err = file.WriteBlock(*outBlock); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    if (err = encoder->Finalize(*outBlock); !err.IsNone()) {
+        return err;
+    }
+
+    if (err = file.WriteBlock(*outBlock); !err.IsNone()) {
+        return err;
+    }
+
+    return file.Close();
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void RunCryptoHelperBenchmarks(Runner& runner)
+{
+    constexpr auto cName = "common/crypto/cryptohelper/decrypt_4mb";
+
+    if (!runner.IsEnabled(cName)) {
+        return;
+    }
+
+    auto fixture = std::make_unique<CryptoHelperFixture>();
+
+    if (auto err = fixture->Init(); !err.IsNone()) {
+        runner.Fail(cName, err);
+
+        return;
+    }
+
+    runner.Run(cName, 10, [&fixture](size_t iterations) -> Error {
+        for (size_t i = 0; i < iterations; i++) {
+            if (auto err = fixture->mCryptoHelper.Decrypt(
+                    fixture->mEncryptedFile, fixture->mDecryptedFile, fixture->mDecryptInfo);
+                !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    fixture->mCryptoHelper.Deinit();
+
+    fs::RemoveAll(fixture->mWorkDir.c_str());
+}
+
+} // namespace aos::benchmark
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unistd.h>
+
+#include <core/common/tools/fs.hpp>
+
+#include "runner.hpp"
+
+namespace aos::benchmark {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+constexpr auto cWriteSize = 1024 * 1024;
+
+volatile uint64_t sSink;
+
+// Consumes block data, so read and mapped paths touch every byte.
+template <typename T>
+void ConsumeBlock(const Array<T>& block)
+{
+    uint64_t sum = 0;
+
+    for (const auto& item : block) {
+        sum += item;
+    }
+
+    sSink = sum;
+}
+
+Error CreateFile(const String& path, uint64_t fileSize)
+{
+    auto block = std::make_unique<StaticArray<uint8_t, cWriteSize>>();
+
+    block->Resize(cWriteSize);
+
+    for (size_t i = 0; i < block->Size(); i++) {
+        (*block)[i] = static_cast<uint8_t>(i);
+    }
+
+    fs::File file;
+
+    if (auto err = file.Open(path, fs::File::Mode::Write); !err.IsNone()) {
+        return err;
+    }
+
+    for (uint64_t written = 0; written < fileSize; written += block->Size()) {
+        if (auto err = file.WriteBlock(*block); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    return file.Close();
+}
+
+// Each benchmark starts with cold page cache, so all of them read the file from the storage.
+Error DropFileCache(const String& path)
+{
+    auto fd = open(path.CStr(), O_RDONLY);
+    if (fd < 0) {
+        return Error(errno);
+    }
+
+    // Dirty pages are not dropped, so flush them first.
+    auto ret = fdatasync(fd) == 0 ? posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) : errno;
+
+    close(fd);
+
+    return ret == 0 ? ErrorEnum::eNone : Error(ret);
+}
+
+Error ReadFile(const String& path, fs::File::Mode mode)
+{
+    auto buffer = std::make_unique<StaticArray<uint8_t, cFileChunkSize>>();
+
+    fs::File file;
+
+    if (auto err = file.Open(path, mode); !err.IsNone()) {
+        return err;
+    }
+
+    while (true) {
+        auto err = file.ReadBlock(*buffer);
+        if (!err.IsNone() && !err.Is(ErrorEnum::eEOF)) {
+            return err;
+        }
+
+        if (buffer->IsEmpty()) {
+            break;
+        }
+
+        ConsumeBlock(*buffer);
+    }
+
+    return file.Close();
+}
+
+Error MapFile(const String& path)
+{
+    fs::File             file;
+    Array<const uint8_t> block;
+
+    if (auto err = file.Open(path, fs::File::Mode::ReadSequential); !err.IsNone()) {
+        return err;
+    }
+
+    while (true) {
+        auto err = file.MapBlock(cFileMapBlockSize, block);
+        if (!err.IsNone() && !err.Is(ErrorEnum::eEOF)) {
+            return err;
+        }
+
+        if (block.IsEmpty()) {
+            break;
+        }
+
+        ConsumeBlock(block);
+    }
+
+    return file.Close();
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void RunFSBenchmarks(Runner& runner, size_t fileSizeMiB)
+{
+    const auto sizeSuffix         = "_" + std::to_string(fileSizeMiB) + "mib";
+    const auto readName           = "common/tools/fs/read_block" + sizeSuffix;
+    const auto readSequentialName = "common/tools/fs/read_block_sequential" + sizeSuffix;
+    const auto mapName            = "common/tools/fs/map_block" + sizeSuffix;
+
+    if (!runner.IsSelected(readName) && !runner.IsSelected(readSequentialName) && !runner.IsSelected(mapName)) {
+        return;
+    }
+
+    const auto workDir = (std::filesystem::temp_directory_path() / "aos_benchmark_fs").string();
+    const auto path    = fs::JoinPath(workDir.c_str(), "file.bin");
+
+    if (auto err = fs::ClearDir(workDir.c_str()); !err.IsNone()) {
+        runner.Fail(readName, err);
+
+        return;
+    }
+
+    if (auto err = CreateFile(path, static_cast<uint64_t>(fileSizeMiB) * 1024 * 1024); !err.IsNone()) {
+        runner.Fail(readName, err);
+        fs::RemoveAll(workDir.c_str());
+
+        return;
+    }
+
+    // Each run reads the whole file once, so ns_per_op is the time to stream the file.
+    DropFileCache(path);
+    runner.Run(readName, 1, [&path](size_t) { return ReadFile(path, fs::File::Mode::Read); });
+
+    DropFileCache(path);
+    runner.Run(readSequentialName, 1, [&path](size_t) { return ReadFile(path, fs::File::Mode::ReadSequential); });
+
+    DropFileCache(path);
+    runner.Run(mapName, 1, [&path](size_t) { return MapFile(path); });
+
+    fs::RemoveAll(workDir.c_str());
+}
+
+} // namespace aos::benchmark
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string>
+
+#include <core/cm/launcher/launcher.hpp>
+#include <core/cm/launcher/tests/stubs/alertsproviderstub.hpp>
+#include <core/cm/launcher/tests/stubs/identproviderstub.hpp>
+#include <core/cm/launcher/tests/stubs/imagestorestub.hpp>
+#include <core/cm/launcher/tests/stubs/instancerunnerstub.hpp>
+#include <core/cm/launcher/tests/stubs/monitoringproviderstub.hpp>
+#include <core/cm/launcher/tests/stubs/nodeinfoproviderstub.hpp>
+#include <core/cm/launcher/tests/stubs/resourcemanagerstub.hpp>
+#include <core/cm/launcher/tests/stubs/storagestatestub.hpp>
+#include <core/cm/launcher/tests/stubs/storagestub.hpp>
+
+#include "runner.hpp"
+
+namespace aos::benchmark {
+
+using namespace cm;
+using namespace cm::launcher;
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+constexpr auto cNumNodes            = 16;
+constexpr auto cNumItems            = 16;
+constexpr auto cNumInstancesPerItem = 16;
+constexpr auto cRuntimeID           = "runc";
+constexpr auto cNodeType            = "vm";
+constexpr auto cSubjectID           = "subject1";
+constexpr auto cImageID             = "image1";
+
+static_assert(cNumNodes <= cMaxNumNodes, "too many nodes");
+static_assert(cNumItems * cNumInstancesPerItem <= cMaxNumInstances, "too many instances");
+
+bool ValidateID(size_t id)
+{
+    (void)id;
+
+    return true;
+}
+
+std::string GetNodeID(size_t index)
+{
+    return "node" + std::to_string(index);
+}
+
+std::string GetItemID(size_t index)
+{
+    return "service" + std::to_string(index);
+}
+
+UnitNodeInfo CreateNodeInfo(const std::string& nodeID)
+{
+    UnitNodeInfo nodeInfo;
+
+    nodeInfo.mNodeID     = nodeID.c_str();
+    nodeInfo.mNodeType   = cNodeType;
+    nodeInfo.mMaxDMIPS   = 100000;
+    nodeInfo.mTotalRAM   = 1024 * 1024;
+    nodeInfo.mOSInfo.mOS = "linux";
+    nodeInfo.mOSInfo.mVersion.SetValue("5.4.0");
+    nodeInfo.mState       = NodeStateEnum::eProvisioned;
+    nodeInfo.mIsConnected = true;
+
+    RuntimeInfo runtime;
+
+    runtime.mRuntimeID              = cRuntimeID;
+    runtime.mRuntimeType            = cRuntimeID;
+    runtime.mArchInfo.mArchitecture = "x86_64";
+    runtime.mOSInfo.mOS             = "linux";
+    runtime.mArchInfo.mVariant.SetValue("generic");
+    runtime.mOSInfo.mVersion.SetValue("5.4.0");
+
+    nodeInfo.mRuntimes.PushBack(runtime);
+
+    return nodeInfo;
+}
+
+oci::ImageConfig CreateImageConfig()
+{
+    oci::ImageConfig config;
+
+    config.mArchitecture = "x86_64";
+    config.mVariant      = "generic";
+    config.mOS           = "linux";
+    config.mOSVersion    = "5.4.0";
+
+    return config;
+}
+
+struct LauncherFixture {
+    alerts::AlertsProviderStub             mAlertsProvider;
+    imagemanager::ImageStoreStub           mImageStore;
+    iamclient::IdentProviderStub           mIdentProvider;
+    nodeinfoprovider::NodeInfoProviderStub mNodeInfoProvider;
+    testing::NiceMock<InstanceRunnerStub>  mInstanceRunner;
+    MonitoringProviderStub                 mMonitoringProvider;
+    resourcemanager::ResourceManagerStub   mResourceManager;
+    StorageStub                            mStorage;
+    storagestate::StorageStateStub         mStorageState;
+    Launcher                               mLauncher;
+
+    StaticArray<RunInstanceRequest, cMaxNumInstances> mRunRequest;
+    StaticArray<InstanceStatus, cMaxNumInstances>     mRunStatuses;
+
+    Error Start();
+    Error Stop() { return mLauncher.Stop(); }
+};
+
+Error LauncherFixture::Start()
+{
+    mStorageState.Init();
+    mStorageState.SetTotalStateSize(1024 * 1024);
+    mStorageState.SetTotalStorageSize(1024 * 1024);
+
+    mNodeInfoProvider.Init();
+    mImageStore.Init();
+    mMonitoringProvider.Init();
+    mAlertsProvider.Init();
+    mResourceManager.Init();
+    mStorage.Init();
+
+    if (auto err = mIdentProvider.SetSubjects({cSubjectID}); !err.IsNone()) {
+        return err;
+    }
+
+    for (size_t i = 0; i < cNumNodes; i++) {
+        auto nodeID = GetNodeID(i);
+
+        mNodeInfoProvider.AddNodeInfo(nodeID.c_str(), CreateNodeInfo(nodeID));
+
+        NodeConfig nodeConfig;
+
+        nodeConfig.mNodeID   = nodeID.c_str();
+        nodeConfig.mPriority = i;
+
+        mResourceManager.SetNodeConfig(nodeID.c_str(), cNodeType, nodeConfig);
+
+        auto nodeMonitoring = std::make_unique<monitoring::NodeMonitoringData>();
+
+        nodeMonitoring->mNodeID = nodeID.c_str();
+
+        mMonitoringProvider.SetAverageMonitoring(nodeID.c_str(), *nodeMonitoring);
+    }
+
+    for (size_t i = 0; i < cNumItems; i++) {
+        auto itemID     = GetItemID(i);
+        auto itemConfig = std::make_unique<oci::ItemConfig>();
+
+        itemConfig->mRuntimes.PushBack(cRuntimeID);
+        itemConfig->mBalancingPolicy = oci::BalancingPolicyEnum::eEnabled;
+
+        mImageStore.AddItem(itemID.c_str(), cImageID, *itemConfig, CreateImageConfig(), "");
+
+        RunInstanceRequest request;
+
+        request.mItemID                     = itemID.c_str();
+        request.mUpdateItemType             = UpdateItemTypeEnum::eService;
+        request.mSubjectInfo.mSubjectID     = cSubjectID;
+        request.mSubjectInfo.mSubjectType   = SubjectTypeEnum::eGroup;
+        request.mSubjectInfo.mIsUnitSubject = true;
+        request.mPriority                   = i;
+        request.mNumInstances               = cNumInstancesPerItem;
+
+        if (auto err = mRunRequest.PushBack(request); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    mInstanceRunner.Init(mLauncher, true, aos::InstanceStateEnum::eActive);
+
+    Config config;
+
+    config.mNodesConnectionTimeout     = 1 * Time::cMinutes;
+    config.mInstanceTTL                = 1 * Time::cHours;
+    config.mCheckOverrideEnvVarsPeriod = 1 * Time::cMinutes;
+
+    if (auto err = mLauncher.Init(config, mNodeInfoProvider, mInstanceRunner, mImageStore, mImageStore,
+            mResourceManager, mStorageState, mMonitoringProvider, mAlertsProvider, mIdentProvider, ValidateID,
+            ValidateID, mStorage);
+        !err.IsNone()) {
+        return err;
+    }
+
+    if (auto err = mLauncher.Start(); !err.IsNone()) {
+        return err;
+    }
+
+    for (size_t i = 0; i < cNumNodes; i++) {
+        mInstanceRunner.SendInitialStatuses(GetNodeID(i).c_str());
+    }
+
+    // Initial placement starts all instances, following runs measure balancing of already running instances.
+    if (auto err = mLauncher.RunInstances(mRunRequest, mRunStatuses); !err.IsNone()) {
+        return err;
+    }
+
+    for (const auto& status : mRunStatuses) {
+        if (status.mState != aos::InstanceStateEnum::eActive) {
+            return Error(ErrorEnum::eFailed, "instance is not placed");
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void RunLauncherBenchmarks(Runner& runner)
+{
+    constexpr auto cName = "cm/launcher/balancer/placement_16_nodes_256_instances";
+
+    if (!runner.IsEnabled(cName)) {
+        return;
+    }
+
+    auto fixture = std::make_unique<LauncherFixture>();
+
+    if (auto err = fixture->Start(); !err.IsNone()) {
+        runner.Fail(cName, err);
+        fixture->Stop();
+
+        return;
+    }
+
+    runner.Run(cName, 20, [&fixture](size_t iterations) -> Error {
+        for (size_t i = 0; i < iterations; i++) {
+            if (auto err = fixture->mLauncher.RunInstances(fixture->mRunRequest, fixture->mRunStatuses);
+                !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = fixture->Stop(); !err.IsNone()) {
+        runner.Fail(cName, err);
+    }
+}
+
+} // namespace aos::benchmark
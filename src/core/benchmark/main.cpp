@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "runner.hpp"
+
+using namespace aos::benchmark;
+
+namespace {
+
+constexpr size_t cDefaultFSFileSizeMiB = 2048;
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string filter;
+    size_t      fsFileSizeMiB = cDefaultFSFileSizeMiB;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+
+            continue;
+        }
+
+        if (strcmp(argv[i], "--fs-file-size") == 0 && i + 1 < argc) {
+            char* end = nullptr;
+
+            fsFileSizeMiB = strtoul(argv[++i], &end, 10);
+
+            if (*end == '\0' && fsFileSizeMiB > 0) {
+                continue;
+            }
+        }
+
+        std::cerr << "Usage: " << argv[0] << " [--filter <substring>] [--fs-file-size <MiB>]" << std::endl;
+
+        return 1;
+    }
+
+    Runner runner(filter);
+
+    RunToolsBenchmarks(runner);
+    RunFSBenchmarks(runner, fsFileSizeMiB);
+    RunLauncherBenchmarks(runner);
+    RunCryptoHelperBenchmarks(runner);
+#ifdef AOS_BENCHMARK_PKCS11
+    RunPKCS11Benchmarks(runner);
+#endif
+
+    runner.PrintJSON(std::cout);
+
+    return runner.HasErrors() ? 1 : 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <core/common/crypto/cryptoprovider.hpp>
+#include <core/common/pkcs11/privatekey.hpp>
+#include <core/common/tests/crypto/softhsmenv.hpp>
+#include <core/common/tools/allocator.hpp>
+#include <core/common/tools/uuid.hpp>
+
+#include "runner.hpp"
+
+namespace aos::benchmark {
+
+using namespace pkcs11;
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+constexpr auto cLabel          = "aos benchmark slot";
+constexpr auto cPIN            = "admin";
+constexpr auto cKeyID          = "08080808-0404-0404-0404-121212121212";
+constexpr auto cKeySize        = 2048;
+constexpr auto cSignsPerThread = 64;
+
+struct PKCS11Fixture {
+    crypto::DefaultCryptoProvider mCryptoProvider;
+    test::SoftHSMEnv              mSoftHSMEnv;
+    PrivateKey                    mKey;
+    StaticArray<uint8_t, 32>      mDigest;
+
+    StaticAllocator<sizeof(PKCS11RSAPrivateKey) + Utils::cLocalObjectsMaxSize> mAllocator;
+
+    Error Init();
+};
+
+Error PKCS11Fixture::Init()
+{
+    if (auto err = mCryptoProvider.Init(); !err.IsNone()) {
+        return err;
+    }
+
+    if (auto err = mSoftHSMEnv.Init(cPIN, cLabel); !err.IsNone()) {
+        return err;
+    }
+
+    auto [session, err] = mSoftHSMEnv.OpenUserSession(cPIN, true);
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    auto [id, idErr] = uuid::StringToUUID(cKeyID);
+    if (!idErr.IsNone()) {
+        return idErr;
+    }
+
+    Tie(mKey, err) = Utils(session, mCryptoProvider, mAllocator).GenerateRSAKeyPairWithLabel(id, cLabel, cKeySize);
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    // Sign operation doesn't depend on digest content, so any digest of SHA256 size is used.
+    mDigest.Resize(mDigest.MaxSize());
+
+    for (size_t i = 0; i < mDigest.Size(); i++) {
+        mDigest[i] = static_cast<uint8_t>(i);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+// Signs with the same key from numThreads callers, each caller performs iterations / numThreads signs.
+Error SignConcurrently(PKCS11Fixture& fixture, size_t numThreads, size_t iterations)
+{
+    std::vector<std::thread> threads;
+    std::vector<Error>       errors(numThreads);
+
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&fixture, &errors, i, numThreads, iterations]() {
+            StaticArray<uint8_t, cKeySize / 8> signature;
+
+            for (size_t j = i; j < iterations; j += numThreads) {
+                if (auto err = fixture.mKey.GetPrivKey()->Sign(fixture.mDigest, {crypto::HashEnum::eSHA256}, signature);
+                    !err.IsNone()) {
+                    errors[i] = err;
+
+                    return;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& err : errors) {
+        if (!err.IsNone()) {
+            return err;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void RunPKCS11Benchmarks(Runner& runner)
+{
+    // Single caller, callers matching the pool size and callers exceeding it. With the session pool, ns_per_op goes
+    // down until the number of callers reaches the pool size.
+    const std::vector<size_t> numThreads = {1, cSessionPoolMaxSize, cSessionPoolMaxSize * 2};
+
+    std::vector<std::string> names;
+
+    for (auto item : numThreads) {
+        names.push_back("common/pkcs11/session_pool/rsa_sign_" + std::to_string(item) + "_threads");
+    }
+
+    bool enabled = false;
+
+    for (const auto& name : names) {
+        enabled = enabled || runner.IsEnabled(name);
+    }
+
+    if (!enabled) {
+        return;
+    }
+
+    auto fixture = std::make_unique<PKCS11Fixture>();
+
+    if (auto err = fixture->Init(); !err.IsNone()) {
+        runner.Fail(names[0], err);
+
+        return;
+    }
+
+    for (size_t i = 0; i < numThreads.size(); i++) {
+        runner.Run(names[i], cSignsPerThread * numThreads[i], [&fixture, &numThreads, i](size_t iterations) {
+            return SignConcurrently(*fixture, numThreads[i], iterations);
+        });
+    }
+}
+
+} // namespace aos::benchmark
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <iomanip>
+
+#include <core/common/tools/string.hpp>
+
+#include "runner.hpp"
+
+namespace aos::benchmark {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+std::string EscapeJSON(const std::string& str)
+{
+    std::string result;
+
+    for (auto ch : str) {
+        switch (ch) {
+        case '"':
+            result += "\\\"";
+            break;
+
+        case '\\':
+            result += "\\\\";
+            break;
+
+        case '\n':
+            result += "\\n";
+            break;
+
+        default:
+            if (static_cast<unsigned char>(ch) >= 0x20) {
+                result += ch;
+            }
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+bool Runner::HasErrors() const
+{
+    for (const auto& result : mResults) {
+        if (!result.mError.IsNone()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Runner::PrintJSON(std::ostream& out) const
+{
+    out << "{\"version\": " << cVersion << ", \"benchmarks\": [\n";
+
+    for (size_t i = 0; i < mResults.size(); i++) {
+        const auto& result  = mResults[i];
+        double      nsPerOp = result.mIterations != 0 ? static_cast<double>(result.mTotalNs) / result.mIterations : 0;
+
+        out << "  {\"name\": \"" << EscapeJSON(result.mName) << "\", \"iterations\": " << result.mIterations
+            << ", \"total_ns\": " << result.mTotalNs << ", \"ns_per_op\": " << std::fixed << std::setprecision(1)
+            << nsPerOp << ", \"error\": ";
+
+        if (result.mError.IsNone()) {
+            out << "null";
+        } else {
+            StaticString<cMaxErrorStrLen> errStr;
+
+            errStr.Convert(result.mError);
+
+            out << "\"" << EscapeJSON(errStr.CStr()) << "\"";
+        }
+
+        out << "}" << (i + 1 < mResults.size() ? "," : "") << "\n";
+    }
+
+    out << "]}\n";
+}
+
+} // namespace aos::benchmark
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_BENCHMARK_RUNNER_HPP_
+#define AOS_CORE_BENCHMARK_RUNNER_HPP_
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <core/common/tools/error.hpp>
+
+namespace aos::benchmark {
+
+/**
+ * Benchmark result.
+ */
+struct Result {
+    std::string mName;
+    size_t      mIterations {};
+    uint64_t    mTotalNs {};
+    Error       mError;
+};
+
+/**
+ * Benchmark runner.
+ *
+ * Runs named benchmarks matching the filter and prints results in JSON format:
+ *
+ * {"version": 1, "benchmarks": [
+ *   {"name": "<name>", "iterations": <N>, "total_ns": <ns>, "ns_per_op": <ns>, "error": null | "<error>"},
+ *   ...
+ * ]}
+ *
+ * Keys order and names are stable, so outputs of different runs can be compared by scripts.
+ */
+class Runner {
+public:
+    /**
+     * Output format version.
+     */
+    static constexpr auto cVersion = 1;
+
+    /**
+     * Creates runner.
+     *
+     * @param filter runs only benchmarks which names contain filter, empty filter runs all benchmarks.
+     */
+    explicit Runner(const std::string& filter = "")
+        : mFilter(filter)
+    {
+    }
+
+    /**
+     * Checks if benchmark is enabled by filter.
+     *
+     * Benchmarks with heavy setup use it to skip the setup if they are disabled.
+     *
+     * @param name benchmark name.
+     * @return bool.
+     */
+    bool IsEnabled(const std::string& name) const { return mFilter.empty() || name.find(mFilter) != std::string::npos; }
+
+    /**
+     * Checks if benchmark is explicitly selected by filter.
+     *
+     * Benchmarks which are too heavy to run by default use it, so they run only if the filter selects them.
+     *
+     * @param name benchmark name.
+     * @return bool.
+     */
+    bool IsSelected(const std::string& name) const { return !mFilter.empty() && IsEnabled(name); }
+
+    /**
+     * Runs benchmark.
+     *
+     * Benchmark functor performs the measured operation the given number of times and returns error on failure. Setup
+     * which should not be measured is done before calling Run.
+     *
+     * @param name benchmark name.
+     * @param iterations number of operations.
+     * @param func benchmark functor: Error(size_t iterations).
+     */
+    template <typename F>
+    void Run(const std::string& name, size_t iterations, F func)
+    {
+        if (!IsEnabled(name)) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto err   = func(iterations);
+        auto end   = std::chrono::steady_clock::now();
+
+        mResults.push_back(
+            {name, iterations, static_cast<uint64_t>(std::chrono::nanoseconds(end - start).count()), err});
+    }
+
+    /**
+     * Records failed benchmark which can't be run.
+     *
+     * @param name benchmark name.
+     * @param err error.
+     */
+    void Fail(const std::string& name, const Error& err)
+    {
+        if (!IsEnabled(name)) {
+            return;
+        }
+
+        mResults.push_back({name, 0, 0, err});
+    }
+
+    /**
+     * Returns benchmark results.
+     *
+     * @return const std::vector<Result>&.
+     */
+    const std::vector<Result>& GetResults() const { return mResults; }
+
+    /**
+     * Checks if any benchmark failed.
+     *
+     * @return bool.
+     */
+    bool HasErrors() const;
+
+    /**
+     * Prints results in JSON format.
+     *
+     * @param out output stream.
+     */
+    void PrintJSON(std::ostream& out) const;
+
+private:
+    std::string         mFilter;
+    std::vector<Result> mResults;
+};
+
+/**
+ * Runs common tools benchmarks.
+ *
+ * @param runner benchmark runner.
+ */
+void RunToolsBenchmarks(Runner& runner);
+
+/**
+ * Runs file system benchmarks.
+ *
+ * The benchmarks write a file of the given size, so they run only if explicitly selected by filter.
+ *
+ * @param runner benchmark runner.
+ * @param fileSizeMiB test file size in MiB.
+ */
+void RunFSBenchmarks(Runner& runner, size_t fileSizeMiB);
+
+/**
+ * Runs CM launcher benchmarks.
+ *
+ * @param runner benchmark runner.
+ */
+void RunLauncherBenchmarks(Runner& runner);
+
+/**
+ * Runs crypto helper benchmarks.
+ *
+ * @param runner benchmark runner.
+ */
+void RunCryptoHelperBenchmarks(Runner& runner);
+
+/**
+ * Runs PKCS11 benchmarks.
+ *
+ * @param runner benchmark runner.
+ */
+void RunPKCS11Benchmarks(Runner& runner);
+
+} // namespace aos::benchmark
+
+#endif
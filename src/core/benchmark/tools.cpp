@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include <core/common/tools/allocator.hpp>
+#include <core/common/tools/identifierpool.hpp>
+#include <core/common/tools/list.hpp>
+#include <core/common/tools/map.hpp>
+#include <core/common/tools/memory.hpp>
+#include <core/common/tools/string.hpp>
+#include <core/common/tools/thread.hpp>
+#include <core/common/tools/timer.hpp>
+
+#include "runner.hpp"
+
+namespace aos::benchmark {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+constexpr auto cNumItems = 256;
+constexpr auto cKeyLen   = 32;
+
+using Key = StaticString<cKeyLen>;
+
+volatile size_t sSink;
+
+bool ValidateID(size_t id)
+{
+    (void)id;
+
+    return true;
+}
+
+Key CreateKey(size_t index)
+{
+    Key key;
+
+    key.Format("item-%zu", index);
+
+    return key;
+}
+
+void RunAllocatorBenchmarks(Runner& runner)
+{
+    constexpr size_t cNumAllocations = 8;
+
+    runner.Run("tools/allocator/allocate_free", 100000, [](size_t iterations) -> Error {
+        auto  allocator = std::make_unique<StaticAllocator<16384, cNumAllocations>>();
+        void* data[cNumAllocations];
+
+        for (size_t i = 0; i < iterations; i++) {
+            for (size_t j = 0; j < cNumAllocations; j++) {
+                if ((data[j] = allocator->Allocate(64 * (j + 1))) == nullptr) {
+                    return ErrorEnum::eNoMemory;
+                }
+            }
+
+            // Free in allocation order to exercise free block merging.
+            for (size_t j = 0; j < cNumAllocations; j++) {
+                allocator->Free(data[j]);
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    runner.Run("tools/shared_ptr/copy", 1000000, [](size_t iterations) -> Error {
+        StaticAllocator<sizeof(size_t)> allocator;
+
+        auto ptr = MakeShared<size_t>(&allocator, 42);
+        if (!ptr) {
+            return ErrorEnum::eNoMemory;
+        }
+
+        for (size_t i = 0; i < iterations; i++) {
+            SharedPtr<size_t> copy = ptr;
+
+            sSink = *copy;
+        }
+
+        return ErrorEnum::eNone;
+    });
+}
+
+void RunMapBenchmarks(Runner& runner)
+{
+    using TestMap = StaticMap<Key, size_t, cNumItems>;
+
+    auto map  = std::make_unique<TestMap>();
+    auto keys = std::make_unique<StaticArray<Key, cNumItems>>();
+
+    for (size_t i = 0; i < cNumItems; i++) {
+        keys->PushBack(CreateKey(i));
+        map->Set(keys->Back(), i);
+    }
+
+    runner.Run("tools/static_map/find_256", 100000, [&map, &keys](size_t iterations) -> Error {
+        for (size_t i = 0; i < iterations; i++) {
+            auto it = map->Find((*keys)[i % cNumItems]);
+            if (it == map->end()) {
+                return ErrorEnum::eNotFound;
+            }
+
+            sSink = it->mSecond;
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    runner.Run("tools/static_map/set_256", 100000, [&map, &keys](size_t iterations) -> Error {
+        for (size_t i = 0; i < iterations; i++) {
+            if (auto err = map->Set((*keys)[i % cNumItems], i); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+}
+
+void RunListBenchmarks(Runner& runner)
+{
+    runner.Run("tools/static_list/push_back_pop_front", 1000000, [](size_t iterations) -> Error {
+        auto list = std::make_unique<StaticList<size_t, cNumItems>>();
+
+        for (size_t i = 0; i < cNumItems / 2; i++) {
+            if (auto err = list->PushBack(i); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        for (size_t i = 0; i < iterations; i++) {
+            if (auto err = list->PushBack(i); !err.IsNone()) {
+                return err;
+            }
+
+            if (auto err = list->PopFront(); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    runner.Run("tools/static_list/iterate_256", 10000, [](size_t iterations) -> Error {
+        auto list = std::make_unique<StaticList<size_t, cNumItems>>();
+
+        for (size_t i = 0; i < cNumItems; i++) {
+            if (auto err = list->PushBack(i); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        for (size_t i = 0; i < iterations; i++) {
+            size_t sum = 0;
+
+            for (const auto& item : *list) {
+                sum += item;
+            }
+
+            sSink = sum;
+        }
+
+        return ErrorEnum::eNone;
+    });
+}
+
+void RunTimerBenchmarks(Runner& runner)
+{
+    // Measures timer start and callback invocation latency for the shortest allowed interval.
+    runner.Run("tools/timer/create_fire", 100, [](size_t iterations) -> Error {
+        std::mutex              mutex;
+        std::condition_variable condVar;
+        size_t                  fired = 0;
+
+        for (size_t i = 0; i < iterations; i++) {
+            Timer timer;
+
+            if (auto err = timer.Start(Time::cMilliseconds, [&](void*) {
+                    std::lock_guard lock {mutex};
+
+                    fired++;
+                    condVar.notify_one();
+                });
+                !err.IsNone()) {
+                return err;
+            }
+
+            std::unique_lock lock {mutex};
+
+            if (!condVar.wait_for(lock, std::chrono::seconds(1), [&] { return fired == i + 1; })) {
+                return ErrorEnum::eTimeout;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+}
+
+void RunThreadPoolBenchmarks(Runner& runner)
+{
+    runner.Run("tools/thread_pool/run_4_threads", 100000, [](size_t iterations) -> Error {
+        constexpr size_t cQueueSize = 256;
+
+        auto pool = std::make_unique<ThreadPool<4, cQueueSize>>();
+
+        if (auto err = pool->Run(); !err.IsNone()) {
+            return err;
+        }
+
+        for (size_t i = 0; i < iterations; i++) {
+            // Drain the queue when full and continue.
+            if (i % cQueueSize == cQueueSize - 1) {
+                if (auto err = pool->Wait(); !err.IsNone()) {
+                    return err;
+                }
+            }
+
+            if (auto err = pool->AddTask([i](void*) { sSink = i; }); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        if (auto err = pool->Wait(); !err.IsNone()) {
+            return err;
+        }
+
+        return pool->Shutdown();
+    });
+}
+
+void RunIdentifierPoolBenchmarks(Runner& runner)
+{
+    constexpr size_t cMaxNumLockedIDs = 256;
+
+    // Each acquire scans already locked identifiers, so the pool is filled up to its limit and then cleared.
+    runner.Run("tools/identifier_range_pool/acquire_256", 10000, [](size_t iterations) -> Error {
+        auto pool = std::make_unique<IdentifierRangePool<5000, 65535, cMaxNumLockedIDs>>();
+
+        if (auto err = pool->Init(ValidateID); !err.IsNone()) {
+            return err;
+        }
+
+        for (size_t i = 0; i < iterations; i++) {
+            if (i % cMaxNumLockedIDs == 0) {
+                if (auto err = pool->Clear(); !err.IsNone()) {
+                    return err;
+                }
+            }
+
+            auto [id, err] = pool->Acquire();
+            if (!err.IsNone()) {
+                return err;
+            }
+
+            sSink = id;
+        }
+
+        return ErrorEnum::eNone;
+    });
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void RunToolsBenchmarks(Runner& runner)
+{
+    RunAllocatorBenchmarks(runner);
+    RunMapBenchmarks(runner);
+    RunListBenchmarks(runner);
+    RunTimerBenchmarks(runner);
+    RunThreadPoolBenchmarks(runner);
+    RunIdentifierPoolBenchmarks(runner);
+}
+
+} // namespace aos::benchmark
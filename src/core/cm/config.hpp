@@ -35,4 +35,11 @@
 #define AOS_CONFIG_CM_UNITCONFIG_JSON_LEN 4096
 #endif
 
+/**
+ * Number of threads used to check and update node configs.
+ */
+#ifndef AOS_CONFIG_CM_UNITCONFIG_NUM_NODE_THREADS
+#define AOS_CONFIG_CM_UNITCONFIG_NUM_NODE_THREADS 4
+#endif
+
 #endif
@@ -33,15 +33,6 @@ Error ImageManager::Init(const Config& config, StorageItf& storage, BlobInfoProv
     mFileInfoProvider          = &fileInfoProvider;
     mOCISpec                   = &ociSpec;
 
-    auto items = MakeUnique<StaticArray<ItemInfo, cMaxNumUpdateItems>>(&mAllocator);
-    if (!items) {
-        return AOS_ERROR_WRAP(ErrorEnum::eNoMemory);
-    }
-
-    if (auto err = mStorage->GetAllItemsInfos(*items); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
-
     mBlobsInstallPath = fs::JoinPath(mConfig.mInstallPath, cBlobsDirName);
 
     if (auto err = fs::MakeDirAll(mBlobsInstallPath); !err.IsNone()) {
@@ -58,7 +49,9 @@ Error ImageManager::Init(const Config& config, StorageItf& storage, BlobInfoProv
         return AOS_ERROR_WRAP(err);
     }
 
-    RegisterOutdatedItems(*items);
+    if (auto err = RegisterOutdatedItems(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
 
     auto [cleanupSize, cleanupErr] = CleanupOrphanedBlobs();
     if (!cleanupErr.IsNone()) {
@@ -300,16 +293,7 @@ Error ImageManager::GetUpdateItemsStatuses(Array<UpdateItemStatus>& statuses)
 
     LOG_DBG() << "Get update items statuses";
 
-    auto items = MakeUnique<StaticArray<ItemInfo, cMaxNumUpdateItems>>(&mAllocator);
-    if (!items) {
-        return ErrorEnum::eNoMemory;
-    }
-
-    if (auto err = mStorage->GetAllItemsInfos(*items); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
-
-    for (const auto& item : *items) {
+    auto visitor = MakeVisitor<ItemInfo>([&statuses](const ItemInfo& item) -> Error {
         UpdateItemStatus status;
 
         status.mItemID  = item.mItemID;
@@ -321,6 +305,12 @@ Error ImageManager::GetUpdateItemsStatuses(Array<UpdateItemStatus>& statuses)
         if (auto err = statuses.PushBack(status); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
+
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = mStorage->VisitItemsInfos({}, visitor); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
     return ErrorEnum::eNone;
@@ -358,23 +348,29 @@ Error ImageManager::GetIndexDigest(const String& itemID, const String& version,
 
     LOG_DBG() << "Get index digest" << Log::Field("itemID", itemID) << Log::Field("version", version);
 
-    auto items = MakeUnique<StaticArray<ItemInfo, cMaxNumItemVersions>>(&mAllocator);
-    if (!items) {
-        return ErrorEnum::eNoMemory;
-    }
+    ItemFilter filter;
 
-    if (auto err = mStorage->GetItemInfos(itemID, *items); !err.IsNone()) {
+    filter.mItemID.SetValue(itemID);
+
+    Optional<StaticString<oci::cDigestLen>> indexDigest;
+
+    auto visitor = MakeVisitor<ItemInfo>([&](const ItemInfo& item) -> Error {
+        if (!indexDigest.HasValue() && item.mVersion == version && item.mState != ItemStateEnum::eDownloading) {
+            indexDigest.SetValue(item.mIndexDigest);
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = mStorage->VisitItemsInfos(filter, visitor); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    auto it = items->FindIf(
-        [&](const auto& item) { return item.mVersion == version && item.mState != ItemStateEnum::eDownloading; });
-
-    if (it == items->end()) {
+    if (!indexDigest.HasValue()) {
         return ErrorEnum::eNotFound;
     }
 
-    digest = it->mIndexDigest;
+    digest = *indexDigest;
 
     return ErrorEnum::eNone;
 }
@@ -429,26 +425,35 @@ Error ImageManager::GetItemCurrentVersion(const String& itemID, String& version)
 
     LOG_DBG() << "Get item current version" << Log::Field("itemID", itemID);
 
-    auto items = MakeUnique<StaticArray<ItemInfo, cMaxNumItemVersions>>(&mAllocator);
-    if (!items) {
-        return ErrorEnum::eNoMemory;
-    }
+    ItemFilter filter;
 
-    if (auto err = mStorage->GetItemInfos(itemID, *items); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
+    filter.mItemID.SetValue(itemID);
+
+    Optional<StaticString<cVersionLen>> pendingVersion;
+    Optional<StaticString<cVersionLen>> installedVersion;
+
+    auto visitor = MakeVisitor<ItemInfo>([&](const ItemInfo& item) -> Error {
+        if (!pendingVersion.HasValue() && item.mState == ItemStateEnum::ePending) {
+            pendingVersion.SetValue(item.mVersion);
+        } else if (!installedVersion.HasValue() && item.mState == ItemStateEnum::eInstalled) {
+            installedVersion.SetValue(item.mVersion);
+        }
 
-    auto it = items->FindIf([&](const auto& item) { return item.mState == ItemStateEnum::ePending; });
-    if (it == items->end()) {
-        it = items->FindIf([&](const auto& item) { return item.mState == ItemStateEnum::eInstalled; });
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = mStorage->VisitItemsInfos(filter, visitor); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
-    if (it == items->end()) {
+    if (pendingVersion.HasValue()) {
+        version = *pendingVersion;
+    } else if (installedVersion.HasValue()) {
+        version = *installedVersion;
+    } else {
         return ErrorEnum::eNotFound;
     }
 
-    version = it->mVersion;
-
     return ErrorEnum::eNone;
 }
 
@@ -458,22 +463,30 @@ RetWithError<size_t> ImageManager::RemoveItem(const String& id, const String& ve
 
     LOG_DBG() << "Remove item" << Log::Field("id", id) << Log::Field("version", version);
 
-    auto storedItems = MakeUnique<StaticArray<ItemInfo, cMaxNumUpdateItems>>(&mAllocator);
-    if (!storedItems) {
-        return {0, AOS_ERROR_WRAP(ErrorEnum::eNoMemory)};
-    }
+    ItemFilter filter;
 
-    if (auto err = mStorage->GetItemInfos(id, *storedItems); !err.IsNone()) {
+    filter.mItemID.SetValue(id);
+    filter.mState.SetValue(ItemStateEnum::eRemoved);
+
+    Optional<ItemInfo> removedItem;
+
+    auto visitor = MakeVisitor<ItemInfo>([&removedItem](const ItemInfo& item) -> Error {
+        if (!removedItem.HasValue()) {
+            removedItem.SetValue(item);
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = mStorage->VisitItemsInfos(filter, visitor); !err.IsNone()) {
         return {0, AOS_ERROR_WRAP(err)};
     }
 
-    auto itemIt = storedItems->FindIf([](const auto& item) { return item.mState == ItemStateEnum::eRemoved; });
-
-    if (itemIt == storedItems->end()) {
+    if (!removedItem.HasValue()) {
         return {0, ErrorEnum::eNotFound};
     }
 
-    const auto& itemToRemove = *itemIt;
+    const auto& itemToRemove = *removedItem;
 
     if (auto err = mStorage->RemoveItem(itemToRemove.mItemID, itemToRemove.mVersion); !err.IsNone()) {
         return {0, AOS_ERROR_WRAP(err)};
@@ -508,41 +521,58 @@ Error ImageManager::RemoveOutdatedItems()
 
     LOG_DBG() << "Remove outdated items";
 
-    auto items = MakeUnique<StaticArray<ItemInfo, cMaxNumUpdateItems>>(&mAllocator);
-    if (!items) {
+    auto outdatedItems = MakeUnique<StaticArray<ItemInfo, cMaxNumUpdateItems>>(&mAllocator);
+    if (!outdatedItems) {
         return AOS_ERROR_WRAP(ErrorEnum::eNoMemory);
     }
 
-    if (auto err = mStorage->GetAllItemsInfos(*items); !err.IsNone()) {
+    ItemFilter filter;
+
+    filter.mState.SetValue(ItemStateEnum::eRemoved);
+
+    auto now = Time::Now();
+
+    // Storage can't be modified while visiting, so outdated items are collected first and removed after visiting.
+    auto visitor = MakeVisitor<ItemInfo>([&](const ItemInfo& item) -> Error {
+        if (item.mTimestamp.Add(mConfig.mUpdateItemTTL) < now) {
+            if (auto err = outdatedItems->PushBack(item); !err.IsNone()) {
+                return AOS_ERROR_WRAP(err);
+            }
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = mStorage->VisitItemsInfos(filter, visitor); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
     bool hasRemovedItems = false;
 
-    for (const auto& item : *items) {
-        if (item.mState == ItemStateEnum::eRemoved && item.mTimestamp.Add(mConfig.mUpdateItemTTL) < Time::Now()) {
-            LOG_DBG() << "Removing outdated item" << Log::Field("itemID", item.mItemID)
-                      << Log::Field("version", item.mVersion);
+    for (const auto& item : *outdatedItems) {
+        LOG_DBG() << "Removing outdated item" << Log::Field("itemID", item.mItemID)
+                  << Log::Field("version", item.mVersion);
 
-            if (auto err = mStorage->RemoveItem(item.mItemID, item.mVersion); !err.IsNone()) {
-                LOG_ERR() << "Failed to remove outdated item" << Log::Field("itemID", item.mItemID)
-                          << Log::Field("version", item.mVersion) << Log::Field(err);
+        if (auto err = mStorage->RemoveItem(item.mItemID, item.mVersion); !err.IsNone()) {
+            LOG_ERR() << "Failed to remove outdated item" << Log::Field("itemID", item.mItemID)
+                      << Log::Field("version", item.mVersion) << Log::Field(err);
 
-                continue;
-            }
-
-            if (auto err = mInstallSpaceAllocator->RestoreOutdatedItem(item.mItemID, item.mVersion); !err.IsNone()) {
-                LOG_ERR() << "Failed to restore outdated item" << Log::Field("itemID", item.mItemID) << Log::Field(err);
-            }
+            continue;
+        }
 
-            for (auto* listener : mListeners) {
-                listener->OnItemRemoved(item.mItemID);
-            }
+        if (auto err = mInstallSpaceAllocator->RestoreOutdatedItem(item.mItemID, item.mVersion); !err.IsNone()) {
+            LOG_ERR() << "Failed to restore outdated item" << Log::Field("itemID", item.mItemID) << Log::Field(err);
+        }
 
-            hasRemovedItems = true;
+        for (auto* listener : mListeners) {
+            listener->OnItemRemoved(item.mItemID);
         }
+
+        hasRemovedItems = true;
     }
 
+    outdatedItems.Reset();
+
     if (hasRemovedItems) {
         auto [totalSize, err] = CleanupOrphanedBlobs();
         if (!err.IsNone()) {
@@ -1215,21 +1245,13 @@ Error ImageManager::CheckExistingBlob(const String& installPath)
 Error ImageManager::PrepareDownloadSpace(const String& downloadPath, const BlobInfo& blobInfo,
     size_t& partialDownloadSize, UniquePtr<spaceallocator::SpaceItf>& downloadingSpace)
 {
-    auto [downloadExists, checkDownloadErr] = fs::FileExist(downloadPath);
-    if (!checkDownloadErr.IsNone()) {
-        return AOS_ERROR_WRAP(checkDownloadErr);
+    // Downloader may keep partial data outside of download path, e.g. not merged segments.
+    auto [downloadedSize, getSizeErr] = mDownloader->GetDownloadedSize(downloadPath);
+    if (!getSizeErr.IsNone()) {
+        return AOS_ERROR_WRAP(getSizeErr);
     }
 
-    partialDownloadSize = 0;
-
-    if (downloadExists) {
-        auto [dirSize, getSizeErr] = fs::CalculateSize(downloadPath);
-        if (!getSizeErr.IsNone()) {
-            return AOS_ERROR_WRAP(getSizeErr);
-        }
-
-        partialDownloadSize = dirSize;
-    }
+    partialDownloadSize = downloadedSize;
 
     mDownloadingSpaceAllocator->FreeSpace(partialDownloadSize);
 
@@ -1269,13 +1291,14 @@ Error ImageManager::PerformDownload(const BlobInfo& blobInfo, const String& down
     }
 
     while (true) {
-        auto err = mDownloader->Download(blobInfo.mDigest, blobInfo.mURLs[0], downloadPath);
+        auto err = mDownloader->DownloadFromMirrors(blobInfo.mDigest, blobInfo.mURLs, downloadPath, blobInfo.mSize);
         if (!err.IsNone()) {
-            LOG_ERR() << "Failed to download" << Log::Field("url", blobInfo.mURLs[0])
-                      << Log::Field("path", downloadPath) << Log::Field(AOS_ERROR_WRAP(err));
+            LOG_ERR() << "Failed to download" << Log::Field("digest", blobInfo.mDigest)
+                      << Log::Field("numURLs", blobInfo.mURLs.Size()) << Log::Field("path", downloadPath)
+                      << Log::Field(AOS_ERROR_WRAP(err));
 
             if (err = WaitForStop(); !err.IsNone()) {
-                auto [newPartialSize, retrySizeErr] = fs::CalculateSize(downloadPath);
+                auto [newPartialSize, retrySizeErr] = mDownloader->GetDownloadedSize(downloadPath);
                 if (!retrySizeErr.IsNone()) {
                     LOG_WRN() << "Failed to get partial download size" << Log::Field("path", downloadPath)
                               << Log::Field(retrySizeErr);
@@ -1300,7 +1323,7 @@ Error ImageManager::PerformDownload(const BlobInfo& blobInfo, const String& down
                 return err;
             }
 
-            LOG_DBG() << "Retrying download" << Log::Field("url", blobInfo.mURLs[0])
+            LOG_DBG() << "Retrying download" << Log::Field("digest", blobInfo.mDigest)
                       << Log::Field("path", downloadPath);
 
             continue;
@@ -1467,17 +1490,23 @@ void ImageManager::NotifyItemStatusChanged(
     NotifyItemsStatusesChanged(status);
 }
 
-void ImageManager::RegisterOutdatedItems(const Array<ItemInfo>& items)
+Error ImageManager::RegisterOutdatedItems()
 {
-    for (const auto& item : items) {
-        if (item.mState == ItemStateEnum::eRemoved) {
-            if (auto err = mInstallSpaceAllocator->AddOutdatedItem(item.mItemID, item.mVersion, item.mTimestamp);
-                !err.IsNone()) {
-                LOG_ERR() << "Failed to add outdated item" << Log::Field("itemID", item.mItemID)
-                          << Log::Field("version", item.mVersion) << Log::Field(err);
-            }
+    ItemFilter filter;
+
+    filter.mState.SetValue(ItemStateEnum::eRemoved);
+
+    auto visitor = MakeVisitor<ItemInfo>([this](const ItemInfo& item) -> Error {
+        if (auto err = mInstallSpaceAllocator->AddOutdatedItem(item.mItemID, item.mVersion, item.mTimestamp);
+            !err.IsNone()) {
+            LOG_ERR() << "Failed to add outdated item" << Log::Field("itemID", item.mItemID)
+                      << Log::Field("version", item.mVersion) << Log::Field(err);
         }
-    }
+
+        return ErrorEnum::eNone;
+    });
+
+    return mStorage->VisitItemsInfos(filter, visitor);
 }
 
 Error ImageManager::VerifyBlobIntegrity(const String& digest)
@@ -1591,60 +1620,76 @@ Error ImageManager::VerifyItemBlobs(const String& indexDigest)
     return ErrorEnum::eNone;
 }
 
-bool ImageManager::IsBlobUsedByItems(const String& blobDigest, const Array<ItemInfo>& items)
+RetWithError<bool> ImageManager::IsBlobUsedByItems(const String& blobDigest)
 {
-    for (const auto& item : items) {
-        if (item.mIndexDigest == blobDigest) {
+    bool used = false;
+
+    auto visitor = MakeVisitor<ItemInfo>([&](const ItemInfo& item) -> Error {
+        if (!used) {
+            used = IsBlobUsedByItem(blobDigest, item);
+        }
+
+        return ErrorEnum::eNone;
+    });
+
+    if (auto err = mStorage->VisitItemsInfos({}, visitor); !err.IsNone()) {
+        return {false, AOS_ERROR_WRAP(err)};
+    }
+
+    return used;
+}
+
+bool ImageManager::IsBlobUsedByItem(const String& blobDigest, const ItemInfo& item)
+{
+    if (item.mIndexDigest == blobDigest) {
+        return true;
+    }
+
+    StaticString<cFilePathLen> indexPath;
+    if (auto err = GetBlobFilePath(mBlobsInstallPath, item.mIndexDigest, indexPath); !err.IsNone()) {
+        return false;
+    }
+
+    auto imageIndex = MakeUnique<oci::ImageIndex>(&mAllocator);
+    if (!imageIndex) {
+        return false;
+    }
+
+    if (auto err = mOCISpec->LoadImageIndex(indexPath, *imageIndex); !err.IsNone()) {
+        return false;
+    }
+
+    for (const auto& manifestDescriptor : imageIndex->mManifests) {
+        if (manifestDescriptor.mDigest == blobDigest) {
             return true;
         }
 
-        StaticString<cFilePathLen> indexPath;
-        if (auto err = GetBlobFilePath(mBlobsInstallPath, item.mIndexDigest, indexPath); !err.IsNone()) {
+        StaticString<cFilePathLen> manifestPath;
+        if (auto err = GetBlobFilePath(mBlobsInstallPath, manifestDescriptor.mDigest, manifestPath); !err.IsNone()) {
             continue;
         }
 
-        auto imageIndex = MakeUnique<oci::ImageIndex>(&mAllocator);
-        if (!imageIndex) {
+        auto manifest = MakeUnique<oci::ImageManifest>(&mAllocator);
+        if (!manifest) {
             continue;
         }
 
-        if (auto err = mOCISpec->LoadImageIndex(indexPath, *imageIndex); !err.IsNone()) {
+        if (auto err = mOCISpec->LoadImageManifest(manifestPath, *manifest); !err.IsNone()) {
             continue;
         }
 
-        for (const auto& manifestDescriptor : imageIndex->mManifests) {
-            if (manifestDescriptor.mDigest == blobDigest) {
-                return true;
-            }
-
-            StaticString<cFilePathLen> manifestPath;
-            if (auto err = GetBlobFilePath(mBlobsInstallPath, manifestDescriptor.mDigest, manifestPath);
-                !err.IsNone()) {
-                continue;
-            }
-
-            auto manifest = MakeUnique<oci::ImageManifest>(&mAllocator);
-            if (!manifest) {
-                continue;
-            }
-
-            if (auto err = mOCISpec->LoadImageManifest(manifestPath, *manifest); !err.IsNone()) {
-                continue;
-            }
+        if (manifest->mConfig.mDigest == blobDigest) {
+            return true;
+        }
 
-            if (manifest->mConfig.mDigest == blobDigest) {
-                return true;
-            }
+        if (manifest->mItemConfig.HasValue() && manifest->mItemConfig->mDigest == blobDigest) {
+            return true;
+        }
 
-            if (manifest->mItemConfig.HasValue() && manifest->mItemConfig->mDigest == blobDigest) {
+        for (const auto& layer : manifest->mLayers) {
+            if (layer.mDigest == blobDigest) {
                 return true;
             }
-
-            for (const auto& layer : manifest->mLayers) {
-                if (layer.mDigest == blobDigest) {
-                    return true;
-                }
-            }
         }
     }
 
@@ -1657,15 +1702,6 @@ RetWithError<size_t> ImageManager::CleanupOrphanedBlobs()
 
     size_t totalSize = 0;
 
-    auto storedItems = MakeUnique<StaticArray<ItemInfo, cMaxNumUpdateItems>>(&mAllocator);
-    if (!storedItems) {
-        return {0, AOS_ERROR_WRAP(ErrorEnum::eNoMemory)};
-    }
-
-    if (auto err = mStorage->GetAllItemsInfos(*storedItems); !err.IsNone()) {
-        return {0, AOS_ERROR_WRAP(err)};
-    }
-
     auto algorithmDirIterator = fs::DirIterator(mBlobsInstallPath);
 
     while (algorithmDirIterator.Next()) {
@@ -1680,7 +1716,12 @@ RetWithError<size_t> ImageManager::CleanupOrphanedBlobs()
             StaticString<oci::cDigestLen> blobDigest;
             blobDigest.Append(algorithm).Append(":").Append(hash);
 
-            if (!IsBlobUsedByItems(blobDigest, *storedItems)) {
+            auto [used, usedErr] = IsBlobUsedByItems(blobDigest);
+            if (!usedErr.IsNone()) {
+                return {totalSize, usedErr};
+            }
+
+            if (!used) {
                 auto filePath = fs::JoinPath(algorithmDir, hash);
 
                 auto [blobSize, sizeErr] = fs::CalculateSize(filePath);
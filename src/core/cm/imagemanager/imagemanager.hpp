@@ -171,7 +171,6 @@ private:
     static constexpr auto cBlobsDirName = "blobs";
 
     static constexpr auto cMaxNumListeners    = 1;
-    static constexpr auto cMaxNumItemVersions = 2;
     static constexpr auto cRetryTimeout       = Time::cSeconds * 2;
     static constexpr auto cDigestAlgorithmLen = 16;
 
@@ -186,6 +185,7 @@ private:
     Error ProcessDownloadRequest(const Array<UpdateItemInfo>& itemsInfo, Array<ItemInfo>& storedItems,
         const Array<crypto::CertificateInfo>&      certificates,
         const Array<crypto::CertificateChainInfo>& certificateChains, Array<UpdateItemStatus>& statuses);
+    RetWithError<bool>   IsBlobUsedByItems(const String& blobDigest);
     RetWithError<size_t> CleanupOrphanedBlobs();
     Error RemoveDifferentVersions(const Array<UpdateItemInfo>& itemsInfo, const Array<ItemInfo>& storedItems);
     Error VerifyBlobsIntegrity(
@@ -221,11 +221,11 @@ private:
     Error VerifyItemBlobs(const String& indexDigest);
     Error VerifyBlobIntegrity(const String& digest);
     Error VerifyBlobChecksum(const String& digest, const fs::FileInfo& fileInfo);
-    bool  IsBlobUsedByItems(const String& blobDigest, const Array<ItemInfo>& items);
+    bool  IsBlobUsedByItem(const String& blobDigest, const ItemInfo& item);
     void  NotifyItemsStatusesChanged(const Array<UpdateItemStatus>& statuses);
     void  NotifyItemStatusChanged(const String& itemID, const UpdateItemType& type, const String& version,
          ItemStateEnum state, const Error& error);
-    void  RegisterOutdatedItems(const Array<ItemInfo>& items);
+    Error RegisterOutdatedItems();
     bool  StartAction();
     void  StopAction();
     Error GetBlobFilePath(const String& basePath, const String& digest, StaticString<cFilePathLen>& path) const;
@@ -253,7 +253,7 @@ private:
     ConditionalVariable           mCondVar;
     bool                          mCancel {};
     bool                          mInProgress {};
-    mutable StaticAllocator<(sizeof(StaticArray<ItemInfo, cMaxNumUpdateItems>) * 2) + sizeof(oci::ImageIndex)
+    mutable StaticAllocator<sizeof(StaticArray<ItemInfo, cMaxNumUpdateItems>) + sizeof(oci::ImageIndex)
         + sizeof(oci::ImageManifest) + sizeof(StaticArray<BlobInfo, 1>)
         + sizeof(StaticArray<uint8_t, crypto::cSHA256Size>) + sizeof(BlobInfo)>
         mAllocator;
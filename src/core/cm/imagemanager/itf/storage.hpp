@@ -7,6 +7,7 @@
 #ifndef AOS_CORE_CM_IMAGEMANAGER_ITF_STORAGE_HPP_
 #define AOS_CORE_CM_IMAGEMANAGER_ITF_STORAGE_HPP_
 
+#include <core/common/tools/visitor.hpp>
 #include <core/common/types/common.hpp>
 #include <core/common/types/desiredstatus.hpp>
 
@@ -44,6 +45,30 @@ struct ItemInfo {
     bool operator!=(const ItemInfo& rhs) const { return !operator==(rhs); }
 };
 
+/**
+ * Update item filter: unset fields match any item.
+ */
+struct ItemFilter {
+    Optional<StaticString<cIDLen>> mItemID;
+    Optional<ItemState>            mState;
+
+    /**
+     * Checks if update item info matches filter.
+     *
+     * @param item update item info.
+     * @return bool.
+     */
+    bool Match(const ItemInfo& item) const
+    {
+        return (!mItemID.HasValue() || *mItemID == item.mItemID) && (!mState.HasValue() || *mState == item.mState);
+    }
+};
+
+/**
+ * Update item info visitor interface.
+ */
+using ItemInfoVisitorItf = VisitorItf<ItemInfo>;
+
 /**
  * Storage interface.
  */
@@ -98,6 +123,23 @@ public:
      * @return Error.
      */
     virtual Error GetItemInfos(const String& id, Array<ItemInfo>& items) = 0;
+
+    /**
+     * Visits items info matching filter.
+     *
+     * Items are passed to the visitor one by one, so the caller doesn't need an array for all stored items. The
+     * visitor must not modify the storage. Visiting stops on the first visitor error, which is returned.
+     * The default implementation visits items loaded by GetAllItemsInfos.
+     *
+     * @param filter item filter.
+     * @param visitor item visitor.
+     * @return Error.
+     */
+    virtual Error VisitItemsInfos(const ItemFilter& filter, ItemInfoVisitorItf& visitor)
+    {
+        return VisitLoadedItems<ItemInfo, cMaxNumUpdateItems>(
+            [this](Array<ItemInfo>& items) { return GetAllItemsInfos(items); }, filter, visitor);
+    }
 };
 
 } // namespace aos::cm::imagemanager
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <memory>
 #include <thread>
 
 #include <core/cm/imagemanager/imagemanager.hpp>
@@ -27,6 +28,32 @@ using namespace testing;
 
 namespace aos::cm::imagemanager {
 
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+// Returns storage visit action which visits matching items of the array.
+auto VisitItems(const Array<ItemInfo>& items)
+{
+    return [&items](const ItemFilter& filter, ItemInfoVisitorItf& visitor) -> Error {
+        for (const auto& item : items) {
+            if (!filter.Match(item)) {
+                continue;
+            }
+
+            if (auto err = visitor.Visit(item); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return ErrorEnum::eNone;
+    };
+}
+
+} // namespace
+
 /***********************************************************************************************************************
  * Suite
  **********************************************************************************************************************/
@@ -48,6 +75,7 @@ protected:
         mConfig.mRemoveOutdatedPeriod = Time::cSeconds * 20;
 
         EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).WillRepeatedly(Return(ErrorEnum::eNone));
+        EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillRepeatedly(Return(ErrorEnum::eNone));
 
         EXPECT_TRUE(mImageManager
                         .Init(mConfig, mStorageMock, mBlobInfoProviderMock, mDownloadingSpaceAllocatorMock,
@@ -88,7 +116,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_EmptyList)
     StaticArray<crypto::CertificateChainInfo, 1> certificateChains;
     StaticArray<UpdateItemStatus, 5>             statuses;
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).WillOnce(Return(ErrorEnum::eNone));
 
     auto err = mImageManager.DownloadUpdateItems(itemsInfo, certificates, certificateChains, statuses);
 
@@ -103,7 +131,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_EmptyList_RemovesPendingItems)
     StaticArray<crypto::CertificateChainInfo, 1> certificateChains;
     StaticArray<UpdateItemStatus, 5>             statuses;
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).WillOnce(Invoke([](Array<ItemInfo>& items) {
         ItemInfo pendingItem1;
         pendingItem1.mItemID      = "service1";
         pendingItem1.mType        = UpdateItemTypeEnum::eService;
@@ -187,7 +215,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_Success_NewItem)
     item.mIndexDigest = "sha256:abc123";
     itemsInfo.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(3).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
 
     EXPECT_CALL(mStorageMock, AddItem(_)).WillOnce(Return(ErrorEnum::eNone));
 
@@ -306,7 +334,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_AlreadyInstalled)
     item.mIndexDigest = "sha256:abc123";
     itemsInfo.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(3).WillRepeatedly(Invoke([&](Array<ItemInfo>& items) {
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Invoke([&](Array<ItemInfo>& items) {
         ItemInfo storedItem;
         storedItem.mItemID      = item.mItemID;
         storedItem.mVersion     = item.mVersion;
@@ -413,7 +441,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_BlobsAlreadyExistOnDisk)
     item.mIndexDigest = "sha256:aabb";
     itemsInfo.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(3).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
     EXPECT_CALL(mStorageMock, AddItem(_)).WillOnce(Return(ErrorEnum::eNone));
 
     auto blobsDir = fs::JoinPath(mConfig.mInstallPath, "/blobs/sha256/");
@@ -494,7 +522,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_MultipleItems_Success)
         itemsInfo.PushBack(item);
     }
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(3).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
 
     EXPECT_CALL(mStorageMock, AddItem(_)).Times(3).WillRepeatedly(Return(ErrorEnum::eNone));
 
@@ -709,7 +737,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_RemovesOldPendingVersion)
     item.mIndexDigest = "sha256:abc123";
     itemsInfo.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(3).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
         ItemInfo oldItem;
         oldItem.mItemID      = "service1";
         oldItem.mVersion     = "1.0.0";
@@ -834,7 +862,7 @@ TEST_F(ImageManagerTest, DownloadUpdateItems_RemovesOldFailedVersion)
     item.mIndexDigest = "sha256:abc123";
     itemsInfo.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(3).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(2).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
         ItemInfo oldItem;
         oldItem.mItemID      = "service1";
         oldItem.mVersion     = "1.0.0";
@@ -948,7 +976,7 @@ TEST_F(ImageManagerTest, InstallUpdateItems_Success)
     item.mIndexDigest = "sha256:1111";
     itemsInfo.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(5).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
+    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).Times(4).WillRepeatedly(Invoke([](Array<ItemInfo>& items) {
         ItemInfo storedItem;
         storedItem.mItemID      = "service1";
         storedItem.mVersion     = "1.0.0";
@@ -1059,7 +1087,7 @@ TEST_F(ImageManagerTest, InstallUpdateItems_VerifyBlobsIntegrity_IndexNotFound)
     itemsInfo.PushBack(item);
 
     EXPECT_CALL(mStorageMock, GetAllItemsInfos(_))
-        .Times(5)
+        .Times(4)
         .WillOnce(Invoke([](Array<ItemInfo>& items) {
             ItemInfo storedItem;
             storedItem.mItemID      = "service1";
@@ -1083,7 +1111,6 @@ TEST_F(ImageManagerTest, InstallUpdateItems_VerifyBlobsIntegrity_IndexNotFound)
             return ErrorEnum::eNone;
         }))
         .WillOnce(Invoke([](Array<ItemInfo>&) { return ErrorEnum::eNone; }))
-        .WillOnce(Invoke([](Array<ItemInfo>&) { return ErrorEnum::eNone; }))
         .WillOnce(Invoke([](Array<ItemInfo>&) { return ErrorEnum::eNone; }));
 
     EXPECT_CALL(mFileInfoProviderMock, GetFileInfo(_, _, _)).WillOnce(Return(ErrorEnum::eNotFound));
@@ -1119,7 +1146,7 @@ TEST_F(ImageManagerTest, InstallUpdateItems_RemoveDifferentVersion)
     itemsInfo.PushBack(item);
 
     EXPECT_CALL(mStorageMock, GetAllItemsInfos(_))
-        .Times(5)
+        .Times(4)
         .WillOnce(Invoke([](Array<ItemInfo>& items) {
             ItemInfo oldItem;
             oldItem.mItemID      = "service1";
@@ -1163,8 +1190,7 @@ TEST_F(ImageManagerTest, InstallUpdateItems_RemoveDifferentVersion)
             items.PushBack(newItem);
 
             return ErrorEnum::eNone;
-        }))
-        .WillOnce(Invoke([](Array<ItemInfo>&) { return ErrorEnum::eNone; }));
+        }));
 
     EXPECT_CALL(mStorageMock, RemoveItem(_, _)).WillOnce(Invoke([](const String& id, const String& version) {
         EXPECT_EQ(id, "service1");
@@ -1254,7 +1280,7 @@ TEST_F(ImageManagerTest, InstallUpdateItems_SetItemsToRemoved)
     itemsInfo.PushBack(item);
 
     EXPECT_CALL(mStorageMock, GetAllItemsInfos(_))
-        .Times(5)
+        .Times(4)
         .WillOnce(Invoke([](Array<ItemInfo>& items) {
             ItemInfo item1;
             item1.mItemID      = "service1";
@@ -1323,8 +1349,7 @@ TEST_F(ImageManagerTest, InstallUpdateItems_SetItemsToRemoved)
             items.PushBack(item2);
 
             return ErrorEnum::eNone;
-        }))
-        .WillOnce(Invoke([](Array<ItemInfo>&) { return ErrorEnum::eNone; }));
+        }));
 
     auto blobsDir = fs::JoinPath(mConfig.mInstallPath, "/blobs/sha256/");
     fs::MakeDirAll(blobsDir);
@@ -1413,35 +1438,31 @@ TEST_F(ImageManagerTest, InstallUpdateItems_SetItemsToRemoved)
 
 TEST_F(ImageManagerTest, RemoveItem_Success)
 {
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(Invoke([](const String& id, Array<ItemInfo>& items) {
-        EXPECT_EQ(id, "service1");
-
-        ItemInfo item1;
-        item1.mItemID      = "service1";
-        item1.mVersion     = "1.0.0";
-        item1.mIndexDigest = "sha256:1111";
-        item1.mState       = ItemStateEnum::eRemoved;
-        items.PushBack(item1);
+    StaticArray<ItemInfo, 5> items;
 
-        return ErrorEnum::eNone;
-    }));
+    ItemInfo item1;
+    item1.mItemID      = "service1";
+    item1.mVersion     = "1.0.0";
+    item1.mIndexDigest = "sha256:1111";
+    item1.mState       = ItemStateEnum::eRemoved;
+    items.PushBack(item1);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).WillOnce(Invoke([](Array<ItemInfo>& items) {
-        ItemInfo item2;
-        item2.mItemID      = "service2";
-        item2.mVersion     = "1.0.0";
-        item2.mIndexDigest = "sha256:4444";
-        item2.mState       = ItemStateEnum::eInstalled;
-        items.PushBack(item2);
+    ItemInfo item2;
+    item2.mItemID      = "service2";
+    item2.mVersion     = "1.0.0";
+    item2.mIndexDigest = "sha256:4444";
+    item2.mState       = ItemStateEnum::eInstalled;
+    items.PushBack(item2);
 
-        return ErrorEnum::eNone;
-    }));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillRepeatedly(Invoke(VisitItems(items)));
 
-    EXPECT_CALL(mStorageMock, RemoveItem(_, _)).WillOnce(Invoke([](const String& id, const String& version) {
+    EXPECT_CALL(mStorageMock, RemoveItem(_, _)).WillOnce(Invoke([&items](const String& id, const String& version) {
         EXPECT_EQ(id, "service1");
         EXPECT_EQ(version, "1.0.0");
 
-        return ErrorEnum::eNone;
+        return items.RemoveIf([&](const ItemInfo& item) { return item.mItemID == id && item.mVersion == version; })
+            ? ErrorEnum::eNone
+            : ErrorEnum::eNotFound;
     }));
 
     EXPECT_CALL(mInstallSpaceAllocatorMock, RestoreOutdatedItem(_, _)).WillOnce(Return(ErrorEnum::eNone));
@@ -1600,14 +1621,15 @@ TEST_F(ImageManagerTest, Start_RemovesOutdatedItems)
     item2.mTimestamp   = Time::Now();
     items.PushBack(item2);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_))
-        .WillOnce(DoAll(SetArgReferee<0>(items), Return(ErrorEnum::eNone)))
-        .WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillRepeatedly(Invoke(VisitItems(items)));
 
-    EXPECT_CALL(mStorageMock, RemoveItem(_, _)).WillOnce(Invoke([](const String& id, const String& version) {
+    EXPECT_CALL(mStorageMock, RemoveItem(_, _)).WillOnce(Invoke([&items](const String& id, const String& version) {
         EXPECT_EQ(id, "service1");
         EXPECT_EQ(version, "1.0.0");
-        return ErrorEnum::eNone;
+
+        return items.RemoveIf([&](const ItemInfo& item) { return item.mItemID == id && item.mVersion == version; })
+            ? ErrorEnum::eNone
+            : ErrorEnum::eNotFound;
     }));
 
     ItemStatusListenerMock listener;
@@ -1625,6 +1647,48 @@ TEST_F(ImageManagerTest, Start_RemovesOutdatedItems)
     EXPECT_TRUE(mImageManager.UnsubscribeListener(listener).IsNone());
 }
 
+TEST_F(ImageManagerTest, Start_RemovesOutdatedItemsSkipsFailedItem)
+{
+    StaticArray<ItemInfo, 5> items;
+
+    for (const auto& itemID : {"service1", "service2"}) {
+        ItemInfo item;
+
+        item.mItemID      = itemID;
+        item.mVersion     = "1.0.0";
+        item.mIndexDigest = "sha256:1111";
+        item.mState       = ItemStateEnum::eRemoved;
+        item.mTimestamp   = Time::Now().Add(-(Time::cSeconds * 20));
+
+        items.PushBack(item);
+    }
+
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillRepeatedly(Invoke(VisitItems(items)));
+
+    // Failed item doesn't block removal of other outdated items.
+    EXPECT_CALL(mStorageMock, RemoveItem(String("service1"), _)).WillOnce(Return(ErrorEnum::eFailed));
+    EXPECT_CALL(mStorageMock, RemoveItem(String("service2"), _))
+        .WillOnce(Invoke([&items](const String& id, const String& version) {
+            return items.RemoveIf([&](const ItemInfo& item) { return item.mItemID == id && item.mVersion == version; })
+                ? ErrorEnum::eNone
+                : ErrorEnum::eNotFound;
+        }));
+
+    ItemStatusListenerMock listener;
+    EXPECT_CALL(listener, OnItemRemoved(_)).WillOnce(Invoke([](const String& itemID) {
+        EXPECT_EQ(itemID, "service2");
+    }));
+
+    EXPECT_TRUE(mImageManager.SubscribeListener(listener).IsNone());
+
+    EXPECT_CALL(mInstallSpaceAllocatorMock, RestoreOutdatedItem(_, _)).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mInstallSpaceAllocatorMock, FreeSpace(_)).Times(1);
+
+    EXPECT_TRUE(mImageManager.Start().IsNone());
+    EXPECT_TRUE(mImageManager.Stop().IsNone());
+    EXPECT_TRUE(mImageManager.UnsubscribeListener(listener).IsNone());
+}
+
 TEST_F(ImageManagerTest, GetIndexDigest_Success)
 {
     StaticArray<ItemInfo, 5> items;
@@ -1636,7 +1700,7 @@ TEST_F(ImageManagerTest, GetIndexDigest_Success)
     item.mState       = ItemStateEnum::eRemoved;
     items.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(DoAll(SetArgReferee<1>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
 
     StaticString<oci::cDigestLen> digest;
     auto                          err = mImageManager.GetIndexDigest("service1", "1.0.0", digest);
@@ -1649,7 +1713,7 @@ TEST_F(ImageManagerTest, GetIndexDigest_NotFound)
 {
     StaticArray<ItemInfo, 5> items;
 
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(DoAll(SetArgReferee<1>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
 
     StaticString<oci::cDigestLen> digest;
     auto                          err = mImageManager.GetIndexDigest("nonexistent", "1.0.0", digest);
@@ -1668,7 +1732,7 @@ TEST_F(ImageManagerTest, GetIndexDigest_WrongState)
     item.mState       = ItemStateEnum::eDownloading;
     items.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(DoAll(SetArgReferee<1>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
 
     StaticString<oci::cDigestLen> digest;
     auto                          err = mImageManager.GetIndexDigest("service1", "1.0.0", digest);
@@ -1749,7 +1813,7 @@ TEST_F(ImageManagerTest, GetItemCurrentVersion_PendingPriority)
     pending.mState   = ItemStateEnum::ePending;
     items.PushBack(pending);
 
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(DoAll(SetArgReferee<1>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
 
     StaticString<cVersionLen> version;
     auto                      err = mImageManager.GetItemCurrentVersion("service1", version);
@@ -1768,7 +1832,38 @@ TEST_F(ImageManagerTest, GetItemCurrentVersion_InstalledFallback)
     item.mState   = ItemStateEnum::eInstalled;
     items.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(DoAll(SetArgReferee<1>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
+
+    StaticString<cVersionLen> version;
+    auto                      err = mImageManager.GetItemCurrentVersion("service1", version);
+
+    EXPECT_TRUE(err.IsNone());
+    EXPECT_EQ(version, "1.0.0");
+}
+
+TEST_F(ImageManagerTest, GetItemCurrentVersion_VisitsOnlyRequestedItem)
+{
+    StaticArray<ItemInfo, 5> items;
+
+    ItemInfo other;
+    other.mItemID  = "service2";
+    other.mVersion = "3.0.0";
+    other.mState   = ItemStateEnum::ePending;
+    items.PushBack(other);
+
+    ItemInfo item;
+    item.mItemID  = "service1";
+    item.mVersion = "1.0.0";
+    item.mState   = ItemStateEnum::eInstalled;
+    items.PushBack(item);
+
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _))
+        .WillOnce(Invoke([&items](const ItemFilter& filter, ItemInfoVisitorItf& visitor) {
+            EXPECT_TRUE(filter.mItemID.HasValue());
+            EXPECT_FALSE(filter.mState.HasValue());
+
+            return VisitItems(items)(filter, visitor);
+        }));
 
     StaticString<cVersionLen> version;
     auto                      err = mImageManager.GetItemCurrentVersion("service1", version);
@@ -1787,7 +1882,7 @@ TEST_F(ImageManagerTest, GetItemCurrentVersion_NotFound)
     item.mState   = ItemStateEnum::eRemoved;
     items.PushBack(item);
 
-    EXPECT_CALL(mStorageMock, GetItemInfos(_, _)).WillOnce(DoAll(SetArgReferee<1>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
 
     StaticString<cVersionLen> version;
     auto                      err = mImageManager.GetItemCurrentVersion("service1", version);
@@ -1813,7 +1908,7 @@ TEST_F(ImageManagerTest, GetUpdateItemsStatuses_Success)
     item2.mState   = ItemStateEnum::ePending;
     items.PushBack(item2);
 
-    EXPECT_CALL(mStorageMock, GetAllItemsInfos(_)).WillOnce(DoAll(SetArgReferee<0>(items), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mStorageMock, VisitItemsInfos(_, _)).WillOnce(Invoke(VisitItems(items)));
 
     StaticArray<UpdateItemStatus, 5> statuses;
     auto                             err = mImageManager.GetUpdateItemsStatuses(statuses);
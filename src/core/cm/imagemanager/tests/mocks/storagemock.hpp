@@ -24,6 +24,7 @@ public:
         Error, UpdateItemState, (const String& id, const String& version, ItemState state, Time timestamp), (override));
     MOCK_METHOD(Error, GetAllItemsInfos, (Array<ItemInfo> & items), (override));
     MOCK_METHOD(Error, GetItemInfos, (const String& itemID, Array<ItemInfo>& items), (override));
+    MOCK_METHOD(Error, VisitItemsInfos, (const ItemFilter& filter, ItemInfoVisitorItf& visitor), (override));
 };
 
 } // namespace aos::cm::imagemanager
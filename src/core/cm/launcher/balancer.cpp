@@ -10,13 +10,31 @@
 
 namespace aos::cm::launcher {
 
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+size_t ScaleToCapacity(size_t value, size_t capacity, size_t scale)
+{
+    if (capacity == 0) {
+        return 0;
+    }
+
+    return value * scale / capacity;
+}
+
+} // namespace
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
 
-void Balancer::Init(InstanceManager& instanceManager, ImageInfoProvider& imageInfoProvider, NodeManager& nodeManager,
-    MonitoringProviderItf& monitorProvider, InstanceRunnerItf& runner)
+void Balancer::Init(const Config& config, InstanceManager& instanceManager, ImageInfoProvider& imageInfoProvider,
+    NodeManager& nodeManager, MonitoringProviderItf& monitorProvider, InstanceRunnerItf& runner)
 {
+    mConfig            = config;
     mInstanceManager   = &instanceManager;
     mImageInfoProvider = &imageInfoProvider;
     mNodeManager       = &nodeManager;
@@ -24,12 +42,16 @@ void Balancer::Init(InstanceManager& instanceManager, ImageInfoProvider& imageIn
     mRunner            = &runner;
 }
 
-Error Balancer::RunInstances(UniqueLock<Mutex>& lock, Array<SharedPtr<Instance>>& instances, bool rebalancing)
+Error Balancer::RunInstances(Array<SharedPtr<Instance>>& instances, bool rebalancing, const BalancingChanges* changes)
 {
-    if (auto err = PrepareForBalancing(rebalancing); !err.IsNone()) {
+    if (auto err = PrepareForBalancing(rebalancing, false, changes); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
+    if (changes) {
+        PinUnaffectedInstances(instances, *changes);
+    }
+
     if (rebalancing) {
         if (auto err = PerformPolicyBalancing(instances); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
@@ -46,6 +68,11 @@ Error Balancer::RunInstances(UniqueLock<Mutex>& lock, Array<SharedPtr<Instance>>
         return AOS_ERROR_WRAP(err);
     }
 
+    return ErrorEnum::eNone;
+}
+
+Error Balancer::SendScheduledInstances(UniqueLock<Mutex>& lock)
+{
     if (auto err = mNodeManager->SendScheduledInstances(
             lock, mInstanceManager->GetActiveInstances(), mInstanceManager->GetRunningInstances());
         !err.IsNone()) {
@@ -77,57 +104,163 @@ Error Balancer::LoadSMDataForActiveInstances()
 Error Balancer::PerformNodeBalancing(Array<SharedPtr<Instance>>& instances)
 {
     LOG_DBG() << "Perform node balancing" << Log::Field("numNodes", mNodeManager->GetNodes().Size())
-              << Log::Field("numInstances", instances.Size());
+              << Log::Field("numInstances", instances.Size()) << Log::Field("mode", mConfig.mBalancingMode);
+
+    if (mConfig.mBalancingMode == BalancingModeEnum::eBinPacking) {
+        return PerformBinPackingBalancing(instances);
+    }
 
     for (auto& instance : instances) {
-        const auto& info = instance->GetInfo();
-        const auto& id   = info.mInstanceIdent;
+        BalanceInstance(instance, false);
+    }
+
+    return ErrorEnum::eNone;
+}
 
-        LOG_DBG() << "Perform node balancing" << Log::Field("instance", id);
+Error Balancer::PerformBinPackingBalancing(Array<SharedPtr<Instance>>& instances)
+{
+    auto startTime = Time::Now();
+    auto items     = MakeUnique<BinPackingItems>(&mAllocator);
 
-        if (mInstanceManager->IsScheduled(id, info.mVersion)) {
-            LOG_DBG() << "Instance aready scheduled" << Log::Field("instance", id);
+    for (size_t i = 0; i < instances.Size(); i++) {
+        const auto& info = instances[i]->GetInfo();
 
+        if (mInstanceManager->IsScheduled(info.mInstanceIdent, info.mVersion)) {
             continue;
         }
 
-        auto imageIndex = MakeUnique<oci::ImageIndex>(&mAllocator);
-
-        if (auto err = mImageInfoProvider->GetImageIndex(id.mItemID, info.mVersion, *imageIndex); !err.IsNone()) {
-            LOG_ERR() << "Can't get images" << Log::Field("instance", id) << Log::Field(err);
+        if (auto err = items->PushBack({instances[i], i}); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
 
-            mInstanceManager->ScheduleInstance(instance, AOS_ERROR_WRAP(err));
-            continue;
+        // Instances without demand are placed last and get the scheduling error on the regular path.
+        if (auto err = GetInstanceDemand(mNodeIndex.GetNodes(), items->Back()); !err.IsNone()) {
+            LOG_WRN() << "Can't get instance demand" << Log::Field("instance", info.mInstanceIdent) << Log::Field(err);
         }
+    }
 
-        Error scheduleErr = ErrorEnum::eNotFound;
+    // Keep run request priorities, place the largest and most constrained instances first within the same priority.
+    items->Sort([](const BinPackingItem& left, const BinPackingItem& right) {
+        const auto& leftInfo  = left.mInstance->GetInfo();
+        const auto& rightInfo = right.mInstance->GetInfo();
 
-        for (const auto& manifest : imageIndex->mManifests) {
-            LOG_DBG() << "Try to schedule instance" << Log::Field("instance", id)
-                      << Log::Field("manifest", manifest.mDigest);
+        if (leftInfo.mPriority != rightInfo.mPriority) {
+            return leftInfo.mPriority > rightInfo.mPriority;
+        }
 
-            scheduleErr = ScheduleInstance(instance, manifest);
-            if (scheduleErr.IsNone()) {
-                LOG_DBG() << "Instance scheduled successfully" << Log::Field("nodeID", info.mNodeID);
+        if (left.mNumResources != right.mNumResources) {
+            return left.mNumResources > right.mNumResources;
+        }
 
-                break;
-            }
+        if (left.mDemand != right.mDemand) {
+            return left.mDemand > right.mDemand;
         }
 
-        if (!scheduleErr.IsNone()) {
-            LOG_ERR() << "Can't schedule instance" << Log::Field(scheduleErr);
+        return left.mIndex < right.mIndex;
+    });
 
-            mInstanceManager->ScheduleInstance(instance, scheduleErr);
+    bool bestFit = true;
+
+    for (auto& item : *items) {
+        if (bestFit && mConfig.mBinPackingTimeBudget > 0
+            && Time::Now().Sub(startTime) > mConfig.mBinPackingTimeBudget) {
+            LOG_WRN() << "Bin-packing time budget exceeded, fall back to greedy placement"
+                      << Log::Field("budget", mConfig.mBinPackingTimeBudget);
+
+            bestFit = false;
         }
+
+        BalanceInstance(item.mInstance, bestFit);
     }
 
     return ErrorEnum::eNone;
 }
 
-Error Balancer::ScheduleInstance(SharedPtr<Instance>& instance, const oci::IndexContentDescriptor& imageDescriptor)
+void Balancer::BalanceInstance(SharedPtr<Instance>& instance, bool bestFit)
+{
+    const auto& info = instance->GetInfo();
+    const auto& id   = info.mInstanceIdent;
+
+    LOG_DBG() << "Perform node balancing" << Log::Field("instance", id);
+
+    if (mInstanceManager->IsScheduled(id, info.mVersion)) {
+        LOG_DBG() << "Instance aready scheduled" << Log::Field("instance", id);
+
+        return;
+    }
+
+    auto imageIndex = MakeUnique<oci::ImageIndex>(&mAllocator);
+
+    if (auto err = mImageInfoProvider->GetImageIndex(id.mItemID, info.mVersion, *imageIndex); !err.IsNone()) {
+        LOG_ERR() << "Can't get images" << Log::Field("instance", id) << Log::Field(err);
+
+        mInstanceManager->ScheduleInstance(instance, AOS_ERROR_WRAP(err));
+        return;
+    }
+
+    Error scheduleErr = ErrorEnum::eNotFound;
+
+    for (const auto& manifest : imageIndex->mManifests) {
+        LOG_DBG() << "Try to schedule instance" << Log::Field("instance", id)
+                  << Log::Field("manifest", manifest.mDigest);
+
+        scheduleErr = ScheduleInstance(instance, manifest, bestFit);
+        if (scheduleErr.IsNone()) {
+            LOG_DBG() << "Instance scheduled successfully" << Log::Field("nodeID", info.mNodeID);
+
+            break;
+        }
+    }
+
+    if (!scheduleErr.IsNone()) {
+        LOG_ERR() << "Can't schedule instance" << Log::Field(scheduleErr);
+
+        mInstanceManager->ScheduleInstance(instance, scheduleErr);
+    }
+}
+
+Error Balancer::GetInstanceDemand(const Array<Node*>& nodes, BinPackingItem& item)
 {
-    auto nodes = MakeUnique<StaticArray<Node*, cMaxNumNodes>>(&mAllocator);
+    auto&       instance = *item.mInstance;
+    const auto& info     = instance.GetInfo();
+
+    auto imageIndex = MakeUnique<oci::ImageIndex>(&mAllocator);
+
+    if (auto err = mImageInfoProvider->GetImageIndex(info.mInstanceIdent.mItemID, info.mVersion, *imageIndex);
+        !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (imageIndex->mManifests.IsEmpty()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no image manifests"));
+    }
 
+    auto releaseConfigs = DeferRelease(reinterpret_cast<int*>(1), [&](int*) { instance.ResetConfigs(); });
+
+    if (auto err = instance.LoadConfigs(imageIndex->mManifests.Front()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    item.mNumResources = instance.GetNumRequestedResources();
+
+    // Demand is the largest share of node CPU and RAM capacity the instance occupies on any connected node.
+    for (const auto node : nodes) {
+        const auto& config = node->GetConfig();
+
+        auto reqCPU = instance.GetRequestedCPU(config, node->NeedBalancing());
+        auto reqRAM = instance.GetRequestedRAM(config, node->NeedBalancing());
+        auto demand = ScaleToCapacity(reqCPU, node->GetInfo().mMaxDMIPS, cDemandScale)
+            + ScaleToCapacity(reqRAM, node->GetInfo().mTotalRAM, cDemandScale);
+
+        item.mDemand = Max(item.mDemand, demand);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error Balancer::ScheduleInstance(
+    SharedPtr<Instance>& instance, const oci::IndexContentDescriptor& imageDescriptor, bool bestFit)
+{
     auto releaseConfigs = DeferRelease(reinterpret_cast<int*>(1), [&](int*) { instance->ResetConfigs(); });
 
     if (auto err = instance->LoadConfigs(imageDescriptor); !err.IsNone()) {
@@ -135,251 +268,228 @@ Error Balancer::ScheduleInstance(SharedPtr<Instance>& instance, const oci::Index
     }
 
     // Select node runtimes
-    if (auto err = mNodeManager->GetConnectedNodes(*nodes); !err.IsNone()) {
-        return AOS_ERROR_WRAP(Error(err, "get connected nodes failed"));
-    }
+    auto entries = mNodeIndex.GetAll();
 
-    if (auto err = SelectNodes(*instance, *nodes); !err.IsNone()) {
+    if (auto err = SelectNodes(*instance, entries); !err.IsNone()) {
         return AOS_ERROR_WRAP(Error(err, "can't find node for instance"));
     }
 
-    auto [nodeRuntime, selectErr] = SelectRuntime(*instance, *nodes);
+    auto [entry, selectErr] = SelectRuntime(*instance, entries, bestFit);
     if (!selectErr.IsNone()) {
         return AOS_ERROR_WRAP(Error(selectErr, "can't find runtime for instance"));
     }
 
     // Schedule instance
-    auto&       node    = nodeRuntime.mFirst;
-    const auto& runtime = nodeRuntime.mSecond;
-
-    if (auto err = mInstanceManager->ScheduleInstance(instance, *node, runtime->mRuntimeID); !err.IsNone()) {
+    if (auto err = mInstanceManager->ScheduleInstance(instance, *entry.mNode, entry.mRuntime->mRuntimeID);
+        !err.IsNone()) {
         return AOS_ERROR_WRAP(Error(err, "can't schedule instance"));
     }
 
     return ErrorEnum::eNone;
 }
 
-Error Balancer::SelectNodes(Instance& instance, Array<Node*>& nodes)
+Error Balancer::SelectNodes(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    FilterNodesByID(instance, nodes);
-    if (nodes.IsEmpty()) {
+    FilterNodesByID(instance, entries);
+    if (entries.IsEmpty()) {
         return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no nodes with given ID"));
     }
 
-    FilterNodesByLabels(instance, nodes);
-    if (nodes.IsEmpty()) {
+    FilterNodesByLabels(instance, entries);
+    if (entries.IsEmpty()) {
         return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no nodes with instance labels"));
     }
 
-    FilterNodesByResources(instance, nodes);
-    if (nodes.IsEmpty()) {
+    FilterNodesByResources(instance, entries);
+    if (entries.IsEmpty()) {
         return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no nodes with with service resources"));
     }
 
     return ErrorEnum::eNone;
 }
 
-void Balancer::FilterNodesByID(Instance& instance, Array<Node*>& nodes)
+void Balancer::FilterNodesByID(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    nodes.RemoveIf([&instance](const Node* node) { return !instance.IsNodeIDOk(node->GetInfo().mNodeID); });
+    mNodeIndex.FilterNodes(
+        entries, [&instance](const Node& node) { return instance.IsNodeIDOk(node.GetInfo().mNodeID); });
 }
 
-void Balancer::FilterNodesByLabels(Instance& instance, Array<Node*>& nodes)
+void Balancer::FilterNodesByLabels(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    nodes.RemoveIf([&instance](const Node* node) { return !instance.AreNodeLabelsOk(node->GetConfig().mLabels); });
+    mNodeIndex.FilterLabels(
+        entries, [&instance](const LabelsArray& labels) { return instance.AreNodeLabelsOk(labels); });
 }
 
-void Balancer::FilterNodesByResources(Instance& instance, Array<Node*>& nodes)
+void Balancer::FilterNodesByResources(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    nodes.RemoveIf([&instance](const Node* node) { return !instance.AreNodeResourcesOk(*node); });
+    mNodeIndex.FilterNodes(entries, [&instance](const Node& node) { return instance.AreNodeResourcesOk(node); });
 }
 
-RetWithError<Pair<Node*, const RuntimeInfo*>> Balancer::SelectRuntime(Instance& instance, Array<Node*>& nodes)
+RetWithError<NodeIndex::Entry> Balancer::SelectRuntime(
+    Instance& instance, NodeIndex::EntrySet& entries, bool bestFit)
 {
-    auto nodeRuntimes = MakeUnique<NodeRuntimes>(&mAllocator);
-
-    if (auto err = CreateRuntimes(nodes, *nodeRuntimes); !err.IsNone()) {
-        return {nullptr, AOS_ERROR_WRAP(err)};
+    FilterByRuntimeType(instance, entries);
+    if (entries.IsEmpty()) {
+        return {{}, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested runtime type"))};
     }
 
-    FilterByRuntimeType(instance, *nodeRuntimes);
-    if (nodeRuntimes->IsEmpty()) {
-        return {nullptr, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested runtime type"))};
+    FilterByPlatform(instance, entries);
+    if (entries.IsEmpty()) {
+        return {{}, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested platform"))};
     }
 
-    FilterByPlatform(instance, *nodeRuntimes);
-    if (nodeRuntimes->IsEmpty()) {
-        return {nullptr, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested platform"))};
+    FilterByCPU(instance, entries);
+    if (entries.IsEmpty()) {
+        return {{}, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested CPU"))};
     }
 
-    FilterByCPU(instance, *nodeRuntimes);
-    if (nodeRuntimes->IsEmpty()) {
-        return {nullptr, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested CPU"))};
+    FilterByRAM(instance, entries);
+    if (entries.IsEmpty()) {
+        return {{}, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested RAM"))};
     }
 
-    FilterByRAM(instance, *nodeRuntimes);
-    if (nodeRuntimes->IsEmpty()) {
-        return {nullptr, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested RAM"))};
+    FilterByNumInstances(entries);
+    if (entries.IsEmpty()) {
+        return {{}, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested RAM"))};
     }
 
-    FilterByNumInstances(*nodeRuntimes);
-    if (nodeRuntimes->IsEmpty()) {
-        return {nullptr, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no runtimes with requested RAM"))};
-    }
-
-    FilterTopPriorityNodes(*nodeRuntimes);
-    if (nodeRuntimes->IsEmpty()) {
-        return {nullptr, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "failed top priority nodes filtering"))};
+    FilterTopPriorityNodes(entries);
+    if (entries.IsEmpty()) {
+        return {{}, AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "failed top priority nodes filtering"))};
     }
 
     // Select best node.
-    using NodeRuntimesItem = NodeRuntimes::ValueType;
-
-    auto nodeCmp = [](const NodeRuntimesItem& left, const NodeRuntimesItem& right) {
-        if (left.mFirst->GetConfig().mPriority != right.mFirst->GetConfig().mPriority) {
-            return left.mFirst->GetConfig().mPriority > right.mFirst->GetConfig().mPriority;
+    auto nodeCmp = [](Node& left, Node& right) {
+        if (left.GetConfig().mPriority != right.GetConfig().mPriority) {
+            return left.GetConfig().mPriority > right.GetConfig().mPriority;
         }
 
-        if (left.mFirst->GetAvailableCPU() != right.mFirst->GetAvailableCPU()) {
-            return left.mFirst->GetAvailableCPU() > right.mFirst->GetAvailableCPU();
+        if (left.GetAvailableCPU() != right.GetAvailableCPU()) {
+            return left.GetAvailableCPU() > right.GetAvailableCPU();
         }
 
-        if (left.mFirst->GetAvailableRAM() != right.mFirst->GetAvailableRAM()) {
-            return left.mFirst->GetAvailableRAM() > right.mFirst->GetAvailableRAM();
+        if (left.GetAvailableRAM() != right.GetAvailableRAM()) {
+            return left.GetAvailableRAM() > right.GetAvailableRAM();
         }
 
-        return left.mFirst->GetConfig().mNodeID < right.mFirst->GetConfig().mNodeID;
+        return left.GetConfig().mNodeID < right.GetConfig().mNodeID;
     };
 
-    auto& bestNode = *nodeRuntimes->Min(nodeCmp);
+    // Best fit selects the node with the least free capacity left, so large instances still find room later.
+    auto bestFitCmp = [](Node& left, Node& right) {
+        if (left.GetConfig().mPriority != right.GetConfig().mPriority) {
+            return left.GetConfig().mPriority > right.GetConfig().mPriority;
+        }
 
-    // Select best runtime.
-    auto& bestNodeRuntimes = bestNode.mSecond;
+        auto freeCapacity = [](Node& node) {
+            return ScaleToCapacity(node.GetAvailableCPU(), node.GetInfo().mMaxDMIPS, cDemandScale)
+                + ScaleToCapacity(node.GetAvailableRAM(), node.GetInfo().mTotalRAM, cDemandScale);
+        };
 
-    bestNodeRuntimes.Sort(
-        [](const RuntimeInfo* left, const RuntimeInfo* right) { return left->mRuntimeType < right->mRuntimeType; });
+        if (auto leftFree = freeCapacity(left), rightFree = freeCapacity(right); leftFree != rightFree) {
+            return leftFree < rightFree;
+        }
 
-    // Return result.
-    Pair<Node*, const RuntimeInfo*> result {bestNode.mFirst, bestNodeRuntimes.Front()};
+        return left.GetConfig().mNodeID < right.GetConfig().mNodeID;
+    };
 
-    return {result, ErrorEnum::eNone};
-}
+    const auto& indexEntries = mNodeIndex.GetEntries();
+    Node*       bestNode     = nullptr;
 
-Error Balancer::CreateRuntimes(Array<Node*>& nodes, NodeRuntimes& runtimes)
-{
-    for (auto node : nodes) {
-        if (auto err = runtimes.Emplace(node); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
+    for (size_t i = 0; i < indexEntries.Size(); i++) {
+        auto node = indexEntries[i].mNode;
 
-        auto& nodeRuntimes = runtimes.Find(node)->mSecond;
-
-        for (const auto& nodeRuntime : node->GetInfo().mRuntimes) {
-            if (auto err = nodeRuntimes.PushBack(&nodeRuntime); !err.IsNone()) {
-                return AOS_ERROR_WRAP(err);
-            }
+        if (!entries.Test(i) || node == bestNode) {
+            continue;
         }
 
-        // Remove node with no runtimes
-        if (nodeRuntimes.IsEmpty()) {
-            runtimes.Remove(node);
+        if (!bestNode || (bestFit ? bestFitCmp(*node, *bestNode) : nodeCmp(*node, *bestNode))) {
+            bestNode = node;
         }
     }
 
-    return ErrorEnum::eNone;
-}
+    // Select best runtime.
+    const RuntimeInfo* bestRuntime = nullptr;
 
-template <typename Filter>
-void Balancer::FilterRuntimes(NodeRuntimes& runtimes, Filter& filter)
-{
-    for (auto it = runtimes.begin(); it != runtimes.end();) {
-        auto& node         = it->mFirst;
-        auto& nodeRuntimes = it->mSecond;
-
-        for (auto runtimeIt = nodeRuntimes.begin(); runtimeIt != nodeRuntimes.end();) {
-            if (!filter(node, *runtimeIt)) {
-                runtimeIt = nodeRuntimes.Erase(runtimeIt);
-            } else {
-                runtimeIt++;
-            }
+    for (size_t i = 0; i < indexEntries.Size(); i++) {
+        const auto& entry = indexEntries[i];
+
+        if (!entries.Test(i) || entry.mNode != bestNode) {
+            continue;
         }
 
-        if (nodeRuntimes.IsEmpty()) {
-            it = runtimes.Erase(it);
-        } else {
-            it++;
+        if (!bestRuntime || entry.mRuntime->mRuntimeType < bestRuntime->mRuntimeType) {
+            bestRuntime = entry.mRuntime;
         }
     }
+
+    return {{bestNode, bestRuntime}, ErrorEnum::eNone};
 }
 
-void Balancer::FilterByRuntimeType(Instance& instance, NodeRuntimes& runtimes)
+void Balancer::FilterByRuntimeType(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    auto filter = [&instance](Node* node, const RuntimeInfo* runtime) {
-        (void)node;
+    // Instances with disabled rebalancing are bound to the runtime ID, so they can't be matched by runtime type group.
+    if (instance.GetInfo().mDisableRebalancing) {
+        mNodeIndex.FilterEntries(entries, [&instance](const NodeIndex::Entry& entry) {
+            return instance.IsRuntimeTypeOk(entry.mRuntime->mRuntimeType, entry.mRuntime->mRuntimeID);
+        });
 
-        return instance.IsRuntimeTypeOk(runtime->mRuntimeType, runtime->mRuntimeID);
-    };
+        return;
+    }
 
-    FilterRuntimes(runtimes, filter);
+    mNodeIndex.FilterRuntimeTypes(entries, [&instance](const RuntimeInfo& runtime) {
+        return instance.IsRuntimeTypeOk(runtime.mRuntimeType, runtime.mRuntimeID);
+    });
 }
 
-void Balancer::FilterByPlatform(Instance& instance, NodeRuntimes& runtimes)
+void Balancer::FilterByPlatform(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    auto filter = [&instance](Node* node, const RuntimeInfo* runtime) {
-        (void)node;
-
-        return instance.IsPlatformOk(*runtime);
-    };
-
-    FilterRuntimes(runtimes, filter);
+    mNodeIndex.FilterPlatforms(
+        entries, [&instance](const PlatformInfo& platform) { return instance.IsPlatformOk(platform); });
 }
 
-void Balancer::FilterByCPU(Instance& instance, NodeRuntimes& nodes)
+void Balancer::FilterByCPU(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    auto filter = [&instance](Node* node, const RuntimeInfo* runtime) {
-        auto availCPU = node->GetAvailableCPU(runtime->mRuntimeID);
-
-        return instance.IsAvailableCpuOk(availCPU, node->GetConfig(), node->NeedBalancing());
-    };
+    mNodeIndex.FilterEntries(entries, [&instance](const NodeIndex::Entry& entry) {
+        auto availCPU = entry.mNode->GetAvailableCPU(entry.mRuntime->mRuntimeID);
 
-    FilterRuntimes(nodes, filter);
+        return instance.IsAvailableCpuOk(availCPU, entry.mNode->GetConfig(), entry.mNode->NeedBalancing());
+    });
 }
 
-void Balancer::FilterByRAM(Instance& instance, NodeRuntimes& nodes)
+void Balancer::FilterByRAM(Instance& instance, NodeIndex::EntrySet& entries)
 {
-    auto filter = [&instance](Node* node, const RuntimeInfo* runtime) {
-        auto availRAM = node->GetAvailableRAM(runtime->mRuntimeID);
-
-        return instance.IsAvailableRamOk(availRAM, node->GetConfig(), node->NeedBalancing());
-    };
+    mNodeIndex.FilterEntries(entries, [&instance](const NodeIndex::Entry& entry) {
+        auto availRAM = entry.mNode->GetAvailableRAM(entry.mRuntime->mRuntimeID);
 
-    FilterRuntimes(nodes, filter);
+        return instance.IsAvailableRamOk(availRAM, entry.mNode->GetConfig(), entry.mNode->NeedBalancing());
+    });
 }
 
-void Balancer::FilterByNumInstances(NodeRuntimes& nodes)
+void Balancer::FilterByNumInstances(NodeIndex::EntrySet& entries)
 {
-    auto filter
-        = [](Node* node, const RuntimeInfo* runtime) { return !node->IsMaxNumInstancesReached(runtime->mRuntimeID); };
-
-    FilterRuntimes(nodes, filter);
+    mNodeIndex.FilterEntries(entries, [](const NodeIndex::Entry& entry) {
+        return !entry.mNode->IsMaxNumInstancesReached(entry.mRuntime->mRuntimeID);
+    });
 }
 
-void Balancer::FilterTopPriorityNodes(NodeRuntimes& nodes)
+void Balancer::FilterTopPriorityNodes(NodeIndex::EntrySet& entries)
 {
-    if (nodes.IsEmpty()) {
+    if (entries.IsEmpty()) {
         return;
     }
 
-    using NodeRuntimes = Pair<Node*, StaticArray<const RuntimeInfo*, cMaxNumNodeRuntimes>>;
-
-    auto topPriorityNode = nodes.Min([](const NodeRuntimes& left, const NodeRuntimes& right) {
-        return left.mFirst->GetConfig().mPriority > right.mFirst->GetConfig().mPriority;
-    });
+    const auto& indexEntries = mNodeIndex.GetEntries();
+    uint64_t    topPriority  = 0;
 
-    auto topPriority = topPriorityNode->mFirst->GetConfig().mPriority;
+    for (size_t i = 0; i < indexEntries.Size(); i++) {
+        if (entries.Test(i)) {
+            topPriority = Max(topPriority, indexEntries[i].mNode->GetConfig().mPriority);
+        }
+    }
 
-    nodes.RemoveIf(
-        [topPriority](const NodeRuntimes& item) { return item.mFirst->GetConfig().mPriority != topPriority; });
+    mNodeIndex.FilterEntries(entries,
+        [topPriority](const NodeIndex::Entry& entry) { return entry.mNode->GetConfig().mPriority == topPriority; });
 }
 
 Error Balancer::PerformPolicyBalancing(Array<SharedPtr<Instance>>& instances)
@@ -391,6 +501,10 @@ Error Balancer::PerformPolicyBalancing(Array<SharedPtr<Instance>>& instances)
         const auto& id      = info.mInstanceIdent;
         const auto& version = info.mVersion;
 
+        if (mInstanceManager->IsScheduled(id, version)) {
+            continue;
+        }
+
         // Check for running instance
         bool isInstanceRunning
             = !info.mManifestDigest.IsEmpty() && !info.mNodeID.IsEmpty() && !info.mRuntimeID.IsEmpty();
@@ -454,11 +568,78 @@ Error Balancer::PerformPolicyBalancing(Array<SharedPtr<Instance>>& instances)
     return ErrorEnum::eNone;
 }
 
-Error Balancer::UpdateMonitoringData(bool isInitialUpdate)
+void Balancer::PinUnaffectedInstances(Array<SharedPtr<Instance>>& instances, const BalancingChanges& changes)
+{
+    LOG_DBG() << "Pin unaffected instances" << Log::Field("numChangedNodes", changes.mNodeIDs.Size())
+              << Log::Field("numChangedItems", changes.mItemIDs.Size());
+
+    size_t numPinned = 0;
+
+    for (auto& instance : instances) {
+        if (auto err = PinInstance(instance, changes); !err.IsNone()) {
+            if (!err.Is(ErrorEnum::eNotFound)) {
+                LOG_WRN() << "Can't pin instance" << Log::Field("instance", instance->GetInfo().mInstanceIdent)
+                          << Log::Field(err);
+            }
+
+            continue;
+        }
+
+        numPinned++;
+    }
+
+    LOG_DBG() << "Instances pinned" << Log::Field("numPinned", numPinned)
+              << Log::Field("numAffected", instances.Size() - numPinned);
+}
+
+Error Balancer::PinInstance(SharedPtr<Instance>& instance, const BalancingChanges& changes)
+{
+    const auto& info = instance->GetInfo();
+
+    // Not running, failed or changed instances as well as instances on changed nodes are scheduled as usual.
+    if (info.mManifestDigest.IsEmpty() || info.mNodeID.IsEmpty() || info.mRuntimeID.IsEmpty()
+        || !instance->GetStatus().mError.IsNone() || changes.mItemIDs.Contains(info.mInstanceIdent.mItemID)
+        || changes.mNodeIDs.Contains(info.mNodeID)
+        || mInstanceManager->IsScheduled(info.mInstanceIdent, info.mVersion)) {
+        return ErrorEnum::eNotFound;
+    }
+
+    auto node = mNodeManager->FindNode(info.mNodeID);
+    if (!node || !node->IsConnected()) {
+        return ErrorEnum::eNotFound;
+    }
+
+    // Configs are loaded once per manifest: instance is scheduled on the manifest it is running, so config values kept
+    // from the previous balancing are still valid.
+    if (!instance->HasScheduleConfig(info.mManifestDigest)) {
+        auto imageDescriptor = MakeUnique<oci::IndexContentDescriptor>(&mAllocator);
+
+        imageDescriptor->mDigest = info.mManifestDigest;
+
+        if (auto err = instance->LoadConfigs(*imageDescriptor); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        instance->ResetConfigs();
+    }
+
+    if (auto err = mInstanceManager->ScheduleInstance(instance, *node, info.mRuntimeID); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error Balancer::UpdateMonitoringData(bool isInitialUpdate, const BalancingChanges* changes)
 {
     for (auto& node : mNodeManager->GetNodes()) {
         const auto& nodeID = node.GetInfo().mNodeID;
 
+        // On incremental balancing, unchanged nodes keep the last monitoring data.
+        if (changes && !changes->mNodeIDs.Contains(nodeID)) {
+            continue;
+        }
+
         auto nodeMonitoring = MakeUnique<monitoring::NodeMonitoringData>(&mAllocator);
 
         // Monitoring data immediately after startup is not availble.
@@ -476,9 +657,9 @@ Error Balancer::UpdateMonitoringData(bool isInitialUpdate)
     return ErrorEnum::eNone;
 }
 
-Error Balancer::PrepareForBalancing(bool rebalancing, bool isInitialUpdate)
+Error Balancer::PrepareForBalancing(bool rebalancing, bool isInitialUpdate, const BalancingChanges* changes)
 {
-    if (auto err = UpdateMonitoringData(isInitialUpdate); !err.IsNone()) {
+    if (auto err = UpdateMonitoringData(isInitialUpdate, changes); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
@@ -490,6 +671,10 @@ Error Balancer::PrepareForBalancing(bool rebalancing, bool isInitialUpdate)
         return AOS_ERROR_WRAP(err);
     }
 
+    if (auto err = mNodeIndex.Build(*mNodeManager); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     return ErrorEnum::eNone;
 }
 
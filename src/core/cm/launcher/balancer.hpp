@@ -11,8 +11,10 @@
 #include "itf/launcher.hpp"
 #include "itf/monitoringprovider.hpp"
 
+#include "config.hpp"
 #include "imageinfoprovider.hpp"
 #include "instancemanager.hpp"
+#include "nodeindex.hpp"
 #include "nodemanager.hpp"
 
 namespace aos::cm::launcher {
@@ -21,6 +23,23 @@ namespace aos::cm::launcher {
  *  @{
  */
 
+/**
+ * Changes that limit incremental balancing to the affected instances.
+ */
+struct BalancingChanges {
+    StaticArray<StaticString<cIDLen>, cMaxNumNodes>     mNodeIDs;
+    StaticArray<StaticString<cIDLen>, cMaxNumInstances> mItemIDs;
+
+    /**
+     * Clears changes.
+     */
+    void Clear()
+    {
+        mNodeIDs.Clear();
+        mItemIDs.Clear();
+    }
+};
+
 /**
  * Balances run instances.
  */
@@ -29,23 +48,39 @@ public:
     /**
      * Initializes runner with required managers and providers.
      *
+     * @param config launcher configuration.
      * @param instanceManager instance manager.
      * @param imageInfoProvider image info provider.
      * @param nodeManager node manager.
      * @param monitorProvider monitoring provider.
      * @param runner instance runner interface.
      */
-    void Init(InstanceManager& instanceManager, ImageInfoProvider& imageInfoProvider, NodeManager& nodeManager,
-        MonitoringProviderItf& monitorProvider, InstanceRunnerItf& runner);
+    void Init(const Config& config, InstanceManager& instanceManager, ImageInfoProvider& imageInfoProvider,
+        NodeManager& nodeManager, MonitoringProviderItf& monitorProvider, InstanceRunnerItf& runner);
 
     /**
      * Runs instances.
      *
-     * @param lock lock on the balancing mutex.
+     * Schedules instances and submits them to the instance manager. Scheduled instances are sent to nodes by
+     * SendScheduledInstances, so the caller may persist the scheduling result before.
+     *
+     * If changes are provided, instances which are not affected by them stay on their current node and runtime, and
+     * only the affected ones are scheduled.
+     *
      * @param rebalancing flag indicating rebalancing.
+     * @param changes changes for incremental balancing, nullptr for full balancing.
      * @return Error.
      */
-    Error RunInstances(UniqueLock<Mutex>& lock, Array<SharedPtr<Instance>>& instances, bool rebalancing);
+    Error RunInstances(
+        Array<SharedPtr<Instance>>& instances, bool rebalancing, const BalancingChanges* changes = nullptr);
+
+    /**
+     * Sends scheduled instances to nodes.
+     *
+     * @param lock lock on the balancing mutex.
+     * @return Error.
+     */
+    Error SendScheduledInstances(UniqueLock<Mutex>& lock);
 
     /**
      * Loads Service Manager (SM) data for active instances that were loaded from storage.
@@ -55,49 +90,64 @@ public:
     Error LoadSMDataForActiveInstances();
 
 private:
-    using NodeRuntimes = StaticMap<Node*, StaticArray<const RuntimeInfo*, cMaxNumNodeRuntimes>, cMaxNumInstances>;
+    struct BinPackingItem {
+        SharedPtr<Instance> mInstance;
+        size_t              mIndex {};
+        size_t              mDemand {};
+        size_t              mNumResources {};
+    };
+
+    using BinPackingItems = StaticArray<BinPackingItem, cMaxNumInstances>;
 
-    static constexpr size_t cScheduleInstanceSize
-        = sizeof(oci::ImageIndex) + sizeof(StaticArray<Node*, cMaxNumNodes>) + sizeof(NodeRuntimes);
+    static constexpr size_t cDemandScale = 1000;
+
+    static constexpr size_t cScheduleInstanceSize = sizeof(oci::ImageIndex);
+    static constexpr size_t cBinPackingSize      = sizeof(BinPackingItems) + cScheduleInstanceSize;
     static constexpr size_t cPolicyBalancingSize = sizeof(oci::ImageIndex);
+    static constexpr size_t cPinInstanceSize     = sizeof(oci::IndexContentDescriptor);
     static constexpr size_t cMonitoringSize      = sizeof(monitoring::NodeMonitoringData);
 
-    static constexpr size_t cAllocatorSize = Max(cScheduleInstanceSize, cPolicyBalancingSize, cMonitoringSize);
+    static constexpr size_t cAllocatorSize
+        = Max(cScheduleInstanceSize, cBinPackingSize, cPolicyBalancingSize, cPinInstanceSize, cMonitoringSize);
 
     Error PerformNodeBalancing(Array<SharedPtr<Instance>>& instances);
+    Error PerformBinPackingBalancing(Array<SharedPtr<Instance>>& instances);
+    void  BalanceInstance(SharedPtr<Instance>& instance, bool bestFit);
+    Error GetInstanceDemand(const Array<Node*>& nodes, BinPackingItem& item);
 
-    Error ScheduleInstance(SharedPtr<Instance>& instance, const oci::IndexContentDescriptor& imageDescriptor);
+    Error ScheduleInstance(
+        SharedPtr<Instance>& instance, const oci::IndexContentDescriptor& imageDescriptor, bool bestFit);
 
     // Selects nodes
-    Error SelectNodes(Instance& instance, Array<Node*>& nodes);
-    void  FilterNodesByID(Instance& instance, Array<Node*>& nodes);
-    void  FilterNodesByLabels(Instance& instance, Array<Node*>& nodes);
-    void  FilterNodesByResources(Instance& instance, Array<Node*>& nodes);
+    Error SelectNodes(Instance& instance, NodeIndex::EntrySet& entries);
+    void  FilterNodesByID(Instance& instance, NodeIndex::EntrySet& entries);
+    void  FilterNodesByLabels(Instance& instance, NodeIndex::EntrySet& entries);
+    void  FilterNodesByResources(Instance& instance, NodeIndex::EntrySet& entries);
 
     // Selects runtime
-    RetWithError<Pair<Node*, const RuntimeInfo*>> SelectRuntime(Instance& instance, Array<Node*>& nodes);
-
-    Error CreateRuntimes(Array<Node*>& nodes, NodeRuntimes& runtimes);
+    RetWithError<NodeIndex::Entry> SelectRuntime(Instance& instance, NodeIndex::EntrySet& entries, bool bestFit);
 
-    template <typename Filter>
-    void FilterRuntimes(NodeRuntimes& runtimes, Filter& filter);
-    void FilterByRuntimeType(Instance& instance, NodeRuntimes& runtimes);
-    void FilterByPlatform(Instance& instance, NodeRuntimes& runtimes);
-    void FilterByCPU(Instance& instance, NodeRuntimes& runtimes);
-    void FilterByRAM(Instance& instance, NodeRuntimes& runtimes);
-    void FilterByNumInstances(NodeRuntimes& runtimes);
-    void FilterTopPriorityNodes(NodeRuntimes& nodes);
+    void FilterByRuntimeType(Instance& instance, NodeIndex::EntrySet& entries);
+    void FilterByPlatform(Instance& instance, NodeIndex::EntrySet& entries);
+    void FilterByCPU(Instance& instance, NodeIndex::EntrySet& entries);
+    void FilterByRAM(Instance& instance, NodeIndex::EntrySet& entries);
+    void FilterByNumInstances(NodeIndex::EntrySet& entries);
+    void FilterTopPriorityNodes(NodeIndex::EntrySet& entries);
 
     Error PerformPolicyBalancing(Array<SharedPtr<Instance>>& instances);
-    Error PrepareForBalancing(bool rebalancing, bool isInitialUpdate = false);
-    Error UpdateMonitoringData(bool isInitialUpdate = false);
+    void  PinUnaffectedInstances(Array<SharedPtr<Instance>>& instances, const BalancingChanges& changes);
+    Error PinInstance(SharedPtr<Instance>& instance, const BalancingChanges& changes);
+    Error PrepareForBalancing(bool rebalancing, bool isInitialUpdate = false, const BalancingChanges* changes = nullptr);
+    Error UpdateMonitoringData(bool isInitialUpdate = false, const BalancingChanges* changes = nullptr);
 
+    Config                 mConfig;
     ImageInfoProvider*     mImageInfoProvider {};
     InstanceManager*       mInstanceManager {};
     NodeManager*           mNodeManager {};
     MonitoringProviderItf* mMonitorProvider {};
     InstanceRunnerItf*     mRunner {};
     SubjectArray           mSubjects;
+    NodeIndex              mNodeIndex;
 
     StaticAllocator<cAllocatorSize> mAllocator;
 };
@@ -1,4 +1,3 @@
-
 /*
  * Copyright (C) 2025 EPAM Systems, Inc.
  *
@@ -8,17 +7,45 @@
 #ifndef AOS_CORE_CM_LAUNCHER_CONFIG_HPP_
 #define AOS_CORE_CM_LAUNCHER_CONFIG_HPP_
 
+#include <core/common/tools/enum.hpp>
 #include <core/common/tools/time.hpp>
 
 namespace aos::cm::launcher {
 
+/**
+ * Balancing mode.
+ */
+class BalancingModeType {
+public:
+    enum class Enum {
+        eGreedy,
+        eBinPacking,
+    };
+
+    static const Array<const char* const> GetStrings()
+    {
+        static const char* const sStrings[] = {
+            "greedy",
+            "binPacking",
+        };
+
+        return Array<const char* const>(sStrings, ArraySize(sStrings));
+    };
+};
+
+using BalancingModeEnum = BalancingModeType::Enum;
+using BalancingMode     = EnumStringer<BalancingModeType>;
+
 /**
  * Launcher configuration.
  */
 struct Config {
-    Duration mNodesConnectionTimeout;
-    Duration mInstanceTTL;
-    Duration mCheckOverrideEnvVarsPeriod;
+    Duration      mNodesConnectionTimeout;
+    Duration      mInstanceTTL;
+    Duration      mCheckOverrideEnvVarsPeriod;
+    BalancingMode mBalancingMode {BalancingModeEnum::eGreedy};
+    Duration      mBinPackingTimeBudget {};
+    bool          mIncrementalBalancing {};
 };
 
 } // namespace aos::cm::launcher
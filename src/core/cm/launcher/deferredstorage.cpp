@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "deferredstorage.hpp"
+
+#include <core/common/tools/logger.hpp>
+
+namespace aos::cm::launcher {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void DeferredStorage::Init(StorageItf& storage)
+{
+    LockGuard lock {mMutex};
+
+    mStorage  = &storage;
+    mDeferred = false;
+
+    mChanges.Clear();
+}
+
+void DeferredStorage::Defer()
+{
+    LockGuard lock {mMutex};
+
+    mDeferred = true;
+}
+
+Error DeferredStorage::Flush()
+{
+    LockGuard lock {mMutex};
+
+    mDeferred = false;
+
+    return WriteChanges();
+}
+
+Error DeferredStorage::AddInstance(const InstanceInfo& info)
+{
+    LockGuard lock {mMutex};
+
+    if (!mDeferred) {
+        return mStorage->AddInstance(info);
+    }
+
+    return AddChange(Operation::eAdd, info.mInstanceIdent, info.mVersion, &info);
+}
+
+Error DeferredStorage::UpdateInstance(const InstanceInfo& info)
+{
+    LockGuard lock {mMutex};
+
+    if (!mDeferred) {
+        return mStorage->UpdateInstance(info);
+    }
+
+    return AddChange(Operation::eUpdate, info.mInstanceIdent, info.mVersion, &info);
+}
+
+Error DeferredStorage::RemoveInstance(const InstanceIdent& instanceID, const String& version)
+{
+    LockGuard lock {mMutex};
+
+    if (!mDeferred) {
+        return mStorage->RemoveInstance(instanceID, version);
+    }
+
+    return AddChange(Operation::eRemove, instanceID, version, nullptr);
+}
+
+Error DeferredStorage::LoadActiveInstances(Array<InstanceInfo>& instances) const
+{
+    return mStorage->LoadActiveInstances(instances);
+}
+
+Error DeferredStorage::VisitInstances(const InstanceFilter& filter, InstanceInfoVisitorItf& visitor) const
+{
+    return mStorage->VisitInstances(filter, visitor);
+}
+
+Error DeferredStorage::LoadOverrideEnvVars(OverrideEnvVarsRequest& envVars) const
+{
+    return mStorage->LoadOverrideEnvVars(envVars);
+}
+
+Error DeferredStorage::SaveOverrideEnvVars(const OverrideEnvVarsRequest& envVars)
+{
+    return mStorage->SaveOverrideEnvVars(envVars);
+}
+
+Error DeferredStorage::LoadRunRequests(Array<RunInstanceRequest>& requests) const
+{
+    return mStorage->LoadRunRequests(requests);
+}
+
+Error DeferredStorage::SaveRunRequests(const Array<RunInstanceRequest>& requests)
+{
+    return mStorage->SaveRunRequests(requests);
+}
+
+Error DeferredStorage::BeginTransaction()
+{
+    return mStorage->BeginTransaction();
+}
+
+Error DeferredStorage::CommitTransaction()
+{
+    return mStorage->CommitTransaction();
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+DeferredStorage::Change* DeferredStorage::FindLastChange(const InstanceIdent& instanceID, const String& version)
+{
+    for (auto it = mChanges.end(); it != mChanges.begin();) {
+        it--;
+
+        if (it->mInfo.mInstanceIdent == instanceID && it->mInfo.mVersion == version) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+Error DeferredStorage::AddChange(
+    Operation operation, const InstanceIdent& instanceID, const String& version, const InstanceInfo* info)
+{
+    if (auto change = FindLastChange(instanceID, version); change && change->mOperation != Operation::eRemove) {
+        switch (operation) {
+        case Operation::eUpdate:
+            // Update of not written instance is written with the pending add or update.
+            change->mInfo = *info;
+
+            return ErrorEnum::eNone;
+
+        case Operation::eRemove:
+            // Instance added and removed while deferred is never written.
+            if (change->mOperation == Operation::eAdd) {
+                mChanges.Erase(change);
+            } else {
+                change->mOperation = Operation::eRemove;
+            }
+
+            return ErrorEnum::eNone;
+
+        default:
+            break;
+        }
+    }
+
+    if (mChanges.IsFull()) {
+        LOG_WRN() << "Too many deferred instance changes, write them in advance";
+
+        if (auto err = WriteChanges(); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    if (auto err = mChanges.EmplaceBack(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    auto& change = mChanges.Back();
+
+    change.mOperation = operation;
+
+    if (info) {
+        change.mInfo = *info;
+    } else {
+        change.mInfo                = {};
+        change.mInfo.mInstanceIdent = instanceID;
+        change.mInfo.mVersion       = version;
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error DeferredStorage::WriteChanges()
+{
+    if (mChanges.IsEmpty()) {
+        return ErrorEnum::eNone;
+    }
+
+    LOG_DBG() << "Write deferred instance changes" << Log::Field("count", mChanges.Size());
+
+    Error err;
+
+    auto transactionErr = mStorage->BeginTransaction();
+    if (!transactionErr.IsNone()) {
+        LOG_ERR() << "Failed to begin storage transaction" << Log::Field(AOS_ERROR_WRAP(transactionErr));
+    }
+
+    for (const auto& change : mChanges) {
+        if (auto changeErr = WriteChange(change); !changeErr.IsNone()) {
+            LOG_ERR() << "Failed to write instance change" << Log::Field("instance", change.mInfo.mInstanceIdent)
+                      << Log::Field("version", change.mInfo.mVersion) << Log::Field(changeErr);
+
+            if (err.IsNone()) {
+                err = changeErr;
+            }
+        }
+    }
+
+    mChanges.Clear();
+
+    if (transactionErr.IsNone()) {
+        if (auto commitErr = mStorage->CommitTransaction(); !commitErr.IsNone()) {
+            return AOS_ERROR_WRAP(commitErr);
+        }
+    }
+
+    return err;
+}
+
+Error DeferredStorage::WriteChange(const Change& change)
+{
+    switch (change.mOperation) {
+    case Operation::eAdd:
+        return mStorage->AddInstance(change.mInfo);
+
+    case Operation::eUpdate:
+        return mStorage->UpdateInstance(change.mInfo);
+
+    case Operation::eRemove:
+        return mStorage->RemoveInstance(change.mInfo.mInstanceIdent, change.mInfo.mVersion);
+
+    default:
+        return AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument);
+    }
+}
+
+} // namespace aos::cm::launcher
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_CM_LAUNCHER_DEFERREDSTORAGE_HPP_
+#define AOS_CORE_CM_LAUNCHER_DEFERREDSTORAGE_HPP_
+
+#include <core/common/tools/thread.hpp>
+
+#include "itf/storage.hpp"
+
+namespace aos::cm::launcher {
+
+/**
+ * Deferred storage class wraps StorageItf and collects instance changes made while deferred. Collected changes are
+ * written on Flush within a storage transaction which contains launcher instance changes only: the storage may be
+ * shared with other modules, which write their changes independently.
+ *
+ * Instance changes collected but not flushed yet are not visible to the storage readers.
+ */
+class DeferredStorage : public StorageItf {
+public:
+    /**
+     * Initializes deferred storage.
+     *
+     * @param storage underlying storage.
+     */
+    void Init(StorageItf& storage);
+
+    /**
+     * Starts collecting instance changes.
+     */
+    void Defer();
+
+    /**
+     * Writes collected instance changes within a single storage transaction and stops collecting them.
+     *
+     * @return Error.
+     */
+    Error Flush();
+
+    /**
+     * Adds a new instance to the storage.
+     *
+     * @param info instance information.
+     * @return Error.
+     */
+    Error AddInstance(const InstanceInfo& info) override;
+
+    /**
+     * Updates an existing instance in the storage.
+     *
+     * @param info updated instance information.
+     * @return Error.
+     */
+    Error UpdateInstance(const InstanceInfo& info) override;
+
+    /**
+     * Removes an instance from the storage.
+     *
+     * @param instanceID instance identifier.
+     * @param version instance version.
+     * @return Error.
+     */
+    Error RemoveInstance(const InstanceIdent& instanceID, const String& version) override;
+
+    /**
+     * Loads all active instances from storage.
+     *
+     * @param[out] instances all stored instances.
+     * @return Error.
+     */
+    Error LoadActiveInstances(Array<InstanceInfo>& instances) const override;
+
+    /**
+     * Visits stored instances matching filter.
+     *
+     * @param filter instance filter.
+     * @param visitor instance visitor.
+     * @return Error.
+     */
+    Error VisitInstances(const InstanceFilter& filter, InstanceInfoVisitorItf& visitor) const override;
+
+    /**
+     * Returns override environment variables.
+     *
+     * @param[out] envVars override environment variables.
+     * @return Error.
+     */
+    Error LoadOverrideEnvVars(OverrideEnvVarsRequest& envVars) const override;
+
+    /**
+     * Saves override environment variables.
+     *
+     * @param envVars override environment variables.
+     * @return Error.
+     */
+    Error SaveOverrideEnvVars(const OverrideEnvVarsRequest& envVars) override;
+
+    /**
+     * Loads all run requests from storage.
+     *
+     * @param requests run requests to load.
+     * @return Error.
+     */
+    Error LoadRunRequests(Array<RunInstanceRequest>& requests) const override;
+
+    /**
+     * Saves all run requests to storage.
+     *
+     * @param requests run requests to save.
+     * @return Error.
+     */
+    Error SaveRunRequests(const Array<RunInstanceRequest>& requests) override;
+
+    /**
+     * Begins storage transaction.
+     *
+     * @return Error.
+     */
+    Error BeginTransaction() override;
+
+    /**
+     * Commits storage transaction.
+     *
+     * @return Error.
+     */
+    Error CommitTransaction() override;
+
+private:
+    enum class Operation {
+        eAdd,
+        eUpdate,
+        eRemove,
+    };
+
+    struct Change {
+        Operation    mOperation {};
+        InstanceInfo mInfo;
+    };
+
+    Change* FindLastChange(const InstanceIdent& instanceID, const String& version);
+    Error   AddChange(
+          Operation operation, const InstanceIdent& instanceID, const String& version, const InstanceInfo* info);
+    Error   WriteChanges();
+    Error   WriteChange(const Change& change);
+
+    StorageItf*                           mStorage {};
+    Mutex                                 mMutex;
+    bool                                  mDeferred {};
+    StaticArray<Change, cMaxNumInstances> mChanges;
+};
+
+} // namespace aos::cm::launcher
+
+#endif
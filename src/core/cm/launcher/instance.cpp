@@ -57,6 +57,13 @@ Error Instance::LoadConfigs(const oci::IndexContentDescriptor& imageDescriptor)
 
     mInfo.mManifestDigest = imageDescriptor.mDigest;
 
+    mScheduleConfig.mManifestDigest     = imageDescriptor.mDigest;
+    mScheduleConfig.mSkipResourceLimits = mItemConfig->mSkipResourceLimits;
+    mScheduleConfig.mQuotas             = mItemConfig->mQuotas;
+    mScheduleConfig.mRequestedResources = mItemConfig->mRequestedResources;
+    mScheduleConfig.mResources          = mItemConfig->mResources;
+    mScheduleConfig.mAlertRules         = mItemConfig->mAlertRules;
+
     return ErrorEnum::eNone;
 }
 
@@ -193,6 +200,13 @@ bool Instance::AreNodeLabelsOk(const LabelsArray& nodeLabels)
     return true;
 }
 
+size_t Instance::GetNumRequestedResources() const
+{
+    assert(mItemConfig);
+
+    return mItemConfig->mResources.Size();
+}
+
 RetWithError<bool> Instance::OverrideEnvVars(const OverrideEnvVarsRequest& envVars)
 {
     auto newEnvVars = MakeUnique<EnvVarArray>(&mAllocator);
@@ -334,6 +348,22 @@ bool ComponentInstance::IsAvailableRamOk(size_t availableRAM, const NodeConfig&
     return true;
 }
 
+size_t ComponentInstance::GetRequestedCPU(const NodeConfig& nodeConfig, bool useMonitoringData)
+{
+    (void)nodeConfig;
+    (void)useMonitoringData;
+
+    return 0;
+}
+
+size_t ComponentInstance::GetRequestedRAM(const NodeConfig& nodeConfig, bool useMonitoringData)
+{
+    (void)nodeConfig;
+    (void)useMonitoringData;
+
+    return 0;
+}
+
 bool ComponentInstance::AreNodeResourcesOk(const NodeItf& node)
 {
     (void)node;
@@ -505,8 +535,6 @@ oci::BalancingPolicyEnum ServiceInstance::GetBalancingPolicy()
 
 Error ServiceInstance::Schedule(NodeItf& node, const String& runtimeID)
 {
-    assert(mItemConfig);
-
     auto releaseConfigs = DeferRelease(reinterpret_cast<int*>(1), [&](int*) {
         mItemConfig.Reset();
         mImageConfig.Reset();
@@ -529,8 +557,8 @@ Error ServiceInstance::Schedule(NodeItf& node, const String& runtimeID)
     // mSMInfo.mEnvVars is set in OverrideEnvVars().
 
     mSMInfo.mMonitoringParams.EmplaceValue();
-    if (mItemConfig->mAlertRules.HasValue()) {
-        mSMInfo.mMonitoringParams.GetValue().mAlertRules = mItemConfig->mAlertRules.GetValue();
+    if (mScheduleConfig.mAlertRules.HasValue()) {
+        mSMInfo.mMonitoringParams.GetValue().mAlertRules = mScheduleConfig.mAlertRules.GetValue();
     }
 
     if (auto err = ReserveRuntimeResources(node, runtimeID); !err.IsNone()) {
@@ -546,17 +574,15 @@ Error ServiceInstance::Schedule(NodeItf& node, const String& runtimeID)
 
 size_t ServiceInstance::GetRequestedCPU(const NodeConfig& nodeConfig, bool useMonitoringData)
 {
-    assert(mItemConfig);
-
-    if (mItemConfig->mSkipResourceLimits) {
+    if (mScheduleConfig.mSkipResourceLimits) {
         return 0;
     }
 
     size_t requestedCPU = 0;
-    auto   quota        = mItemConfig->mQuotas.mCPUDMIPSLimit;
+    auto   quota        = mScheduleConfig.mQuotas.mCPUDMIPSLimit;
 
-    if (mItemConfig->mRequestedResources.HasValue() && mItemConfig->mRequestedResources->mCPU.HasValue()) {
-        requestedCPU = ClampResource(*mItemConfig->mRequestedResources->mCPU, quota);
+    if (mScheduleConfig.mRequestedResources.HasValue() && mScheduleConfig.mRequestedResources->mCPU.HasValue()) {
+        requestedCPU = ClampResource(*mScheduleConfig.mRequestedResources->mCPU, quota);
     } else {
         requestedCPU = GetReqCPUFromNodeConfig(quota, nodeConfig.mResourceRatios);
     }
@@ -572,17 +598,15 @@ size_t ServiceInstance::GetRequestedCPU(const NodeConfig& nodeConfig, bool useMo
 
 size_t ServiceInstance::GetRequestedRAM(const NodeConfig& nodeConfig, bool useMonitoringData)
 {
-    assert(mItemConfig);
-
-    if (mItemConfig->mSkipResourceLimits) {
+    if (mScheduleConfig.mSkipResourceLimits) {
         return 0;
     }
 
     size_t requestedRAM = 0;
-    auto   quota        = mItemConfig->mQuotas.mRAMLimit;
+    auto   quota        = mScheduleConfig.mQuotas.mRAMLimit;
 
-    if (mItemConfig->mRequestedResources.HasValue() && mItemConfig->mRequestedResources->mRAM.HasValue()) {
-        requestedRAM = ClampResource(*mItemConfig->mRequestedResources->mRAM, quota);
+    if (mScheduleConfig.mRequestedResources.HasValue() && mScheduleConfig.mRequestedResources->mRAM.HasValue()) {
+        requestedRAM = ClampResource(*mScheduleConfig.mRequestedResources->mRAM, quota);
     } else {
         requestedRAM = GetReqRAMFromNodeConfig(quota, nodeConfig.mResourceRatios);
     }
@@ -599,10 +623,10 @@ size_t ServiceInstance::GetRequestedRAM(const NodeConfig& nodeConfig, bool useMo
 size_t ServiceInstance::GetReqStateSize(const NodeConfig& nodeConfig)
 {
     size_t requestedState = 0;
-    auto   quota          = mItemConfig->mQuotas.mStateLimit;
+    auto   quota          = mScheduleConfig.mQuotas.mStateLimit;
 
-    if (mItemConfig->mRequestedResources.HasValue() && mItemConfig->mRequestedResources->mState.HasValue()) {
-        requestedState = ClampResource(*mItemConfig->mRequestedResources->mState, quota);
+    if (mScheduleConfig.mRequestedResources.HasValue() && mScheduleConfig.mRequestedResources->mState.HasValue()) {
+        requestedState = ClampResource(*mScheduleConfig.mRequestedResources->mState, quota);
     } else {
         requestedState = GetReqStateFromNodeConfig(quota, nodeConfig.mResourceRatios);
     }
@@ -613,10 +637,10 @@ size_t ServiceInstance::GetReqStateSize(const NodeConfig& nodeConfig)
 size_t ServiceInstance::GetReqStorageSize(const NodeConfig& nodeConfig)
 {
     size_t requestedStorage = 0;
-    auto   quota            = mItemConfig->mQuotas.mStorageLimit;
+    auto   quota            = mScheduleConfig.mQuotas.mStorageLimit;
 
-    if (mItemConfig->mRequestedResources.HasValue() && mItemConfig->mRequestedResources->mStorage.HasValue()) {
-        requestedStorage = ClampResource(*mItemConfig->mRequestedResources->mStorage, quota);
+    if (mScheduleConfig.mRequestedResources.HasValue() && mScheduleConfig.mRequestedResources->mStorage.HasValue()) {
+        requestedStorage = ClampResource(*mScheduleConfig.mRequestedResources->mStorage, quota);
     } else {
         requestedStorage = GetReqStorageFromNodeConfig(quota, nodeConfig.mResourceRatios);
     }
@@ -723,15 +747,15 @@ Error ServiceInstance::SetupStateStorage(const NodeConfig& nodeConfig, String& s
     params.mUID = mInfo.mUID;
     params.mGID = mInfo.mGID;
 
-    if (mItemConfig->mQuotas.mStorageLimit.HasValue()) {
-        params.mStorageQuota = *mItemConfig->mQuotas.mStorageLimit;
+    if (mScheduleConfig.mQuotas.mStorageLimit.HasValue()) {
+        params.mStorageQuota = *mScheduleConfig.mQuotas.mStorageLimit;
     }
 
-    if (mItemConfig->mQuotas.mStateLimit.HasValue()) {
-        params.mStateQuota = *mItemConfig->mQuotas.mStateLimit;
+    if (mScheduleConfig.mQuotas.mStateLimit.HasValue()) {
+        params.mStateQuota = *mScheduleConfig.mQuotas.mStateLimit;
     }
 
-    if (mItemConfig->mSkipResourceLimits) {
+    if (mScheduleConfig.mSkipResourceLimits) {
         reqState   = 0;
         reqStorage = 0;
     }
@@ -747,10 +771,10 @@ Error ServiceInstance::SetupStateStorage(const NodeConfig& nodeConfig, String& s
 
 Error ServiceInstance::ReserveRuntimeResources(NodeItf& node, const String& runtimeID)
 {
-    auto requestedCPU = mItemConfig->mSkipResourceLimits ? 0 : GetRequestedCPU(node.GetConfig(), false);
-    auto requestedRAM = mItemConfig->mSkipResourceLimits ? 0 : GetRequestedRAM(node.GetConfig(), false);
+    auto requestedCPU = mScheduleConfig.mSkipResourceLimits ? 0 : GetRequestedCPU(node.GetConfig(), false);
+    auto requestedRAM = mScheduleConfig.mSkipResourceLimits ? 0 : GetRequestedRAM(node.GetConfig(), false);
     Array<oci::ResourceInfo> requestedResources
-        = mItemConfig->mSkipResourceLimits ? Array<oci::ResourceInfo>() : mItemConfig->mResources;
+        = mScheduleConfig.mSkipResourceLimits ? Array<oci::ResourceInfo>() : mScheduleConfig.mResources;
 
     auto reserveErr
         = node.ReserveResources(mInfo.mInstanceIdent, runtimeID, requestedCPU, requestedRAM, requestedResources);
@@ -78,6 +78,8 @@ public:
     /**
      * Loads image and (optionally) service configs for the specified manifest descriptor and caches pointers to them.
      *
+     * Config values required to schedule instance are kept after configs are reset, see HasScheduleConfig.
+     *
      * @param imageDescriptor image descriptor.
      * @return Error.
      */
@@ -88,6 +90,18 @@ public:
      */
     void ResetConfigs();
 
+    /**
+     * Checks whether config values required to schedule instance are kept for the specified manifest, so instance can
+     * be scheduled without loading configs.
+     *
+     * @param manifestDigest manifest digest.
+     * @return bool.
+     */
+    bool HasScheduleConfig(const String& manifestDigest) const
+    {
+        return !manifestDigest.IsEmpty() && mScheduleConfig.mManifestDigest == manifestDigest;
+    }
+
     /**
      * Returns instance information.
      *
@@ -174,6 +188,31 @@ public:
      */
     virtual bool IsAvailableRamOk(size_t availableRAM, const NodeConfig& nodeConfig, bool useMonitoringData) = 0;
 
+    /**
+     * Returns requested CPU.
+     *
+     * @param nodeConfig node configuration.
+     * @param useMonitoringData whether to use monitoring data.
+     * @return size_t.
+     */
+    virtual size_t GetRequestedCPU(const NodeConfig& nodeConfig, bool useMonitoringData) = 0;
+
+    /**
+     * Returns requested RAM.
+     *
+     * @param nodeConfig node configuration.
+     * @param useMonitoringData whether to use monitoring data.
+     * @return size_t.
+     */
+    virtual size_t GetRequestedRAM(const NodeConfig& nodeConfig, bool useMonitoringData) = 0;
+
+    /**
+     * Returns number of requested shared resources.
+     *
+     * @return size_t.
+     */
+    size_t GetNumRequestedResources() const;
+
     /**
      * Checks whether runtime type fits instance requirements.
      *
@@ -254,8 +293,19 @@ protected:
 
     MonitoringData mMonitoringData;
 
+    // Item config values used by Schedule, kept per manifest as full configs are loaded on demand only.
+    struct ScheduleConfig {
+        StaticString<oci::cDigestLen>     mManifestDigest;
+        bool                              mSkipResourceLimits {};
+        oci::ServiceQuotas                mQuotas;
+        Optional<oci::RequestedResources> mRequestedResources;
+        oci::ResourceInfos                mResources;
+        Optional<AlertRules>              mAlertRules;
+    };
+
     UniquePtr<oci::ItemConfig>  mItemConfig;
     UniquePtr<oci::ImageConfig> mImageConfig;
+    ScheduleConfig              mScheduleConfig;
 };
 
 /**
@@ -316,6 +366,24 @@ public:
      */
     bool IsAvailableRamOk(size_t availableRAM, const NodeConfig& nodeConfig, bool useMonitoringData) override;
 
+    /**
+     * Returns requested CPU.
+     *
+     * @param nodeConfig node configuration.
+     * @param useMonitoringData whether to use monitoring data.
+     * @return size_t.
+     */
+    size_t GetRequestedCPU(const NodeConfig& nodeConfig, bool useMonitoringData) override;
+
+    /**
+     * Returns requested RAM.
+     *
+     * @param nodeConfig node configuration.
+     * @param useMonitoringData whether to use monitoring data.
+     * @return size_t.
+     */
+    size_t GetRequestedRAM(const NodeConfig& nodeConfig, bool useMonitoringData) override;
+
     /**
      * Checks whether node resources fit instance requirements.
      *
@@ -401,6 +469,24 @@ public:
      */
     bool IsAvailableRamOk(size_t availableRAM, const NodeConfig& nodeConfig, bool useMonitoringData) override;
 
+    /**
+     * Returns requested CPU.
+     *
+     * @param nodeConfig node configuration.
+     * @param useMonitoringData whether to use monitoring data.
+     * @return size_t.
+     */
+    size_t GetRequestedCPU(const NodeConfig& nodeConfig, bool useMonitoringData) override;
+
+    /**
+     * Returns requested RAM.
+     *
+     * @param nodeConfig node configuration.
+     * @param useMonitoringData whether to use monitoring data.
+     * @return size_t.
+     */
+    size_t GetRequestedRAM(const NodeConfig& nodeConfig, bool useMonitoringData) override;
+
     /**
      * Checks whether node resources fit instance requirements.
      *
@@ -429,8 +515,6 @@ public:
 private:
     static constexpr auto cDefaultResourceRation = 50.0;
 
-    size_t GetRequestedCPU(const NodeConfig& nodeConfig, bool useMonitoringData);
-    size_t GetRequestedRAM(const NodeConfig& nodeConfig, bool useMonitoringData);
     size_t GetReqStateSize(const NodeConfig& nodeConfig);
     size_t GetReqStorageSize(const NodeConfig& nodeConfig);
 
@@ -362,18 +362,15 @@ Error InstanceManager::LoadInstancesFromStorage()
     mActiveInstances.Clear();
     mCachedInstances.Clear();
 
-    auto instances = MakeUnique<StaticArray<InstanceInfo, cMaxNumInstances>>(&mAllocator);
-    if (auto err = mStorage->LoadActiveInstances(*instances); !err.IsNone()) {
+    auto visitor
+        = MakeVisitor<InstanceInfo>([this](const InstanceInfo& info) { return LoadInstanceFromStorage(info); });
+
+    if (auto err = mStorage->VisitInstances({}, visitor); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    LOG_DBG() << "Load active instances" << Log::Field("instances", instances->Size());
-
-    for (const auto& instance : *instances) {
-        if (auto err = LoadInstanceFromStorage(instance); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
-    }
+    LOG_DBG() << "Load stored instances" << Log::Field("active", mActiveInstances.Size())
+              << Log::Field("cached", mCachedInstances.Size());
 
     if (auto err = LoadInstanceStatuses(); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
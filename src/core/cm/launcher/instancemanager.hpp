@@ -260,7 +260,11 @@ public:
 private:
     static constexpr auto cRemovePeriod  = Time::cDay;
     static constexpr auto cAllocatorSize = Max(sizeof(ComponentInstance), sizeof(ServiceInstance)) * cMaxNumInstances
-        + sizeof(InstanceInfo) * cMaxNumInstances + sizeof(InstanceInfo) + sizeof(oci::ImageIndex);
+        + sizeof(InstanceInfo) + sizeof(oci::ImageIndex);
+
+    // Instances plus instance info and image index allocated on top of them.
+    static constexpr auto cNumAllocations = cMaxNumInstances + 2;
+
     static constexpr auto cInstanceAllocatorSize = sizeof(oci::ImageConfig) + sizeof(oci::ItemConfig)
         + sizeof(InstanceStatus) + sizeof(oci::ImageIndex) + sizeof(EnvVarArray);
 
@@ -304,8 +308,8 @@ private:
     Timer mCleanInstancesTimer;
     Timer mInitTimer;
 
-    StaticAllocator<cAllocatorSize, cMaxNumInstances> mAllocator;
-    StaticAllocator<cInstanceAllocatorSize>           mInstanceAllocator;
+    StaticAllocator<cAllocatorSize, cNumAllocations> mAllocator;
+    StaticAllocator<cInstanceAllocatorSize>          mInstanceAllocator;
 
     StaticArray<SharedPtr<Instance>, cMaxNumInstances> mActiveInstances;
     StaticArray<SharedPtr<Instance>, cMaxNumInstances> mScheduledInstances;
@@ -7,6 +7,7 @@
 #ifndef AOS_CM_LAUNCHER_STORAGE_HPP_
 #define AOS_CM_LAUNCHER_STORAGE_HPP_
 
+#include <core/common/tools/visitor.hpp>
 #include <core/common/types/envvars.hpp>
 
 #include <core/cm/launcher/itf/types.hpp>
@@ -17,6 +18,32 @@ namespace aos::cm::launcher {
  *  @{
  */
 
+/**
+ * Stored instance filter: unset fields match any instance.
+ */
+struct InstanceFilter {
+    Optional<StaticString<cIDLen>> mItemID;
+    Optional<StaticString<cIDLen>> mNodeID;
+    Optional<InstanceState>        mState;
+
+    /**
+     * Checks if instance info matches filter.
+     *
+     * @param info instance info.
+     * @return bool.
+     */
+    bool Match(const InstanceInfo& info) const
+    {
+        return (!mItemID.HasValue() || *mItemID == info.mInstanceIdent.mItemID)
+            && (!mNodeID.HasValue() || *mNodeID == info.mNodeID) && (!mState.HasValue() || *mState == info.mState);
+    }
+};
+
+/**
+ * Instance info visitor interface.
+ */
+using InstanceInfoVisitorItf = VisitorItf<InstanceInfo>;
+
 /**
  * Interface for service instance storage.
  */
@@ -60,6 +87,23 @@ public:
      */
     virtual Error LoadActiveInstances(Array<InstanceInfo>& instances) const = 0;
 
+    /**
+     * Visits stored instances matching filter.
+     *
+     * Instances are passed to the visitor one by one, so the caller doesn't need an array for all stored instances.
+     * The visitor must not modify the storage. Visiting stops on the first visitor error, which is returned.
+     * The default implementation visits instances loaded by LoadActiveInstances.
+     *
+     * @param filter instance filter.
+     * @param visitor instance visitor.
+     * @return Error.
+     */
+    virtual Error VisitInstances(const InstanceFilter& filter, InstanceInfoVisitorItf& visitor) const
+    {
+        return VisitLoadedItems<InstanceInfo, cMaxNumInstances>(
+            [this](Array<InstanceInfo>& instances) { return LoadActiveInstances(instances); }, filter, visitor);
+    }
+
     /**
      * Returns override environment variables.
      *
@@ -91,6 +135,24 @@ public:
      * @return Error.
      */
     virtual Error SaveRunRequests(const Array<RunInstanceRequest>& requests) = 0;
+
+    /**
+     * Begins storage transaction.
+     *
+     * Instance changes made until CommitTransaction are persisted with a single commit: after a crash, either all or
+     * none of them are present in the storage. Transactions are not nested.
+     * The default implementation doesn't support transactions: changes are persisted as they are made.
+     *
+     * @return Error.
+     */
+    virtual Error BeginTransaction() { return ErrorEnum::eNone; }
+
+    /**
+     * Commits storage transaction.
+     *
+     * @return Error.
+     */
+    virtual Error CommitTransaction() { return ErrorEnum::eNone; }
 };
 
 /** @}*/
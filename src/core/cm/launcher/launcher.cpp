@@ -29,6 +29,18 @@ public:
     }
 };
 
+class AlertNodeIDVisitor : public StaticVisitor<StaticString<cIDLen>> {
+public:
+    Res Visit(const SystemQuotaAlert& alert) const { return alert.mNodeID; }
+
+    template <typename T>
+    Res Visit(const T& alert) const
+    {
+        (void)alert;
+        return {};
+    }
+};
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -52,8 +64,10 @@ Error Launcher::Init(const Config& config, nodeinfoprovider::NodeInfoProviderItf
     mAlertsProvider     = &alertsProvider;
     mIdentProvider      = &identProvider;
 
-    auto err
-        = mInstanceManager.Init(config, itemInfoProvider, storageState, ociSpec, gidValidator, uidValidator, storage);
+    mDeferredStorage.Init(storage);
+
+    auto err = mInstanceManager.Init(
+        config, itemInfoProvider, storageState, ociSpec, gidValidator, uidValidator, mDeferredStorage);
     if (!err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
@@ -62,7 +76,7 @@ Error Launcher::Init(const Config& config, nodeinfoprovider::NodeInfoProviderItf
 
     mRunRequestsLoader.Init(storage, mInstanceManager, mImageInfoProvider);
     mNodeManager.Init(*mNodeInfoProvider, *mNodeConfigProvider, *mRunner);
-    mBalancer.Init(mInstanceManager, mImageInfoProvider, mNodeManager, *mMonitorProvider, *mRunner);
+    mBalancer.Init(config, mInstanceManager, mImageInfoProvider, mNodeManager, *mMonitorProvider, *mRunner);
 
     return ErrorEnum::eNone;
 }
@@ -175,6 +189,8 @@ Error Launcher::Stop()
     mAlertReceived         = false;
     mUpdatedNodes.Clear();
     mNewSubjects.Reset();
+    mBalancingChanges.Clear();
+    mFullRebalance = false;
     mInstanceStatuses.Clear();
 
     mProcessUpdatesCondVar.NotifyAll();
@@ -235,6 +251,19 @@ Error Launcher::RunInstances(const Array<RunInstanceRequest>& requests, Array<In
                   << Log::Field("numInstances", request.mNumInstances);
     }
 
+    // On incremental balancing, only instances of changed run requests are scheduled.
+    UniquePtr<BalancingChanges> changes;
+
+    if (mConfig.mIncrementalBalancing) {
+        changes = MakeUnique<BalancingChanges>(&mAllocator);
+
+        if (auto err = mRunRequestsLoader.GetChangedItems(requests, changes->mItemIDs); !err.IsNone()) {
+            LOG_WRN() << "Can't get changed items, perform full balancing" << Log::Field(err);
+
+            changes.Reset();
+        }
+    }
+
     if (auto err = mRunRequestsLoader.Save(requests); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
@@ -245,7 +274,21 @@ Error Launcher::RunInstances(const Array<RunInstanceRequest>& requests, Array<In
         return AOS_ERROR_WRAP(ErrorEnum::eCanceled);
     }
 
-    if (auto err = BalanceInstances(updateLock, false); !err.IsNone()) {
+    // Instances on nodes changed since the last balancing are affected as well. Pending changes are kept, so the
+    // following rebalancing still handles them.
+    if (changes) {
+        if (mFullRebalance) {
+            LOG_DBG() << "Full rebalancing is pending, perform full balancing";
+
+            changes.Reset();
+        } else if (auto err = changes->mNodeIDs.Assign(mBalancingChanges.mNodeIDs); !err.IsNone()) {
+            LOG_WRN() << "Can't get changed nodes, perform full balancing" << Log::Field(AOS_ERROR_WRAP(err));
+
+            changes.Reset();
+        }
+    }
+
+    if (auto err = BalanceInstances(updateLock, false, changes.Get()); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
@@ -394,15 +437,31 @@ void Launcher::FailActivatingInstances()
     }
 }
 
-Error Launcher::BalanceInstances(UniqueLock<Mutex>& lock, bool rebalance)
+Error Launcher::BalanceInstances(UniqueLock<Mutex>& lock, bool rebalance, const BalancingChanges* changes)
 {
-    LOG_DBG() << "Balance instances" << Log::Field("rebalance", rebalance);
+    LOG_DBG() << "Balance instances" << Log::Field("rebalance", rebalance)
+              << Log::Field("incremental", changes != nullptr);
+
+    // Instances created and scheduled by balancing are persisted with a single storage commit. The storage is shared
+    // with other modules, so instance changes are collected and written at once instead of keeping the transaction
+    // open during balancing.
+    mDeferredStorage.Defer();
 
     // Create instances from run requests.
     auto instances = MakeUnique<StaticArray<SharedPtr<Instance>, cMaxNumInstances>>(&mAllocator);
     mRunRequestsLoader.CreateInstances(mNodeManager.GetNodes(), *instances);
 
-    auto runErr = mBalancer.RunInstances(lock, *instances, rebalance);
+    auto runErr = mBalancer.RunInstances(*instances, rebalance, changes);
+
+    // Flush before sending instances to nodes, as sending releases the lock and waits for node statuses.
+    auto commitErr = mDeferredStorage.Flush();
+    if (!commitErr.IsNone()) {
+        LOG_ERR() << "Failed to store balancing result" << Log::Field(AOS_ERROR_WRAP(commitErr));
+    }
+
+    if (runErr.IsNone()) {
+        runErr = mBalancer.SendScheduledInstances(lock);
+    }
 
     FailActivatingInstances();
     UpdateInstanceStatuses();
@@ -411,6 +470,10 @@ Error Launcher::BalanceInstances(UniqueLock<Mutex>& lock, bool rebalance)
         return AOS_ERROR_WRAP(runErr);
     }
 
+    if (!commitErr.IsNone()) {
+        return AOS_ERROR_WRAP(commitErr);
+    }
+
     return ErrorEnum::eNone;
 }
 
@@ -446,6 +509,11 @@ void Launcher::ProcessUpdate()
                 LOG_ERR() << "Failed to set subjects" << Log::Field(AOS_ERROR_WRAP(err));
             }
 
+            // Subjects change affects instances on all nodes.
+            if (doRebalance) {
+                mFullRebalance = true;
+            }
+
             mNewSubjects.Reset();
         }
 
@@ -507,13 +575,34 @@ void Launcher::ProcessUpdate()
         if (doRebalance) {
             mForceRebalance = false;
 
-            if (err = BalanceInstances(updateLock, true); !err.IsNone()) {
+            // Take collected changes, as new ones may arrive while instances are sent to nodes.
+            UniquePtr<BalancingChanges> changes;
+
+            if (mConfig.mIncrementalBalancing && !mFullRebalance) {
+                changes  = MakeUnique<BalancingChanges>(&mAllocator);
+                *changes = mBalancingChanges;
+            }
+
+            mBalancingChanges.Clear();
+            mFullRebalance = false;
+
+            if (err = BalanceInstances(updateLock, true, changes.Get()); !err.IsNone()) {
                 LOG_ERR() << "Rebalancing failed" << Log::Field(AOS_ERROR_WRAP(err));
             }
         }
     }
 }
 
+void Launcher::AddChangedNode(const String& nodeID)
+{
+    if (auto err = PushUnique(mBalancingChanges.mNodeIDs, nodeID); !err.IsNone()) {
+        LOG_WRN() << "Can't add changed node, perform full rebalancing" << Log::Field("nodeID", nodeID)
+                  << Log::Field(AOS_ERROR_WRAP(err));
+
+        mFullRebalance = true;
+    }
+}
+
 void Launcher::WaitAllNodesConnected(UniqueLock<Mutex>& lock)
 {
     auto allNodesConnected = [this]() {
@@ -652,6 +741,7 @@ void Launcher::OnNodeInfoChanged(const UnitNodeInfo& info)
 
     if (mNodeManager.UpdateNodeInfo(info)) {
         mIsNodeInfoChanged = true;
+        AddChangedNode(info.mNodeID);
 
         mProcessUpdatesCondVar.NotifyAll();
         mAllNodesConnectedCondVar.NotifyAll();
@@ -669,6 +759,13 @@ Error Launcher::OnAlertReceived(const AlertVariant& alert)
     }
 
     mAlertReceived = true;
+
+    if (auto nodeID = alert.ApplyVisitor(AlertNodeIDVisitor()); !nodeID.IsEmpty()) {
+        AddChangedNode(nodeID);
+    } else {
+        mFullRebalance = true;
+    }
+
     mProcessUpdatesCondVar.NotifyAll();
 
     return ErrorEnum::eNone;
@@ -21,6 +21,7 @@
 #include "itf/storage.hpp"
 
 #include "balancer.hpp"
+#include "deferredstorage.hpp"
 #include "instancemanager.hpp"
 #include "nodemanager.hpp"
 #include "runrequestsloader.hpp"
@@ -134,14 +135,15 @@ public:
 private:
     static constexpr auto cMaxNumInstanceStatusListeners = 8;
     static constexpr auto cAllocatorSize                 = 2 * sizeof(StaticArray<InstanceStatus, cMaxNumInstances>)
-        + sizeof(StaticArray<SharedPtr<Instance>, cMaxNumInstances>);
+        + sizeof(StaticArray<SharedPtr<Instance>, cMaxNumInstances>) + sizeof(BalancingChanges);
 
     void SendRunStatus();
 
     void UpdateInstanceStatuses();
     void FailActivatingInstances();
 
-    Error BalanceInstances(UniqueLock<Mutex>& lock, bool rebalance);
+    Error BalanceInstances(UniqueLock<Mutex>& lock, bool rebalance, const BalancingChanges* changes = nullptr);
+    void  AddChangedNode(const String& nodeID);
 
     void ProcessUpdate();
     void WaitAllNodesConnected(UniqueLock<Mutex>& lock);
@@ -176,6 +178,7 @@ private:
     StaticArray<instancestatusprovider::ListenerItf*, cMaxNumInstanceStatusListeners> mInstanceStatusListeners;
 
     // Managers
+    DeferredStorage   mDeferredStorage {};
     RunRequestsLoader mRunRequestsLoader {};
     InstanceManager   mInstanceManager {};
     NodeManager       mNodeManager {};
@@ -192,6 +195,8 @@ private:
     bool                                            mIsNodeInfoChanged {};
     Optional<SubjectArray>                          mNewSubjects;
     bool                                            mForceRebalance {};
+    BalancingChanges                                mBalancingChanges;
+    bool                                            mFullRebalance {};
 
     // Override environment variables
     OverrideEnvVarsRequest mOverrideEnvVars;
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <core/common/tools/logger.hpp>
+
+#include "nodeindex.hpp"
+
+namespace aos::cm::launcher {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+Error NodeIndex::Build(NodeManager& nodeManager)
+{
+    mNodes.Clear();
+    mEntries.Clear();
+    mAll = EntrySet {};
+    mNodeGroups.Clear();
+    mLabelGroups.Clear();
+    mRuntimeTypeGroups.Clear();
+    mPlatformGroups.Clear();
+
+    if (auto err = nodeManager.GetConnectedNodes(mNodes); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    for (auto node : mNodes) {
+        for (const auto& runtime : node->GetInfo().mRuntimes) {
+            auto index = mEntries.Size();
+
+            if (auto err = mEntries.PushBack({node, &runtime}); !err.IsNone()) {
+                return AOS_ERROR_WRAP(err);
+            }
+
+            mAll.Set(index);
+
+            auto err = AddToGroup(mNodeGroups, *node, index, [](const Node& left, const Node& right) {
+                return &left == &right;
+            });
+            if (!err.IsNone()) {
+                return err;
+            }
+
+            err = AddToGroup(mLabelGroups, node->GetConfig().mLabels, index,
+                [](const LabelsArray& left, const LabelsArray& right) { return left == right; });
+            if (!err.IsNone()) {
+                return err;
+            }
+
+            err = AddToGroup(mRuntimeTypeGroups, runtime, index, [](const RuntimeInfo& left, const RuntimeInfo& right) {
+                return left.mRuntimeType == right.mRuntimeType;
+            });
+            if (!err.IsNone()) {
+                return err;
+            }
+
+            err = AddToGroup<PlatformInfo>(mPlatformGroups, runtime, index,
+                [](const PlatformInfo& left, const PlatformInfo& right) { return left == right; });
+            if (!err.IsNone()) {
+                return err;
+            }
+        }
+    }
+
+    LOG_DBG() << "Node index built" << Log::Field("numNodes", mNodes.Size())
+              << Log::Field("numEntries", mEntries.Size()) << Log::Field("numRuntimeTypes", mRuntimeTypeGroups.Size())
+              << Log::Field("numPlatforms", mPlatformGroups.Size());
+
+    return ErrorEnum::eNone;
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+template <typename T, typename Equal>
+Error NodeIndex::AddToGroup(Array<Group<T>>& groups, const T& key, size_t index, Equal equal)
+{
+    auto group = groups.FindIf([&key, &equal](const Group<T>& group) { return equal(*group.mKey, key); });
+
+    if (group == groups.end()) {
+        if (auto err = groups.PushBack({&key, {}}); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        group = &groups.Back();
+    }
+
+    group->mEntries.Set(index);
+
+    return ErrorEnum::eNone;
+}
+
+} // namespace aos::cm::launcher
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_CM_LAUNCHER_NODEINDEX_HPP_
+#define AOS_CORE_CM_LAUNCHER_NODEINDEX_HPP_
+
+#include <core/common/tools/array.hpp>
+
+#include "nodemanager.hpp"
+
+namespace aos::cm::launcher {
+
+/** @addtogroup cm Communication Manager
+ *  @{
+ */
+
+/**
+ * Index of node runtimes built once per balancing round.
+ *
+ * Each node runtime is an index entry. Entries are grouped by node, node labels, runtime type and platform, so filters
+ * are evaluated once per group and candidate entries are selected by set intersection.
+ *
+ * Node resources (CPU, RAM, shared resources and max instances) are not indexed: they are reserved by each scheduled
+ * instance and change during the balancing round, so they are checked against the node state with FilterNodes and
+ * FilterEntries.
+ */
+class NodeIndex {
+public:
+    /**
+     * Max number of index entries.
+     */
+    static constexpr size_t cMaxNumEntries = cMaxNumNodes * cMaxNumNodeRuntimes;
+
+    /**
+     * Index entry.
+     */
+    struct Entry {
+        Node*              mNode {};
+        const RuntimeInfo* mRuntime {};
+    };
+
+    /**
+     * Set of index entries.
+     */
+    class EntrySet {
+    public:
+        /**
+         * Adds entry to set.
+         *
+         * @param index entry index.
+         */
+        void Set(size_t index) { mWords[index / cWordBits] |= Word(1) << (index % cWordBits); }
+
+        /**
+         * Removes entry from set.
+         *
+         * @param index entry index.
+         */
+        void Reset(size_t index) { mWords[index / cWordBits] &= ~(Word(1) << (index % cWordBits)); }
+
+        /**
+         * Checks if entry is in set.
+         *
+         * @param index entry index.
+         * @return bool.
+         */
+        bool Test(size_t index) const { return (mWords[index / cWordBits] & (Word(1) << (index % cWordBits))) != 0; }
+
+        /**
+         * Removes entries of other set from this set.
+         *
+         * @param other other set.
+         */
+        void Remove(const EntrySet& other)
+        {
+            for (size_t i = 0; i < cNumWords; i++) {
+                mWords[i] &= ~other.mWords[i];
+            }
+        }
+
+        /**
+         * Checks if sets have common entries.
+         *
+         * @param other other set.
+         * @return bool.
+         */
+        bool Intersects(const EntrySet& other) const
+        {
+            for (size_t i = 0; i < cNumWords; i++) {
+                if ((mWords[i] & other.mWords[i]) != 0) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * Checks if set is empty.
+         *
+         * @return bool.
+         */
+        bool IsEmpty() const
+        {
+            for (size_t i = 0; i < cNumWords; i++) {
+                if (mWords[i] != 0) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    private:
+        using Word = uint64_t;
+
+        static constexpr size_t cWordBits = sizeof(Word) * 8;
+        static constexpr size_t cNumWords = (cMaxNumEntries + cWordBits - 1) / cWordBits;
+
+        Word mWords[cNumWords] {};
+    };
+
+    /**
+     * Builds index for connected nodes.
+     *
+     * @param nodeManager node manager.
+     * @return Error.
+     */
+    Error Build(NodeManager& nodeManager);
+
+    /**
+     * Returns indexed nodes.
+     *
+     * @return const Array<Node*>&.
+     */
+    const Array<Node*>& GetNodes() const { return mNodes; }
+
+    /**
+     * Returns index entries.
+     *
+     * @return const Array<Entry>&.
+     */
+    const Array<Entry>& GetEntries() const { return mEntries; }
+
+    /**
+     * Returns set of all index entries.
+     *
+     * @return const EntrySet&.
+     */
+    const EntrySet& GetAll() const { return mAll; }
+
+    /**
+     * Removes entries of nodes not matching filter.
+     *
+     * @param entries entries to filter.
+     * @param filter filter called once per node.
+     */
+    template <typename Filter>
+    void FilterNodes(EntrySet& entries, Filter filter) const
+    {
+        FilterGroups(mNodeGroups, entries, filter);
+    }
+
+    /**
+     * Removes entries of nodes which labels don't match filter.
+     *
+     * @param entries entries to filter.
+     * @param filter filter called once per distinct node labels.
+     */
+    template <typename Filter>
+    void FilterLabels(EntrySet& entries, Filter filter) const
+    {
+        FilterGroups(mLabelGroups, entries, filter);
+    }
+
+    /**
+     * Removes entries which runtime type doesn't match filter.
+     *
+     * @param entries entries to filter.
+     * @param filter filter called once per distinct runtime type.
+     */
+    template <typename Filter>
+    void FilterRuntimeTypes(EntrySet& entries, Filter filter) const
+    {
+        FilterGroups(mRuntimeTypeGroups, entries, filter);
+    }
+
+    /**
+     * Removes entries which platform doesn't match filter.
+     *
+     * @param entries entries to filter.
+     * @param filter filter called once per distinct platform.
+     */
+    template <typename Filter>
+    void FilterPlatforms(EntrySet& entries, Filter filter) const
+    {
+        FilterGroups(mPlatformGroups, entries, filter);
+    }
+
+    /**
+     * Removes entries not matching filter.
+     *
+     * @param entries entries to filter.
+     * @param filter filter called once per entry.
+     */
+    template <typename Filter>
+    void FilterEntries(EntrySet& entries, Filter filter) const
+    {
+        for (size_t i = 0; i < mEntries.Size(); i++) {
+            if (entries.Test(i) && !filter(mEntries[i])) {
+                entries.Reset(i);
+            }
+        }
+    }
+
+private:
+    template <typename T>
+    struct Group {
+        const T* mKey {};
+        EntrySet mEntries;
+    };
+
+    template <typename T, typename Equal>
+    static Error AddToGroup(Array<Group<T>>& groups, const T& key, size_t index, Equal equal);
+
+    template <typename T, typename Filter>
+    static void FilterGroups(const Array<Group<T>>& groups, EntrySet& entries, Filter& filter)
+    {
+        for (const auto& group : groups) {
+            if (entries.Intersects(group.mEntries) && !filter(*group.mKey)) {
+                entries.Remove(group.mEntries);
+            }
+        }
+    }
+
+    StaticArray<Node*, cMaxNumNodes>                 mNodes;
+    StaticArray<Entry, cMaxNumEntries>               mEntries;
+    EntrySet                                         mAll;
+    StaticArray<Group<Node>, cMaxNumNodes>           mNodeGroups;
+    StaticArray<Group<LabelsArray>, cMaxNumNodes>    mLabelGroups;
+    StaticArray<Group<RuntimeInfo>, cMaxNumEntries>  mRuntimeTypeGroups;
+    StaticArray<Group<PlatformInfo>, cMaxNumEntries> mPlatformGroups;
+};
+
+/** @}*/
+
+} // namespace aos::cm::launcher
+
+#endif
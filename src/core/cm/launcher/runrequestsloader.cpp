@@ -31,6 +31,28 @@ Error RunRequestsLoader::Save(const Array<RunInstanceRequest>& requests)
     return mStorage->SaveRunRequests(mRunRequests);
 }
 
+Error RunRequestsLoader::GetChangedItems(
+    const Array<RunInstanceRequest>& requests, Array<StaticString<cIDLen>>& itemIDs) const
+{
+    for (const auto& request : requests) {
+        if (!mRunRequests.Contains(request)) {
+            if (auto err = PushUnique(itemIDs, request.mItemID); !err.IsNone()) {
+                return AOS_ERROR_WRAP(err);
+            }
+        }
+    }
+
+    for (const auto& request : mRunRequests) {
+        if (!requests.Contains(request)) {
+            if (auto err = PushUnique(itemIDs, request.mItemID); !err.IsNone()) {
+                return AOS_ERROR_WRAP(err);
+            }
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
 Error RunRequestsLoader::Load()
 {
     mRunRequests.Clear();
@@ -36,6 +36,15 @@ public:
      */
     Error Save(const Array<RunInstanceRequest>& requests);
 
+    /**
+     * Returns IDs of items whose run requests differ from the saved ones.
+     *
+     * @param requests new run requests.
+     * @param[out] itemIDs changed item IDs.
+     * @return Error.
+     */
+    Error GetChangedItems(const Array<RunInstanceRequest>& requests, Array<StaticString<cIDLen>>& itemIDs) const;
+
     /**
      * Loads run requests from storage into internal buffer.
      *
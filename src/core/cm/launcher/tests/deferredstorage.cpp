@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <core/cm/launcher/deferredstorage.hpp>
+#include <core/common/tests/utils/log.hpp>
+
+#include "stubs/storagestub.hpp"
+
+using namespace testing;
+
+namespace aos::cm::launcher {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+InstanceInfo CreateInstanceInfo(const String& itemID, uint64_t instance, const String& nodeID)
+{
+    InstanceInfo info;
+
+    info.mInstanceIdent.mItemID   = itemID;
+    info.mInstanceIdent.mInstance = instance;
+    info.mVersion                 = "1.0.0";
+    info.mNodeID                  = nodeID;
+
+    return info;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class CMDeferredStorageTest : public Test {
+protected:
+    static void SetUpTestSuite() { tests::utils::InitLog(); }
+
+    void SetUp() override
+    {
+        mStorage.Init();
+        mDeferredStorage->Init(mStorage);
+    }
+
+    std::unique_ptr<StaticArray<InstanceInfo, cMaxNumInstances>> GetInstances()
+    {
+        auto instances = std::make_unique<StaticArray<InstanceInfo, cMaxNumInstances>>();
+
+        EXPECT_TRUE(mStorage.LoadActiveInstances(*instances).IsNone());
+
+        return instances;
+    }
+
+    StorageStub                      mStorage;
+    std::unique_ptr<DeferredStorage> mDeferredStorage = std::make_unique<DeferredStorage>();
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(CMDeferredStorageTest, WritesThroughWhenNotDeferred)
+{
+    const auto info = CreateInstanceInfo("item0", 0, "node0");
+
+    ASSERT_TRUE(mDeferredStorage->AddInstance(info).IsNone());
+    EXPECT_TRUE(mStorage.HasInstance(info.mInstanceIdent, info.mVersion));
+
+    EXPECT_TRUE(mDeferredStorage->AddInstance(info).Is(ErrorEnum::eAlreadyExist));
+}
+
+TEST_F(CMDeferredStorageTest, FlushWritesCoalescedChanges)
+{
+    const auto stored  = CreateInstanceInfo("item0", 0, "node0");
+    const auto removed = CreateInstanceInfo("item0", 1, "node0");
+
+    ASSERT_TRUE(mStorage.AddInstance(stored).IsNone());
+    ASSERT_TRUE(mStorage.AddInstance(removed).IsNone());
+
+    mDeferredStorage->Defer();
+
+    // Added and updated instance is written with the latest info.
+    auto added = CreateInstanceInfo("item1", 0, "node0");
+
+    ASSERT_TRUE(mDeferredStorage->AddInstance(added).IsNone());
+
+    added.mNodeID = "node1";
+
+    ASSERT_TRUE(mDeferredStorage->UpdateInstance(added).IsNone());
+
+    // Added and removed instance is not written at all.
+    const auto transient = CreateInstanceInfo("item2", 0, "node0");
+
+    ASSERT_TRUE(mDeferredStorage->AddInstance(transient).IsNone());
+    ASSERT_TRUE(mDeferredStorage->RemoveInstance(transient.mInstanceIdent, transient.mVersion).IsNone());
+
+    // Updated and removed instance is removed.
+    ASSERT_TRUE(mDeferredStorage->UpdateInstance(removed).IsNone());
+    ASSERT_TRUE(mDeferredStorage->RemoveInstance(removed.mInstanceIdent, removed.mVersion).IsNone());
+
+    // Removed and added again instance is replaced.
+    auto replaced = stored;
+
+    replaced.mNodeID = "node1";
+
+    ASSERT_TRUE(mDeferredStorage->RemoveInstance(stored.mInstanceIdent, stored.mVersion).IsNone());
+    ASSERT_TRUE(mDeferredStorage->AddInstance(replaced).IsNone());
+
+    // Nothing is written until flush.
+    EXPECT_EQ(GetInstances()->Size(), 2);
+
+    ASSERT_TRUE(mDeferredStorage->Flush().IsNone());
+    EXPECT_FALSE(mStorage.IsInTransaction());
+
+    auto instances = GetInstances();
+
+    ASSERT_EQ(instances->Size(), 2);
+    EXPECT_NE(instances->Find(added), instances->end());
+    EXPECT_NE(instances->Find(replaced), instances->end());
+
+    // Not deferred after flush.
+    const auto info = CreateInstanceInfo("item3", 0, "node0");
+
+    ASSERT_TRUE(mDeferredStorage->AddInstance(info).IsNone());
+    EXPECT_TRUE(mStorage.HasInstance(info.mInstanceIdent, info.mVersion));
+}
+
+TEST_F(CMDeferredStorageTest, CrashOnFlushLosesAllChanges)
+{
+    mDeferredStorage->Defer();
+
+    for (uint64_t i = 0; i < 3; i++) {
+        ASSERT_TRUE(mDeferredStorage->AddInstance(CreateInstanceInfo("item0", i, "node0")).IsNone());
+    }
+
+    mStorage.SetCrashOnCommit(true);
+
+    EXPECT_FALSE(mDeferredStorage->Flush().IsNone());
+    EXPECT_TRUE(GetInstances()->IsEmpty());
+}
+
+} // namespace aos::cm::launcher
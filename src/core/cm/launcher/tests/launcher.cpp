@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <core/cm/launcher/launcher.hpp>
@@ -2644,4 +2645,343 @@ TEST_F(CMLauncherTest, UnlimitedSharedResource)
     ASSERT_TRUE(mLauncher.Stop().IsNone());
 }
 
+TEST_F(CMLauncherTest, BinPackingBalancing)
+{
+    struct TestData {
+        BalancingMode mMode;
+        bool          mAllScheduled;
+    };
+
+    std::vector<TestData> testData = {
+        {BalancingModeEnum::eGreedy, false},
+        {BalancingModeEnum::eBinPacking, true},
+    };
+
+    for (const auto& testItem : testData) {
+        LOG_INF() << "Test case" << Log::Field("mode", testItem.mMode);
+
+        // Initialize stubs.
+        mStorageState.Init();
+        mStorageState.SetTotalStateSize(1024);
+        mStorageState.SetTotalStorageSize(1024);
+
+        mNodeInfoProvider.Init();
+        mImageStore.Init();
+        mInstanceStatusProvider.Init();
+        mMonitoringProvider.Init();
+        mAlertsProvider.Init();
+        mResourceManager.Init();
+        mStorage.Init();
+
+        // Two equal nodes: greedy placement spreads small instances and leaves no room for the large one.
+        for (const auto& nodeID : {cNodeIDLocalSM, cNodeIDRemoteSM1}) {
+            mNodeInfoProvider.AddNodeInfo(nodeID, CreateNodeInfo(nodeID, 1000, 1024, {CreateRuntime(cRunnerRunc)}));
+
+            NodeConfig nodeConfig;
+            CreateNodeConfig(nodeConfig, nodeID);
+            mResourceManager.SetNodeConfig(nodeID, cNodeTypeVM, nodeConfig);
+
+            auto nodeMonitoring = std::make_unique<monitoring::NodeMonitoringData>();
+            CreateNodeMonitoring(*nodeMonitoring, nodeID, 0.0);
+            mMonitoringProvider.SetAverageMonitoring(nodeID, *nodeMonitoring);
+        }
+
+        auto smallItemConfig = std::make_unique<oci::ItemConfig>();
+        CreateItemConfig(*smallItemConfig, {cRunnerRunc}, oci::BalancingPolicyEnum::eEnabled, {},
+            CreateRequestedResources(0, 0, 0, 512));
+        AddItem(cService1, cImageID1, *smallItemConfig, CreateImageConfig());
+
+        auto largeItemConfig = std::make_unique<oci::ItemConfig>();
+        CreateItemConfig(*largeItemConfig, {cRunnerRunc}, oci::BalancingPolicyEnum::eEnabled, {},
+            CreateRequestedResources(0, 0, 0, 1024));
+        AddItem(cService2, cImageID1, *largeItemConfig, CreateImageConfig());
+
+        mInstanceRunner.Init(mLauncher, true, aos::InstanceStateEnum::eActive);
+
+        auto config           = CreateConfig();
+        config.mBalancingMode = testItem.mMode;
+
+        ASSERT_TRUE(mLauncher
+                        .Init(config, mNodeInfoProvider, mInstanceRunner, mImageStore, mImageStore, mResourceManager,
+                            mStorageState, mMonitoringProvider, mAlertsProvider, mIdentProvider, ValidateGID,
+                            ValidateUID, mStorage)
+                        .IsNone());
+
+        ASSERT_TRUE(mLauncher.Start().IsNone());
+
+        for (const auto& nodeID : {cNodeIDLocalSM, cNodeIDRemoteSM1}) {
+            mInstanceRunner.SendInitialStatuses(nodeID);
+        }
+
+        auto runRequest = std::make_unique<StaticArray<RunInstanceRequest, cMaxNumInstances>>();
+        runRequest->PushBack(CreateRunRequest(cService1, cSubject1, 50, 2));
+        runRequest->PushBack(CreateRunRequest(cService2, cSubject1, 50, 1));
+
+        auto runStatuses = std::make_unique<StaticArray<InstanceStatus, cMaxNumInstances>>();
+        ASSERT_TRUE(mLauncher.RunInstances(*runRequest, *runStatuses).IsNone());
+
+        ASSERT_TRUE(mLauncher.Stop().IsNone());
+
+        ASSERT_EQ(runStatuses->Size(), 3);
+
+        std::map<std::string, size_t> nodeInstances;
+
+        for (const auto& status : *runStatuses) {
+            if (status.mState == aos::InstanceStateEnum::eActive) {
+                nodeInstances[status.mNodeID.CStr()]++;
+            }
+        }
+
+        auto largeStatus
+            = runStatuses->FindIf([](const InstanceStatus& status) { return status.mItemID == cService2; });
+        ASSERT_NE(largeStatus, runStatuses->end());
+
+        if (testItem.mAllScheduled) {
+            EXPECT_EQ(largeStatus->mState, aos::InstanceStateEnum::eActive);
+            EXPECT_EQ(nodeInstances[largeStatus->mNodeID.CStr()], 1);
+            EXPECT_EQ(nodeInstances[cNodeIDLocalSM] + nodeInstances[cNodeIDRemoteSM1], 3);
+        } else {
+            EXPECT_EQ(largeStatus->mState, aos::InstanceStateEnum::eFailed);
+        }
+    }
+}
+
+TEST_F(CMLauncherTest, IncrementalBalancing)
+{
+    struct TestData {
+        bool        mIncremental;
+        std::string mService1NodeID;
+    };
+
+    constexpr auto cNumService1Instances = 2;
+
+    std::vector<TestData> testData = {
+        {false, cNodeIDRemoteSM1},
+        {true, cNodeIDLocalSM},
+    };
+
+    for (const auto& testItem : testData) {
+        LOG_INF() << "Test case" << Log::Field("incremental", testItem.mIncremental);
+
+        // Initialize stubs.
+        mStorageState.Init();
+        mStorageState.SetTotalStateSize(1024);
+        mStorageState.SetTotalStorageSize(1024);
+
+        mNodeInfoProvider.Init();
+        mImageStore.Init();
+        mInstanceStatusProvider.Init();
+        mMonitoringProvider.Init();
+        mAlertsProvider.Init();
+        mResourceManager.Init();
+        mStorage.Init();
+
+        for (const auto& nodeID : {cNodeIDLocalSM, cNodeIDRemoteSM1}) {
+            mNodeInfoProvider.AddNodeInfo(nodeID, CreateNodeInfo(nodeID, 1000, 1024, {CreateRuntime(cRunnerRunc)}));
+
+            auto nodeMonitoring = std::make_unique<monitoring::NodeMonitoringData>();
+            CreateNodeMonitoring(*nodeMonitoring, nodeID, 0.0);
+            mMonitoringProvider.SetAverageMonitoring(nodeID, *nodeMonitoring);
+        }
+
+        auto setNodePriorities = [this](uint64_t localPriority, uint64_t remotePriority) {
+            NodeConfig localNodeConfig;
+            CreateNodeConfig(localNodeConfig, cNodeIDLocalSM, localPriority);
+            mResourceManager.SetNodeConfig(cNodeIDLocalSM, cNodeTypeVM, localNodeConfig);
+
+            NodeConfig remoteNodeConfig;
+            CreateNodeConfig(remoteNodeConfig, cNodeIDRemoteSM1, remotePriority);
+            mResourceManager.SetNodeConfig(cNodeIDRemoteSM1, cNodeTypeVM, remoteNodeConfig);
+        };
+
+        setNodePriorities(100, 50);
+
+        for (const auto& itemID : {cService1, cService2}) {
+            auto itemConfig = std::make_unique<oci::ItemConfig>();
+            CreateItemConfig(*itemConfig, {cRunnerRunc}, oci::BalancingPolicyEnum::eEnabled);
+            AddItem(itemID, cImageID1, *itemConfig, CreateImageConfig());
+        }
+
+        mInstanceRunner.Init(mLauncher, true, aos::InstanceStateEnum::eActive);
+
+        auto config                  = CreateConfig();
+        config.mIncrementalBalancing = testItem.mIncremental;
+
+        ASSERT_TRUE(mLauncher
+                        .Init(config, mNodeInfoProvider, mInstanceRunner, mImageStore, mImageStore, mResourceManager,
+                            mStorageState, mMonitoringProvider, mAlertsProvider, mIdentProvider, ValidateGID,
+                            ValidateUID, mStorage)
+                        .IsNone());
+
+        ASSERT_TRUE(mLauncher.Start().IsNone());
+
+        for (const auto& nodeID : {cNodeIDLocalSM, cNodeIDRemoteSM1}) {
+            mInstanceRunner.SendInitialStatuses(nodeID);
+        }
+
+        auto runRequest = std::make_unique<StaticArray<RunInstanceRequest, cMaxNumInstances>>();
+        runRequest->PushBack(CreateRunRequest(cService1, cSubject1, 50, cNumService1Instances));
+
+        auto runStatuses = std::make_unique<StaticArray<InstanceStatus, cMaxNumInstances>>();
+        ASSERT_TRUE(mLauncher.RunInstances(*runRequest, *runStatuses).IsNone());
+
+        ASSERT_EQ(runStatuses->Size(), cNumService1Instances);
+
+        for (const auto& status : *runStatuses) {
+            EXPECT_EQ(status.mNodeID, cNodeIDLocalSM);
+        }
+
+        // Swap node priorities and add a new item: on incremental balancing, all unchanged service1 instances are
+        // pinned to their node.
+        setNodePriorities(50, 100);
+
+        runRequest->PushBack(CreateRunRequest(cService2, cSubject1, 50, 1));
+
+        auto numService1ConfigLoads = mImageStore.GetNumItemConfigLoads(cService1, cImageID1);
+
+        ASSERT_TRUE(mLauncher.RunInstances(*runRequest, *runStatuses).IsNone());
+
+        ASSERT_EQ(runStatuses->Size(), cNumService1Instances + 1);
+
+        // Pinned instances are scheduled without loading configs again.
+        if (testItem.mIncremental) {
+            EXPECT_EQ(mImageStore.GetNumItemConfigLoads(cService1, cImageID1), numService1ConfigLoads);
+        } else {
+            EXPECT_GT(mImageStore.GetNumItemConfigLoads(cService1, cImageID1), numService1ConfigLoads);
+        }
+
+        for (const auto& status : *runStatuses) {
+            EXPECT_EQ(status.mState, aos::InstanceStateEnum::eActive);
+            EXPECT_EQ(status.mNodeID, status.mItemID == cService1 ? testItem.mService1NodeID.c_str() : cNodeIDRemoteSM1);
+        }
+
+        // Change local node: instances on it are not pinned anymore, even if run request is not changed. The node is
+        // disconnected first, so run instances waits for it and is balanced before rebalancing caused by the change.
+        mNodeInfoProvider.AddNodeInfo(cNodeIDLocalSM,
+            CreateNodeInfo(cNodeIDLocalSM, 2000, 1024, {CreateRuntime(cRunnerRunc)}, {}, NodeStateEnum::eProvisioned,
+                false));
+
+        InstanceStatusListenerStub instanceStatusListener;
+        mLauncher.SubscribeListener(instanceStatusListener);
+
+        Error       runErr;
+        std::thread runThread([&]() { runErr = mLauncher.RunInstances(*runRequest, *runStatuses); });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        mNodeInfoProvider.AddNodeInfo(
+            cNodeIDLocalSM, CreateNodeInfo(cNodeIDLocalSM, 2000, 1024, {CreateRuntime(cRunnerRunc)}));
+        mInstanceRunner.SendInitialStatuses(cNodeIDLocalSM);
+
+        runThread.join();
+
+        ASSERT_TRUE(runErr.IsNone());
+
+        // Wait for rebalancing caused by the node change: statuses are settled when no more changes are notified.
+        while (instanceStatusListener.WaitForNotifyCount(
+            instanceStatusListener.GetNotifyCount() + 1, std::chrono::milliseconds(500))) { }
+
+        mLauncher.UnsubscribeListener(instanceStatusListener);
+
+        ASSERT_TRUE(mLauncher.Stop().IsNone());
+
+        ASSERT_EQ(runStatuses->Size(), cNumService1Instances + 1);
+
+        for (const auto& status : *runStatuses) {
+            EXPECT_EQ(status.mState, aos::InstanceStateEnum::eActive);
+            EXPECT_EQ(status.mNodeID, cNodeIDRemoteSM1);
+        }
+    }
+}
+
+TEST_F(CMLauncherTest, BalancingIsPersistedAtomically)
+{
+    struct TestData {
+        bool   mCrashOnCommit;
+        size_t mNumStoredInstances;
+    };
+
+    std::vector<TestData> testData = {
+        {false, 3},
+        {true, 0},
+    };
+
+    for (const auto& testItem : testData) {
+        LOG_INF() << "Test case" << Log::Field("crashOnCommit", testItem.mCrashOnCommit);
+
+        // Initialize stubs.
+        mStorageState.Init();
+        mStorageState.SetTotalStateSize(1024);
+        mStorageState.SetTotalStorageSize(1024);
+
+        mNodeInfoProvider.Init();
+        mImageStore.Init();
+        mInstanceStatusProvider.Init();
+        mMonitoringProvider.Init();
+        mAlertsProvider.Init();
+        mResourceManager.Init();
+        mStorage.Init();
+
+        mNodeInfoProvider.AddNodeInfo(
+            cNodeIDLocalSM, CreateNodeInfo(cNodeIDLocalSM, 1000, 1024, {CreateRuntime(cRunnerRunc)}));
+
+        NodeConfig nodeConfig;
+        CreateNodeConfig(nodeConfig, cNodeIDLocalSM);
+        mResourceManager.SetNodeConfig(cNodeIDLocalSM, cNodeTypeVM, nodeConfig);
+
+        auto nodeMonitoring = std::make_unique<monitoring::NodeMonitoringData>();
+        CreateNodeMonitoring(*nodeMonitoring, cNodeIDLocalSM, 0.0);
+        mMonitoringProvider.SetAverageMonitoring(cNodeIDLocalSM, *nodeMonitoring);
+
+        auto itemConfig = std::make_unique<oci::ItemConfig>();
+        CreateItemConfig(*itemConfig, {cRunnerRunc}, oci::BalancingPolicyEnum::eEnabled);
+        AddItem(cService1, cImageID1, *itemConfig, CreateImageConfig());
+
+        mInstanceRunner.Init(mLauncher, true, aos::InstanceStateEnum::eActive);
+
+        ASSERT_TRUE(mLauncher
+                        .Init(CreateConfig(), mNodeInfoProvider, mInstanceRunner, mImageStore, mImageStore,
+                            mResourceManager, mStorageState, mMonitoringProvider, mAlertsProvider, mIdentProvider,
+                            ValidateGID, ValidateUID, mStorage)
+                        .IsNone());
+
+        ASSERT_TRUE(mLauncher.Start().IsNone());
+
+        mInstanceRunner.SendInitialStatuses(cNodeIDLocalSM);
+
+        // Storage state is persisted in the shared storage during balancing: it shouldn't be a part of launcher
+        // transaction.
+        size_t numSetups = 0;
+
+        mStorageState.SetSetupCallback([this, &numSetups]() {
+            EXPECT_FALSE(mStorage.IsInTransaction());
+
+            numSetups++;
+        });
+
+        // Crash on commit loses all instances of the scheduling result, not only part of them.
+        mStorage.SetCrashOnCommit(testItem.mCrashOnCommit);
+
+        auto runRequest = std::make_unique<StaticArray<RunInstanceRequest, cMaxNumInstances>>();
+        runRequest->PushBack(CreateRunRequest(cService1, cSubject1, 50, 3));
+
+        auto runStatuses = std::make_unique<StaticArray<InstanceStatus, cMaxNumInstances>>();
+        auto err         = mLauncher.RunInstances(*runRequest, *runStatuses);
+
+        EXPECT_EQ(err.IsNone(), !testItem.mCrashOnCommit);
+        EXPECT_NE(numSetups, 0);
+
+        ASSERT_TRUE(mLauncher.Stop().IsNone());
+
+        auto storedInstances = std::make_unique<StaticArray<InstanceInfo, cMaxNumInstances>>();
+        ASSERT_TRUE(mStorage.LoadActiveInstances(*storedInstances).IsNone());
+
+        EXPECT_EQ(storedInstances->Size(), testItem.mNumStoredInstances);
+
+        for (const auto& instance : *storedInstances) {
+            EXPECT_EQ(instance.mNodeID, cNodeIDLocalSM);
+        }
+    }
+}
+
 } // namespace aos::cm::launcher
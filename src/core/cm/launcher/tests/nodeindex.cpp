@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <core/cm/launcher/nodeindex.hpp>
+#include <core/common/tests/utils/log.hpp>
+
+#include "stubs/instancerunnerstub.hpp"
+#include "stubs/nodeinfoproviderstub.hpp"
+#include "stubs/resourcemanagerstub.hpp"
+
+using namespace testing;
+
+namespace aos::cm::launcher {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Constants
+ **********************************************************************************************************************/
+
+constexpr auto cNodeType = "vm";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+RuntimeInfo CreateRuntime(const std::string& runtimeID, const std::string& runtimeType = "runc",
+    const std::string& architecture = "x86_64")
+{
+    RuntimeInfo runtimeInfo;
+
+    runtimeInfo.mRuntimeID              = runtimeID.c_str();
+    runtimeInfo.mRuntimeType            = runtimeType.c_str();
+    runtimeInfo.mArchInfo.mArchitecture = architecture.c_str();
+    runtimeInfo.mOSInfo.mOS             = "linux";
+
+    return runtimeInfo;
+}
+
+std::unique_ptr<UnitNodeInfo> CreateNodeInfo(const std::string& nodeID, const std::vector<RuntimeInfo>& runtimes,
+    NodeState state = NodeStateEnum::eProvisioned)
+{
+    auto nodeInfo = std::make_unique<UnitNodeInfo>();
+
+    nodeInfo->mNodeID      = nodeID.c_str();
+    nodeInfo->mNodeType    = cNodeType;
+    nodeInfo->mState       = state;
+    nodeInfo->mIsConnected = true;
+
+    for (const auto& runtime : runtimes) {
+        nodeInfo->mRuntimes.PushBack(runtime);
+    }
+
+    return nodeInfo;
+}
+
+std::vector<std::string> GetEntryRuntimes(const NodeIndex& index, const NodeIndex::EntrySet& entries)
+{
+    std::vector<std::string> result;
+
+    for (size_t i = 0; i < index.GetEntries().Size(); i++) {
+        if (entries.Test(i)) {
+            result.push_back(index.GetEntries()[i].mRuntime->mRuntimeID.CStr());
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class CMNodeIndexTest : public Test {
+protected:
+    void SetUp() override
+    {
+        tests::utils::InitLog();
+
+        mNodeManager.Init(mNodeInfoProvider, mResourceManager, mInstanceRunner);
+    }
+
+    void AddNode(const std::string& nodeID, const std::vector<RuntimeInfo>& runtimes, uint64_t priority = 0,
+        const std::vector<std::string>& labels = {})
+    {
+        auto nodeConfig = std::make_unique<NodeConfig>();
+
+        nodeConfig->mNodeID   = nodeID.c_str();
+        nodeConfig->mNodeType = cNodeType;
+        nodeConfig->mPriority = priority;
+
+        for (const auto& label : labels) {
+            ASSERT_TRUE(nodeConfig->mLabels.PushBack(label.c_str()).IsNone());
+        }
+
+        mResourceManager.SetNodeConfig(nodeID.c_str(), cNodeType, *nodeConfig);
+        mNodeInfoProvider.AddNodeInfo(nodeID.c_str(), *CreateNodeInfo(nodeID, runtimes));
+    }
+
+    void BuildIndex()
+    {
+        ASSERT_TRUE(mNodeManager.PrepareForBalancing(false).IsNone());
+        ASSERT_TRUE(mNodeIndex.Build(mNodeManager).IsNone());
+    }
+
+    nodeinfoprovider::NodeInfoProviderStub mNodeInfoProvider;
+    resourcemanager::ResourceManagerStub   mResourceManager;
+    NiceMock<InstanceRunnerStub>           mInstanceRunner;
+    NodeManager                            mNodeManager;
+    NodeIndex                              mNodeIndex;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(CMNodeIndexTest, Build)
+{
+    AddNode("node1", {CreateRuntime("node1-runc"), CreateRuntime("node1-crun", "crun")}, 10);
+    AddNode("node2", {CreateRuntime("node2-runc")}, 20);
+    AddNode("node3", {CreateRuntime("node3-runc")}, 10);
+
+    ASSERT_TRUE(mNodeManager.Start().IsNone());
+
+    BuildIndex();
+
+    const auto& nodes = mNodeIndex.GetNodes();
+
+    ASSERT_EQ(nodes.Size(), 3);
+    EXPECT_EQ(nodes[0]->GetInfo().mNodeID, "node2");
+    EXPECT_EQ(nodes[1]->GetInfo().mNodeID, "node1");
+    EXPECT_EQ(nodes[2]->GetInfo().mNodeID, "node3");
+
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, mNodeIndex.GetAll()),
+        std::vector<std::string>({"node2-runc", "node1-runc", "node1-crun", "node3-runc"}));
+
+    for (const auto& entry : mNodeIndex.GetEntries()) {
+        EXPECT_TRUE(entry.mNode->GetInfo().mRuntimes.Find(*entry.mRuntime) != entry.mNode->GetInfo().mRuntimes.end());
+    }
+
+    ASSERT_TRUE(mNodeManager.Stop().IsNone());
+}
+
+TEST_F(CMNodeIndexTest, Lookup)
+{
+    AddNode("node1", {CreateRuntime("node1-runc"), CreateRuntime("node1-crun", "crun", "arm64")}, 0, {"label1"});
+    AddNode("node2", {CreateRuntime("node2-runc")}, 0, {"label2"});
+    AddNode("node3", {CreateRuntime("node3-runc"), CreateRuntime("node3-crun", "crun")}, 0, {"label1"});
+
+    ASSERT_TRUE(mNodeManager.Start().IsNone());
+
+    BuildIndex();
+
+    // Node filter is called once per node.
+    auto entries  = mNodeIndex.GetAll();
+    auto numCalls = 0;
+
+    mNodeIndex.FilterNodes(entries, [&numCalls](const Node& node) {
+        numCalls++;
+
+        return node.GetInfo().mNodeID != "node2";
+    });
+
+    EXPECT_EQ(numCalls, 3);
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, entries),
+        std::vector<std::string>({"node1-runc", "node1-crun", "node3-runc", "node3-crun"}));
+
+    // Label filter is called once per distinct labels.
+    entries  = mNodeIndex.GetAll();
+    numCalls = 0;
+
+    mNodeIndex.FilterLabels(entries, [&numCalls](const LabelsArray& labels) {
+        numCalls++;
+
+        return labels.Find("label2") != labels.end();
+    });
+
+    EXPECT_EQ(numCalls, 2);
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, entries), std::vector<std::string>({"node2-runc"}));
+
+    // Runtime type filter is called once per distinct runtime type.
+    entries  = mNodeIndex.GetAll();
+    numCalls = 0;
+
+    mNodeIndex.FilterRuntimeTypes(entries, [&numCalls](const RuntimeInfo& runtime) {
+        numCalls++;
+
+        return runtime.mRuntimeType == "crun";
+    });
+
+    EXPECT_EQ(numCalls, 2);
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, entries), std::vector<std::string>({"node1-crun", "node3-crun"}));
+
+    // Platform filter is applied to entries already filtered: groups without remaining entries are skipped.
+    numCalls = 0;
+
+    mNodeIndex.FilterPlatforms(entries, [&numCalls](const PlatformInfo& platform) {
+        numCalls++;
+
+        return platform.mArchInfo.mArchitecture == "arm64";
+    });
+
+    EXPECT_EQ(numCalls, 2);
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, entries), std::vector<std::string>({"node1-crun"}));
+
+    // Entry filter is called once per remaining entry.
+    numCalls = 0;
+
+    mNodeIndex.FilterEntries(entries, [&numCalls](const NodeIndex::Entry& entry) {
+        numCalls++;
+
+        return entry.mNode->GetInfo().mNodeID != "node1";
+    });
+
+    EXPECT_EQ(numCalls, 1);
+    EXPECT_TRUE(entries.IsEmpty());
+
+    ASSERT_TRUE(mNodeManager.Stop().IsNone());
+}
+
+TEST_F(CMNodeIndexTest, UpdateAndRemoveNodes)
+{
+    AddNode("node1", {CreateRuntime("node1-runc")});
+    AddNode("node2", {CreateRuntime("node2-runc")});
+
+    ASSERT_TRUE(mNodeManager.Start().IsNone());
+
+    BuildIndex();
+
+    EXPECT_EQ(
+        GetEntryRuntimes(mNodeIndex, mNodeIndex.GetAll()), std::vector<std::string>({"node1-runc", "node2-runc"}));
+
+    // Update node runtimes and add new node.
+    auto nodeInfo = CreateNodeInfo("node1", {CreateRuntime("node1-runc"), CreateRuntime("node1-crun", "crun")});
+
+    EXPECT_TRUE(mNodeManager.UpdateNodeInfo(*nodeInfo));
+
+    AddNode("node3", {CreateRuntime("node3-runc")});
+
+    nodeInfo = CreateNodeInfo("node3", {CreateRuntime("node3-runc")});
+
+    EXPECT_TRUE(mNodeManager.UpdateNodeInfo(*nodeInfo));
+
+    BuildIndex();
+
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, mNodeIndex.GetAll()),
+        std::vector<std::string>({"node1-runc", "node1-crun", "node2-runc", "node3-runc"}));
+
+    // Remove node: entries and groups of removed node are not indexed anymore.
+    nodeInfo = CreateNodeInfo("node1", {}, NodeStateEnum::eUnprovisioned);
+
+    EXPECT_TRUE(mNodeManager.UpdateNodeInfo(*nodeInfo));
+
+    BuildIndex();
+
+    EXPECT_EQ(mNodeIndex.GetNodes().Size(), 2);
+    EXPECT_EQ(
+        GetEntryRuntimes(mNodeIndex, mNodeIndex.GetAll()), std::vector<std::string>({"node2-runc", "node3-runc"}));
+
+    auto entries  = mNodeIndex.GetAll();
+    auto numCalls = 0;
+
+    mNodeIndex.FilterRuntimeTypes(entries, [&numCalls](const RuntimeInfo&) {
+        numCalls++;
+
+        return true;
+    });
+
+    EXPECT_EQ(numCalls, 1);
+
+    ASSERT_TRUE(mNodeManager.Stop().IsNone());
+}
+
+TEST_F(CMNodeIndexTest, Capacity)
+{
+    for (size_t i = 0; i < cMaxNumNodes; i++) {
+        std::vector<RuntimeInfo> runtimes;
+
+        for (size_t j = 0; j < cMaxNumNodeRuntimes; j++) {
+            runtimes.push_back(CreateRuntime("node" + std::to_string(i) + "-runtime" + std::to_string(j),
+                "type" + std::to_string(j), "arch" + std::to_string(i)));
+        }
+
+        AddNode("node" + std::to_string(i), runtimes);
+    }
+
+    ASSERT_TRUE(mNodeManager.Start().IsNone());
+
+    BuildIndex();
+
+    ASSERT_EQ(mNodeIndex.GetNodes().Size(), cMaxNumNodes);
+    ASSERT_EQ(mNodeIndex.GetEntries().Size(), NodeIndex::cMaxNumEntries);
+
+    for (size_t i = 0; i < NodeIndex::cMaxNumEntries; i++) {
+        EXPECT_TRUE(mNodeIndex.GetAll().Test(i));
+    }
+
+    // Keep only the last entry to check the set boundary.
+    const auto& lastEntry       = mNodeIndex.GetEntries()[NodeIndex::cMaxNumEntries - 1];
+    const auto  lastRuntimeType = "type" + std::to_string(cMaxNumNodeRuntimes - 1);
+    auto        entries         = mNodeIndex.GetAll();
+
+    mNodeIndex.FilterNodes(entries, [&lastEntry](const Node& node) { return &node == lastEntry.mNode; });
+    mNodeIndex.FilterRuntimeTypes(entries,
+        [&lastRuntimeType](const RuntimeInfo& runtime) { return runtime.mRuntimeType == lastRuntimeType.c_str(); });
+
+    EXPECT_EQ(GetEntryRuntimes(mNodeIndex, entries), std::vector<std::string>({lastEntry.mRuntime->mRuntimeID.CStr()}));
+
+    ASSERT_TRUE(mNodeManager.Stop().IsNone());
+}
+
+} // namespace aos::cm::launcher
@@ -33,6 +33,7 @@ public:
         mImageConfigs.clear();
         mItemConfigs.clear();
         mKnownDigests.clear();
+        mNumItemConfigLoads.clear();
     }
 
     void AddItem(const String& itemID, const String& imageID, const oci::ItemConfig& itemCfg,
@@ -65,6 +66,16 @@ public:
         return digest;
     }
 
+    size_t GetNumItemConfigLoads(const String& itemID, const String& imageID) const
+    {
+        auto it = mNumItemConfigLoads.find(MakeDigest(itemID, imageID, "item"));
+        if (it == mNumItemConfigLoads.end()) {
+            return 0;
+        }
+
+        return it->second;
+    }
+
     static StaticString<oci::cDigestLen> BuildManifestDigest(const String& itemID, const String& imageID)
     {
         StaticString<oci::cDigestLen> digest;
@@ -156,6 +167,8 @@ public:
             return ErrorEnum::eNotFound;
         }
 
+        mNumItemConfigLoads[path.CStr()]++;
+
         itemConfig = it->second;
         return ErrorEnum::eNone;
     }
@@ -226,6 +239,7 @@ private:
     std::map<std::string, oci::ImageConfig>   mImageConfigs;
     std::map<std::string, oci::ItemConfig>    mItemConfigs;
     std::set<std::string>                     mKnownDigests;
+    std::map<std::string, size_t>             mNumItemConfigLoads;
 };
 
 } // namespace aos::cm::imagemanager
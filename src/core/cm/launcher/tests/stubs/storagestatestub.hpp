@@ -7,6 +7,7 @@
 #ifndef AOS_CM_LAUNCHER_STUBS_STORAGESTATESTUB_HPP_
 #define AOS_CM_LAUNCHER_STUBS_STORAGESTATESTUB_HPP_
 
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -28,6 +29,7 @@ public:
         mRemovedInstances.clear();
         mCleanedInstances.clear();
         mCheckSums.clear();
+        mSetupCallback = nullptr;
     }
 
     void SetInstanceCheckSum(const InstanceIdent& instanceIdent, const Array<uint8_t>& checkSum)
@@ -35,6 +37,7 @@ public:
         mCheckSums[instanceIdent] = checkSum;
     }
 
+    void SetSetupCallback(std::function<void()> callback) { mSetupCallback = std::move(callback); }
     void SetTotalStateSize(size_t size) { mTotalStateSize = size; }
     void SetTotalStorageSize(size_t size) { mTotalStorageSize = size; }
 
@@ -52,6 +55,10 @@ public:
     Error Setup(const InstanceIdent& instanceIdent, const SetupParams& setupParams, String& storagePath,
         String& statePath) override
     {
+        if (mSetupCallback) {
+            mSetupCallback();
+        }
+
         mInstances[instanceIdent] = setupParams;
         storagePath               = "storage_path";
         statePath                 = "state_path";
@@ -98,6 +105,7 @@ private:
     std::map<InstanceIdent, StaticArray<uint8_t, crypto::cSHA256Size>> mCheckSums;
     size_t                                                             mTotalStateSize   = 1024;
     size_t                                                             mTotalStorageSize = 1024;
+    std::function<void()>                                              mSetupCallback;
 };
 
 } // namespace aos::cm::storagestate
@@ -24,6 +24,8 @@ public:
         mInstanceInfo.clear();
         mOverrideEnvVarsRequest->mItems.Clear();
         mRunRequests.clear();
+        mCommittedInstanceInfo.reset();
+        mCrashOnCommit = false;
 
         for (const auto& instance : instances) {
             mInstanceInfo[StorageKey {instance.mInstanceIdent, std::string(instance.mVersion.CStr())}] = instance;
@@ -82,6 +84,21 @@ public:
         return Error();
     }
 
+    Error VisitInstances(const InstanceFilter& filter, InstanceInfoVisitorItf& visitor) const override
+    {
+        for (const auto& pair : mInstanceInfo) {
+            if (!filter.Match(pair.second)) {
+                continue;
+            }
+
+            if (auto err = visitor.Visit(pair.second); !err.IsNone()) {
+                return err;
+            }
+        }
+
+        return Error();
+    }
+
     Error LoadOverrideEnvVars(OverrideEnvVarsRequest& envVars) const override
     {
         envVars = *mOverrideEnvVarsRequest;
@@ -109,6 +126,39 @@ public:
         return ErrorEnum::eNone;
     }
 
+    Error BeginTransaction() override
+    {
+        if (mCommittedInstanceInfo) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "transaction already started"));
+        }
+
+        mCommittedInstanceInfo = std::make_unique<InstanceInfoMap>(mInstanceInfo);
+
+        return Error();
+    }
+
+    Error CommitTransaction() override
+    {
+        if (!mCommittedInstanceInfo) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "transaction not started"));
+        }
+
+        auto committedInstanceInfo = std::move(mCommittedInstanceInfo);
+
+        // Simulates crash during commit: all changes of the transaction are lost.
+        if (mCrashOnCommit) {
+            mInstanceInfo = std::move(*committedInstanceInfo);
+
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "crash on commit"));
+        }
+
+        return Error();
+    }
+
+    void SetCrashOnCommit(bool crashOnCommit) { mCrashOnCommit = crashOnCommit; }
+
+    bool IsInTransaction() const { return mCommittedInstanceInfo != nullptr; }
+
     bool HasInstance(const InstanceIdent& instanceID, const String& version) const
     {
         return mInstanceInfo.find(StorageKey {instanceID, std::string(version.CStr())}) != mInstanceInfo.end();
@@ -117,11 +167,14 @@ public:
     void ClearInstances() { mInstanceInfo.clear(); }
 
 private:
-    using StorageKey = std::pair<InstanceIdent, std::string>;
+    using StorageKey      = std::pair<InstanceIdent, std::string>;
+    using InstanceInfoMap = std::map<StorageKey, InstanceInfo>;
 
-    std::map<StorageKey, InstanceInfo>      mInstanceInfo;
+    InstanceInfoMap                         mInstanceInfo;
+    std::unique_ptr<InstanceInfoMap>        mCommittedInstanceInfo;
     std::unique_ptr<OverrideEnvVarsRequest> mOverrideEnvVarsRequest = std::make_unique<OverrideEnvVarsRequest>();
     std::vector<RunInstanceRequest>         mRunRequests;
+    bool                                    mCrashOnCommit {};
 };
 
 } // namespace aos::cm::launcher
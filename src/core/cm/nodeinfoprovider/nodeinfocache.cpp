@@ -94,7 +94,21 @@ bool NodeInfoCache::IsConnected() const
 
 bool NodeInfoCache::IsReady() const
 {
-    return IsConnected() || Time::Now().Sub(mLastUpdate) > mWaitTimeout;
+    return GetTimeToReady() == 0;
+}
+
+Duration NodeInfoCache::GetTimeToReady() const
+{
+    if (IsConnected()) {
+        return 0;
+    }
+
+    if (auto elapsed = Time::Now().Sub(mLastUpdate); elapsed <= mWaitTimeout) {
+        // Ready strictly after wait timeout.
+        return mWaitTimeout - elapsed + Time::cNanoseconds;
+    }
+
+    return 0;
 }
 
 /***********************************************************************************************************************
@@ -92,6 +92,13 @@ public:
      */
     bool IsReady() const;
 
+    /**
+     * Returns time left until node info becomes ready by wait timeout.
+     *
+     * @return Duration.
+     */
+    Duration GetTimeToReady() const;
+
 private:
     void SetNodeInfo(UnitNodeInfo& info) const;
     void SetSMInfo(UnitNodeInfo& info) const;
@@ -83,6 +83,7 @@ Error NodeInfoProvider::Stop()
         }
 
         mCache.Clear();
+        mNotificationQueue.Clear();
 
         if (auto err = mNodeInfoProvider->UnsubscribeListener(*this); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
@@ -143,7 +144,7 @@ Error NodeInfoProvider::SubscribeListener(nodeinfoprovider::NodeInfoListenerItf&
 
 Error NodeInfoProvider::UnsubscribeListener(nodeinfoprovider::NodeInfoListenerItf& listener)
 {
-    LockGuard lock {mMutex};
+    UniqueLock lock {mMutex};
 
     LOG_DBG() << "Unsubscribe node info listener";
 
@@ -151,7 +152,7 @@ Error NodeInfoProvider::UnsubscribeListener(nodeinfoprovider::NodeInfoListenerIt
         return ErrorEnum::eNotFound;
     }
 
-    return ErrorEnum::eNone;
+    return mCondVar.Wait(lock, [this]() { return !mNotifying; });
 }
 
 void NodeInfoProvider::OnSMConnected(const String& nodeID)
@@ -247,48 +248,86 @@ NodeInfoCache* NodeInfoProvider::AddOrGetCacheItem(const String& nodeID)
     return &mCache.Back();
 }
 
-void NodeInfoProvider::NotifyListeners(const NodeInfoCache& info)
+NodeInfoCache* NodeInfoProvider::GetReadyNotification(Optional<Duration>& timeToReady)
+{
+    timeToReady.Reset();
+
+    for (const auto& notification : mNotificationQueue) {
+        auto it = mCache.FindIf([&notification](const auto& info) { return info.GetNodeID() == notification.mNodeID; });
+        if (it == mCache.end()) {
+            continue;
+        }
+
+        if (notification.mImmediate) {
+            return it;
+        }
+
+        auto duration = it->GetTimeToReady();
+        if (duration == 0) {
+            return it;
+        }
+
+        if (!timeToReady.HasValue() || duration < *timeToReady) {
+            timeToReady.SetValue(duration);
+        }
+    }
+
+    return nullptr;
+}
+
+void NodeInfoProvider::NotifyListeners(UniqueLock<>& lock, const NodeInfoCache& info)
 {
     auto unitNodeInfo = MakeUnique<UnitNodeInfo>(&mAllocator);
+    auto listeners    = mListeners;
 
     info.GetUnitNodeInfo(*unitNodeInfo);
 
+    mNotificationQueue.RemoveIf(
+        [&info](const auto& notification) { return notification.mNodeID == info.GetNodeID(); });
+
+    // Listeners are notified from the snapshot without holding the lock, so slow listeners don't block other calls.
+    mNotifying = true;
+
+    lock.Unlock();
+
     LOG_INF() << "Node info changed" << Log::Field("nodeID", unitNodeInfo->mNodeID)
               << Log::Field("state", unitNodeInfo->mState) << Log::Field("isConnected", unitNodeInfo->mIsConnected)
               << Log::Field(unitNodeInfo->mError);
 
-    for (auto* listener : mListeners) {
+    for (auto* listener : listeners) {
         listener->OnNodeInfoChanged(*unitNodeInfo);
     }
 
-    mNotificationQueue.RemoveIf([&info](const auto& nodeID) { return nodeID == info.GetNodeID(); });
+    lock.Lock();
+
+    mNotifying = false;
+    mCondVar.NotifyAll();
 }
 
 Error NodeInfoProvider::SendNotification(const NodeInfoCache& info, bool sendImmediately)
 {
-    if (!sendImmediately && !info.IsConnected()) {
-        if (auto err = ScheduleNotification(info.GetNodeID()); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
-
-        return ErrorEnum::eNone;
+    if (auto err = ScheduleNotification(info.GetNodeID(), sendImmediately || info.IsConnected()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
-    NotifyListeners(info);
-
     return ErrorEnum::eNone;
 }
 
-Error NodeInfoProvider::ScheduleNotification(const String& nodeID)
+Error NodeInfoProvider::ScheduleNotification(const String& nodeID, bool immediate)
 {
-    if (mNotificationQueue.Find(nodeID) == mNotificationQueue.end()) {
-        if (auto err = mNotificationQueue.EmplaceBack(nodeID); !err.IsNone()) {
+    auto it = mNotificationQueue.FindIf([&nodeID](const auto& notification) { return notification.mNodeID == nodeID; });
+    if (it == mNotificationQueue.end()) {
+        if (auto err = mNotificationQueue.EmplaceBack(Notification {nodeID, immediate}); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
+    } else {
+        it->mImmediate = it->mImmediate || immediate;
     }
 
-    LOG_DBG() << "Scheduled notification for node" << Log::Field("nodeID", nodeID);
+    LOG_DBG() << "Scheduled notification for node" << Log::Field("nodeID", nodeID)
+              << Log::Field("immediate", immediate);
 
+    mWakeUp = true;
     mCondVar.NotifyAll();
 
     return ErrorEnum::eNone;
@@ -298,31 +337,24 @@ void NodeInfoProvider::Run()
 {
     LOG_DBG() << "Running notification thread";
 
-    while (true) {
-        {
-            UniqueLock lock {mMutex};
+    UniqueLock lock {mMutex};
 
-            mCondVar.Wait(lock, [this]() { return !mRunning || !mNotificationQueue.IsEmpty(); });
+    while (mRunning) {
+        Optional<Duration> timeToReady;
 
-            if (!mRunning) {
-                return;
-            }
+        if (auto nodeInfo = GetReadyNotification(timeToReady); nodeInfo != nullptr) {
+            NotifyListeners(lock, *nodeInfo);
 
-            for (const auto& nodeInfo : mCache) {
-                if (!mNotificationQueue.Contains(nodeInfo.GetNodeID())) {
-                    continue;
-                }
-
-                if (!nodeInfo.IsReady()) {
-                    LOG_DBG() << "Node info not ready" << Log::Field("nodeID", nodeInfo.GetNodeID());
-
-                    continue;
-                }
+            continue;
+        }
 
-                NotifyListeners(nodeInfo);
-            }
+        mWakeUp = false;
 
-            mCondVar.Wait(lock, mConfig.mSMConnectionTimeout, [this]() { return !mRunning; });
+        // Wait until the earliest pending node becomes ready or the notification queue is changed.
+        if (timeToReady.HasValue()) {
+            mCondVar.Wait(lock, *timeToReady, [this]() { return !mRunning || mWakeUp; });
+        } else {
+            mCondVar.Wait(lock, [this]() { return !mRunning || mWakeUp; });
         }
     }
 }
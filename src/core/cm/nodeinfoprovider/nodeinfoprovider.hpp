@@ -82,6 +82,9 @@ public:
     /**
      * Unsubscribes from node info notifications.
      *
+     * Waits for notification in progress, so the listener is not called after unsubscribe. Shall not be called from
+     * the listener callback.
+     *
      * @param listener node info listener.
      * @return Error.
      */
@@ -115,12 +118,18 @@ private:
     static constexpr auto cAllocatorSize
         = sizeof(UnitNodeInfo) + sizeof(StaticArray<StaticString<cIDLen>, cMaxNumNodes>);
 
+    struct Notification {
+        StaticString<cIDLen> mNodeID;
+        bool                 mImmediate {};
+    };
+
     void OnNodeInfoChanged(const NodeInfo& info) override;
 
     NodeInfoCache* AddOrGetCacheItem(const String& nodeID);
-    void           NotifyListeners(const NodeInfoCache& info);
+    NodeInfoCache* GetReadyNotification(Optional<Duration>& timeToReady);
+    void           NotifyListeners(UniqueLock<>& lock, const NodeInfoCache& info);
     Error          SendNotification(const NodeInfoCache& info, bool sendImmediately = false);
-    Error          ScheduleNotification(const String& nodeID);
+    Error          ScheduleNotification(const String& nodeID, bool immediate);
     void           Run();
 
     mutable Mutex                                                       mMutex;
@@ -128,9 +137,11 @@ private:
     Thread<>                                                            mThread;
     ConditionalVariable                                                 mCondVar;
     bool                                                                mRunning {};
+    bool                                                                mWakeUp {};
+    bool                                                                mNotifying {};
     Config                                                              mConfig;
     StaticArray<NodeInfoCache, cMaxNumNodes>                            mCache;
-    StaticArray<StaticString<cIDLen>, cMaxNumNodes>                     mNotificationQueue;
+    StaticArray<Notification, cMaxNumNodes>                             mNotificationQueue;
     StaticArray<nodeinfoprovider::NodeInfoListenerItf*, cListenersSize> mListeners;
     iamclient::NodeInfoProviderItf*                                     mNodeInfoProvider {};
 };
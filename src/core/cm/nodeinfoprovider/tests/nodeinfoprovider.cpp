@@ -6,6 +6,8 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <future>
+#include <map>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -83,6 +85,72 @@ private:
     std::vector<UnitNodeInfo> mReceivedInfos;
 };
 
+class TimedListenerStub : public NodeInfoListenerItf {
+public:
+    void OnNodeInfoChanged(const UnitNodeInfo& info) override
+    {
+        std::lock_guard lock {mMutex};
+
+        mReceiveTimes.emplace(info.mNodeID.CStr(), std::chrono::steady_clock::now());
+
+        mCondVar.notify_all();
+    }
+
+    bool Wait(const std::string& nodeID, std::chrono::milliseconds timeout, std::chrono::steady_clock::time_point& time)
+    {
+        std::unique_lock lock {mMutex};
+
+        if (!mCondVar.wait_for(lock, timeout, [&]() { return mReceiveTimes.count(nodeID) != 0; })) {
+            return false;
+        }
+
+        time = mReceiveTimes[nodeID];
+
+        return true;
+    }
+
+private:
+    std::mutex                                                   mMutex;
+    std::condition_variable                                      mCondVar;
+    std::map<std::string, std::chrono::steady_clock::time_point> mReceiveTimes;
+};
+
+class BlockingListenerStub : public NodeInfoListenerItf {
+public:
+    void OnNodeInfoChanged(const UnitNodeInfo& info) override
+    {
+        (void)info;
+
+        std::unique_lock lock {mMutex};
+
+        mEntered = true;
+        mCondVar.notify_all();
+
+        mCondVar.wait(lock, [this]() { return mReleased; });
+    }
+
+    bool WaitEntered(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock lock {mMutex};
+
+        return mCondVar.wait_for(lock, timeout, [this]() { return mEntered; });
+    }
+
+    void Release()
+    {
+        std::lock_guard lock {mMutex};
+
+        mReleased = true;
+        mCondVar.notify_all();
+    }
+
+private:
+    std::mutex              mMutex;
+    std::condition_variable mCondVar;
+    bool                    mEntered {};
+    bool                    mReleased {};
+};
+
 } // namespace
 
 /***********************************************************************************************************************
@@ -399,4 +467,94 @@ TEST_F(CMNodeInfoProviderTest, NotifySubscribersOnceSMInfoReceived)
     ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
 }
 
+TEST_F(CMNodeInfoProviderTest, NotifyOnReadyTimeoutWithoutDelay)
+{
+    constexpr auto cMaxLatency = std::chrono::milliseconds(50);
+
+    mConfig.mSMConnectionTimeout = 300 * Time::cMilliseconds;
+
+    const auto cTimeout = std::chrono::milliseconds(mConfig.mSMConnectionTimeout.Milliseconds());
+
+    TimedListenerStub listener;
+
+    auto err = mNodeInfoProvider.Init(mConfig, mIAMNodeInfoProvider);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mNodeInfoProvider.SubscribeListener(listener);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mNodeInfoProvider.Start();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    // SM info without IAM node info makes node not connected, so it is notified once its timeout expires. The second
+    // node is scheduled while the provider waits for the first one.
+    const auto node1Time = std::chrono::steady_clock::now();
+
+    err = mNodeInfoProvider.OnSMInfoReceived(SMInfo {"node1", {}, {}});
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    std::this_thread::sleep_for(cTimeout / 2);
+
+    const auto node2Time = std::chrono::steady_clock::now();
+
+    err = mNodeInfoProvider.OnSMInfoReceived(SMInfo {"node2", {}, {}});
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    const std::array cScheduleTimes = {std::make_pair("node1", node1Time), std::make_pair("node2", node2Time)};
+
+    for (const auto& [nodeID, scheduleTime] : cScheduleTimes) {
+        std::chrono::steady_clock::time_point receiveTime;
+
+        ASSERT_TRUE(listener.Wait(nodeID, 2 * cTimeout, receiveTime)) << "Timeout waiting for " << nodeID;
+
+        const auto latency = receiveTime - (scheduleTime + cTimeout);
+
+        EXPECT_GE(latency, -cMaxLatency) << "Node " << nodeID << " notified before timeout";
+        EXPECT_LT(latency, cMaxLatency) << "Node " << nodeID << " notified with latency "
+                                        << std::chrono::duration_cast<std::chrono::milliseconds>(latency).count()
+                                        << " ms";
+    }
+
+    err = mNodeInfoProvider.Stop();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+}
+
+TEST_F(CMNodeInfoProviderTest, SlowListenerDoesNotBlockGetNodeInfo)
+{
+    const auto cNodeInfo = CreateNodeInfo("node1", NodeStateEnum::eProvisioned, true, false);
+
+    BlockingListenerStub listener;
+
+    mIAMNodeInfoProvider.SetNodeInfo(*cNodeInfo);
+
+    auto err = mNodeInfoProvider.Init(mConfig, mIAMNodeInfoProvider);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mNodeInfoProvider.SubscribeListener(listener);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mNodeInfoProvider.Start();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    ASSERT_TRUE(listener.WaitEntered(std::chrono::seconds(1)));
+
+    auto getNodeInfo = std::async(std::launch::async, [this, &cNodeInfo]() {
+        auto nodeInfo = std::make_unique<UnitNodeInfo>();
+
+        return mNodeInfoProvider.GetNodeInfo(cNodeInfo->mNodeID, *nodeInfo);
+    });
+
+    const auto status = getNodeInfo.wait_for(std::chrono::seconds(1));
+
+    listener.Release();
+
+    ASSERT_EQ(status, std::future_status::ready) << "GetNodeInfo is blocked by listener";
+
+    err = getNodeInfo.get();
+    EXPECT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mNodeInfoProvider.Stop();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+}
+
 } // namespace aos::cm::nodeinfoprovider
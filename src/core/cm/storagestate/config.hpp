@@ -7,6 +7,8 @@
 #ifndef AOS_CORE_CM_STORAGESTATE_CONFIG_HPP_
 #define AOS_CORE_CM_STORAGESTATE_CONFIG_HPP_
 
+#include <core/common/tools/time.hpp>
+
 namespace aos::cm::storagestate {
 
 /**
@@ -15,6 +17,8 @@ namespace aos::cm::storagestate {
 struct Config {
     StaticString<cFilePathLen> mStorageDir;
     StaticString<cFilePathLen> mStateDir;
+    Duration                   mStateChangeQuietPeriod = Time::cMilliseconds * 100;
+    Duration                   mStateChangeMaxDelay    = Time::cSeconds;
 };
 
 } // namespace aos::cm::storagestate
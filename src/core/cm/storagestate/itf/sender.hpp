@@ -36,6 +36,19 @@ public:
      */
     virtual Error SendNewState(const NewState& state) = 0;
 
+    /**
+     * Sends instance's new state delta.
+     *
+     * @param delta new state delta.
+     * @return Error. ErrorEnum::eNotSupported if sender doesn't support state deltas.
+     */
+    virtual Error SendNewStateDelta(const NewStateDelta& delta)
+    {
+        (void)delta;
+
+        return ErrorEnum::eNotSupported;
+    }
+
     /**
      * Destructor.
      */
@@ -33,6 +33,19 @@ public:
      */
     virtual Error UpdateState(const UpdateState& state) = 0;
 
+    /**
+     * Updates storage state with state delta.
+     *
+     * @param delta update state delta.
+     * @return Error. ErrorEnum::eNotSupported if state deltas are not supported, the full state should be sent then.
+     */
+    virtual Error UpdateStateDelta(const UpdateStateDelta& delta)
+    {
+        (void)delta;
+
+        return ErrorEnum::eNotSupported;
+    }
+
     /**
      * Accepts state.
      *
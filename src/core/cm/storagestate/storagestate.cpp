@@ -89,27 +89,49 @@ Error StorageState::Start()
 
     LOG_DBG() << "Start storage state";
 
+    {
+        LockGuard stateChangeLock {mStateChangeMutex};
+
+        mStopped = false;
+        mStateChanges.Clear();
+    }
+
     if (auto err = InitStateWatching(); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    return mThreadPool.Run();
+    if (auto err = mStateChangeThread.Run([this](void*) { ProcessStateChanges(); }); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
 }
 
 Error StorageState::Stop()
 {
+    {
+        LockGuard lock {mStateChangeMutex};
+
+        mStopped = true;
+
+        mStateChangeCondVar.NotifyOne();
+    }
+
+    // Pending state changes are handled before the thread exits.
+    auto err = mStateChangeThread.Join();
+
     LockGuard lock {mMutex};
 
     LOG_DBG() << "Stop storage state";
 
     while (!mStates.IsEmpty()) {
-        if (auto err = StopStateWatching(mStates.Front().mInstanceIdent);
-            !err.IsNone() && !err.Is(ErrorEnum::eNotFound)) {
-            LOG_WRN() << "Failed to stop state watching" << Log::Field(err);
+        if (auto stopErr = StopStateWatching(mStates.Front().mInstanceIdent);
+            !stopErr.IsNone() && !stopErr.Is(ErrorEnum::eNotFound)) {
+            LOG_WRN() << "Failed to stop state watching" << Log::Field(stopErr);
         }
     }
 
-    return mThreadPool.Shutdown();
+    return err;
 }
 
 Error StorageState::UpdateState(const aos::UpdateState& state)
@@ -119,7 +141,7 @@ Error StorageState::UpdateState(const aos::UpdateState& state)
     LOG_DBG() << "Update state" << Log::Field("instanceIdent", static_cast<const InstanceIdent&>(state))
               << Log::Field("size", state.mState.Size());
 
-    auto it = mStates.FindIf([&state](const auto& item) { return item.mInstanceIdent == state; });
+    auto it = FindState(state);
     if (it == mStates.end()) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
@@ -132,25 +154,72 @@ Error StorageState::UpdateState(const aos::UpdateState& state)
         return AOS_ERROR_WRAP(err);
     }
 
-    auto storageStateInfo = MakeUnique<InstanceInfo>(&mAllocator);
-
-    if (auto err = mStorage->GetStorageStateInfo(state, *storageStateInfo); !err.IsNone()) {
+    if (auto err = ApplyState(*it, state.mState, state.mChecksum); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = storageStateInfo->mStateChecksum.Assign(state.mChecksum); !err.IsNone()) {
+    return ErrorEnum::eNone;
+}
+
+Error StorageState::UpdateStateDelta(const aos::UpdateStateDelta& delta)
+{
+    LockGuard lock {mMutex};
+
+    LOG_DBG() << "Update state delta" << Log::Field("instanceIdent", static_cast<const InstanceIdent&>(delta))
+              << Log::Field("size", delta.mSize) << Log::Field("numChunks", delta.mChunks.Size());
+
+    auto it = FindState(delta);
+    if (it == mStates.end()) {
+        return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
+    }
+
+    if (delta.mSize > it->mQuota || delta.mSize > cStateLen) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "update state exceeds quota"));
+    }
+
+    auto content = MakeUnique<StaticString<cStateLen>>(&mAllocator);
+
+    if (auto err = fs::ReadFileToString(it->mFilePath, *content); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = mStorage->UpdateStorageStateInfo(*storageStateInfo); !err.IsNone()) {
+    if (auto err = ValidateChecksum(*content, delta.mBaseChecksum); !err.IsNone()) {
+        return AOS_ERROR_WRAP(Error(err, "base state mismatch"));
+    }
+
+    if (auto err = content->Resize(delta.mSize); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = fs::WriteStringToFile(it->mFilePath, state.mState, S_IRUSR | S_IWUSR); !err.IsNone()) {
+    size_t dataOffset = 0;
+
+    for (auto chunk : delta.mChunks) {
+        auto offset = chunk * cStateChunkSize;
+
+        if (offset >= delta.mSize) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "state chunk out of range"));
+        }
+
+        auto size = Min(cStateChunkSize, delta.mSize - offset);
+
+        if (dataOffset + size > delta.mData.Size()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "state delta data too short"));
+        }
+
+        memcpy(content->Get() + offset, delta.mData.Get() + dataOffset, size);
+
+        dataOffset += size;
+    }
+
+    if (dataOffset != delta.mData.Size()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "state delta data too long"));
+    }
+
+    if (auto err = ValidateChecksum(*content, delta.mChecksum); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = it->mChecksum.Assign(state.mChecksum); !err.IsNone()) {
+    if (auto err = ApplyState(*it, *content, delta.mChecksum); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
@@ -164,7 +233,7 @@ Error StorageState::AcceptState(const StateAcceptance& state)
     LOG_DBG() << "State acceptance" << Log::Field("instanceIdent", static_cast<const InstanceIdent&>(state))
               << Log::Field("reason", state.mReason);
 
-    auto it = mStates.FindIf(([&state](const auto& item) { return item.mInstanceIdent == state; }));
+    auto it = FindState(state);
     if (it == mStates.end()) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
@@ -289,7 +358,7 @@ Error StorageState::GetInstanceCheckSum(const InstanceIdent& instanceIdent, Arra
 
     LOG_DBG() << "Get instance checksum" << Log::Field("instanceIdent", instanceIdent);
 
-    auto it = mStates.FindIf([&instanceIdent](const auto& item) { return item.mInstanceIdent == instanceIdent; });
+    auto it = FindState(instanceIdent);
     if (it == mStates.end()) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
@@ -312,6 +381,28 @@ bool StorageState::IsSamePartition() const
     return mStateAndStorageOnSamePartition;
 }
 
+StateChangeStats StorageState::GetStateChangeStats() const
+{
+    StateChangeStats stats;
+
+    {
+        LockGuard lock {mStateChangeMutex};
+
+        stats.mReceivedEvents = mReceivedEvents;
+        stats.mMergedEvents   = mMergedEvents;
+    }
+
+    {
+        LockGuard lock {mMutex};
+
+        stats.mSentStates      = mSentStates;
+        stats.mUnchangedStates = mUnchangedStates;
+        stats.mSentDeltas      = mSentDeltas;
+    }
+
+    return stats;
+}
+
 /***********************************************************************************************************************
  * Private
  **********************************************************************************************************************/
@@ -320,27 +411,88 @@ void StorageState::OnFSEvent(const String& path, const Array<fs::FSEvent>& event
 {
     (void)events;
 
-    StaticString<cFilePathLen> statePath = path;
+    LockGuard lock {mStateChangeMutex};
+
+    auto now = Time::Now(cEventClockID);
+
+    mReceivedEvents++;
+
+    auto it = mStateChanges.FindIf([&path](const auto& change) { return change.mPath == path; });
+    if (it != mStateChanges.end()) {
+        it->mLastEventTime = now;
+        mMergedEvents++;
+
+        return;
+    }
+
+    if (auto err = mStateChanges.PushBack({path, now, now}); !err.IsNone()) {
+        LOG_ERR() << "Failed handling file system event" << Log::Field("path", path) << Log::Field(err);
+
+        return;
+    }
+
+    mStateChangeCondVar.NotifyOne();
+}
 
-    if (auto err = mThreadPool.AddTask([this, statePath](void*) {
-            LockGuard lock {mMutex};
+void StorageState::ProcessStateChanges()
+{
+    while (true) {
+        StaticString<cFilePathLen> path;
 
-            LOG_DBG() << "Handle file system event" << Log::Field("path", statePath);
+        {
+            UniqueLock lock {mStateChangeMutex};
 
-            auto it = mStates.FindIf([&statePath](const auto& state) { return state.mFilePath == statePath; });
-            if (it == mStates.end()) {
-                LOG_WRN() << "Error processing state change" << Log::Field("path", statePath)
-                          << Log::Field(ErrorEnum::eNotFound);
+            mStateChangeCondVar.Wait(lock, [this] { return mStopped || !mStateChanges.IsEmpty(); });
 
+            if (mStateChanges.IsEmpty()) {
                 return;
             }
 
-            if (auto err = SendNewStateIfFileChanged(*it); !err.IsNone()) {
-                LOG_ERR() << "Failed notifying state change" << Log::Field("path", statePath) << Log::Field(err);
+            auto now  = Time::Now(cEventClockID);
+            auto next = mStateChanges.begin();
+            auto due  = Time();
+
+            for (auto it = mStateChanges.begin(); it != mStateChanges.end(); ++it) {
+                auto quietTime = it->mLastEventTime.Add(mConfig.mStateChangeQuietPeriod);
+                auto maxTime   = it->mFirstEventTime.Add(mConfig.mStateChangeMaxDelay);
+                auto itDue     = quietTime < maxTime ? quietTime : maxTime;
+
+                if (it == mStateChanges.begin() || itDue < due) {
+                    next = it;
+                    due  = itDue;
+                }
             }
-        });
-        !err.IsNone()) {
-        LOG_ERR() << "Failed handling file system event" << Log::Field("path", path) << Log::Field(err);
+
+            // Handle pending changes right away on stop.
+            if (!mStopped && now < due) {
+                mStateChangeCondVar.Wait(lock, due.Sub(now));
+
+                continue;
+            }
+
+            path = next->mPath;
+            mStateChanges.Erase(next);
+        }
+
+        HandleStateChange(path);
+    }
+}
+
+void StorageState::HandleStateChange(const String& path)
+{
+    LockGuard lock {mMutex};
+
+    LOG_DBG() << "Handle state change" << Log::Field("path", path);
+
+    auto it = FindStateByPath(path);
+    if (it == mStates.end()) {
+        LOG_WRN() << "Error processing state change" << Log::Field("path", path) << Log::Field(ErrorEnum::eNotFound);
+
+        return;
+    }
+
+    if (auto err = SendNewStateIfFileChanged(*it); !err.IsNone()) {
+        LOG_ERR() << "Failed notifying state change" << Log::Field("path", path) << Log::Field(err);
     }
 }
 
@@ -410,7 +562,7 @@ Error StorageState::PrepareState(const InstanceIdent& instanceIdent, const Setup
         }
     });
 
-    auto itState = mStates.FindIf([&instanceIdent](const auto& item) { return item.mInstanceIdent == instanceIdent; });
+    auto itState = FindState(instanceIdent);
     if (itState == mStates.end()) {
         err = AOS_ERROR_WRAP(ErrorEnum::eNotFound);
 
@@ -465,7 +617,7 @@ Error StorageState::PrepareStorage(
     return ErrorEnum::eNone;
 }
 
-Error StorageState::CheckChecksumAndSendUpdateRequest(const State& state)
+Error StorageState::CheckChecksumAndSendUpdateRequest(State& state)
 {
     LOG_DBG() << "Check checksum and send update request" << state;
 
@@ -482,6 +634,12 @@ Error StorageState::CheckChecksumAndSendUpdateRequest(const State& state)
     }
 
     if (state.mChecksum == calculatedChecksum) {
+        if (auto err = CalculateChunkHashes(*stateContent, state.mChunkHashes); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        state.mChunkHashesValid = true;
+
         return ErrorEnum::eNone;
     }
 
@@ -522,22 +680,34 @@ Error StorageState::StartStateWatching(const InstanceIdent& instanceIdent, const
         return err;
     }
 
-    return mStates.EmplaceBack(instanceIdent, path, quota);
+    if (auto err = mStates.EmplaceBack(instanceIdent, path, quota); !err.IsNone()) {
+        return err;
+    }
+
+    return IndexState(mStates.Size() - 1);
 }
 
 Error StorageState::StopStateWatching(const InstanceIdent& instanceIdent)
 {
     LOG_DBG() << "Stop state watching" << instanceIdent;
 
-    auto it = mStates.FindIf([&instanceIdent](const auto& item) { return item.mInstanceIdent == instanceIdent; });
+    auto it = FindState(instanceIdent);
     if (it == mStates.end()) {
         return ErrorEnum::eNone;
     }
 
     auto err = mFSWatcher->Unsubscribe(it->mFilePath.CStr(), *this);
 
+    {
+        LockGuard lock {mStateChangeMutex};
+
+        mStateChanges.RemoveIf([&it](const auto& change) { return change.mPath == it->mFilePath; });
+    }
+
     mStates.Erase(it);
 
+    RebuildStateIndex();
+
     return err;
 }
 
@@ -578,22 +748,136 @@ Error StorageState::SendNewStateIfFileChanged(State& state)
         return AOS_ERROR_WRAP(err);
     }
 
+    ChunkHashes chunkHashes;
+
+    if (auto err = CalculateChunkHashes(newState->mState, chunkHashes); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     if (auto err = CalculateChecksum(newState->mState, newState->mChecksum); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
     if (state.mChecksum == newState->mChecksum) {
+        state.mChunkHashes      = chunkHashes;
+        state.mChunkHashesValid = true;
+
+        mUnchangedStates++;
+
         return ErrorEnum::eNone;
     }
 
+    if (state.mChunkHashesValid && !mDeltaNotSupported) {
+        auto err = SendNewStateDelta(state, *newState, chunkHashes);
+        if (err.IsNone()) {
+            mSentDeltas++;
+
+            return ErrorEnum::eNone;
+        }
+
+        if (!err.Is(ErrorEnum::eNotSupported)) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
     if (auto err = state.mChecksum.Assign(newState->mChecksum); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
+    state.mChunkHashes      = chunkHashes;
+    state.mChunkHashesValid = true;
+
     if (auto err = mMessageSender->SendNewState(*newState); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
+    mSentStates++;
+
+    return ErrorEnum::eNone;
+}
+
+Error StorageState::SendNewStateDelta(State& state, const NewState& newState, const ChunkHashes& chunkHashes)
+{
+    auto delta = MakeUnique<NewStateDelta>(&mAllocator);
+
+    static_cast<InstanceIdent&>(*delta) = state.mInstanceIdent;
+    delta->mBaseChecksum                = state.mChecksum;
+    delta->mChecksum                    = newState.mChecksum;
+    delta->mSize                        = newState.mState.Size();
+
+    for (size_t i = 0; i < chunkHashes.Size(); i++) {
+        if (i < state.mChunkHashes.Size() && state.mChunkHashes[i] == chunkHashes[i]) {
+            continue;
+        }
+
+        auto offset = i * cStateChunkSize;
+        auto size   = Min(cStateChunkSize, newState.mState.Size() - offset);
+
+        if (auto err = delta->mChunks.PushBack(i); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (auto err = delta->mData.Insert(
+                delta->mData.end(), newState.mState.begin() + offset, newState.mState.begin() + offset + size);
+            !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    // Full state is sent if delta doesn't save anything or chunk hashes don't detect the change.
+    if (delta->mChunks.IsEmpty() || delta->mData.Size() >= newState.mState.Size()) {
+        return ErrorEnum::eNotSupported;
+    }
+
+    LOG_DBG() << "Send new state delta" << Log::Field("instanceIdent", state.mInstanceIdent)
+              << Log::Field("numChunks", delta->mChunks.Size()) << Log::Field("size", delta->mData.Size());
+
+    if (auto err = mMessageSender->SendNewStateDelta(*delta); !err.IsNone()) {
+        if (err.Is(ErrorEnum::eNotSupported)) {
+            LOG_DBG() << "State delta is not supported by sender";
+
+            mDeltaNotSupported = true;
+        }
+
+        return err;
+    }
+
+    if (auto err = state.mChecksum.Assign(newState.mChecksum); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    state.mChunkHashes = chunkHashes;
+
+    return ErrorEnum::eNone;
+}
+
+Error StorageState::ApplyState(State& state, const String& content, const Array<uint8_t>& checksum)
+{
+    auto storageStateInfo = MakeUnique<InstanceInfo>(&mAllocator);
+
+    if (auto err = mStorage->GetStorageStateInfo(state.mInstanceIdent, *storageStateInfo); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = storageStateInfo->mStateChecksum.Assign(checksum); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = mStorage->UpdateStorageStateInfo(*storageStateInfo); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = fs::WriteStringToFile(state.mFilePath, content, S_IRUSR | S_IWUSR, fs::Durability::Data);
+        !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = state.mChecksum.Assign(checksum); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    state.mChunkHashesValid = CalculateChunkHashes(content, state.mChunkHashes).IsNone();
+
     return ErrorEnum::eNone;
 }
 
@@ -687,4 +971,66 @@ Error StorageState::CalculateChecksum(const String& data, Array<uint8_t>& checks
     return ErrorEnum::eNone;
 }
 
+Error StorageState::CalculateChunkHashes(const String& data, ChunkHashes& chunkHashes)
+{
+    chunkHashes.Clear();
+
+    for (size_t offset = 0; offset < data.Size(); offset += cStateChunkSize) {
+        auto hash = FNVHash(data.CStr() + offset, Min(cStateChunkSize, data.Size() - offset));
+
+        if (auto err = chunkHashes.PushBack(hash); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+StorageState::State* StorageState::FindState(const InstanceIdent& instanceIdent)
+{
+    auto [position, err] = mStateIndex.Find(
+        instanceIdent.Hash(), [this, &instanceIdent](size_t i) { return mStates[i].mInstanceIdent == instanceIdent; });
+    if (!err.IsNone()) {
+        return mStates.end();
+    }
+
+    return &mStates[position];
+}
+
+StorageState::State* StorageState::FindStateByPath(const String& path)
+{
+    auto [position, err]
+        = mPathIndex.Find(FNVHash(path), [this, &path](size_t i) { return mStates[i].mFilePath == path; });
+    if (!err.IsNone()) {
+        return mStates.end();
+    }
+
+    return &mStates[position];
+}
+
+Error StorageState::IndexState(size_t position)
+{
+    if (auto err = mStateIndex.Add(mStates[position].mInstanceIdent.Hash(), position); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = mPathIndex.Add(FNVHash(mStates[position].mFilePath), position); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+void StorageState::RebuildStateIndex()
+{
+    mStateIndex.Clear();
+    mPathIndex.Clear();
+
+    for (size_t i = 0; i < mStates.Size(); i++) {
+        if (auto err = IndexState(i); !err.IsNone()) {
+            LOG_ERR() << "Failed to index state" << Log::Field("path", mStates[i].mFilePath) << Log::Field(err);
+        }
+    }
+}
+
 } // namespace aos::cm::storagestate
@@ -9,6 +9,7 @@
 
 #include <core/common/crypto/itf/hash.hpp>
 #include <core/common/tools/fs.hpp>
+#include <core/common/tools/hashindex.hpp>
 #include <core/common/tools/memory.hpp>
 #include <core/common/tools/thread.hpp>
 
@@ -24,8 +25,39 @@ namespace aos::cm::storagestate {
  *  @{
  */
 
+/**
+ * State change statistics.
+ */
+struct StateChangeStats {
+    size_t mReceivedEvents {};
+    size_t mMergedEvents {};
+    size_t mSentStates {};
+    size_t mUnchangedStates {};
+    size_t mSentDeltas {};
+
+    /**
+     * Compares state change statistics.
+     *
+     * @param rhs object to compare with.
+     * @return bool.
+     */
+    bool operator==(const StateChangeStats& rhs) const
+    {
+        return mReceivedEvents == rhs.mReceivedEvents && mMergedEvents == rhs.mMergedEvents
+            && mSentStates == rhs.mSentStates && mUnchangedStates == rhs.mUnchangedStates
+            && mSentDeltas == rhs.mSentDeltas;
+    }
+};
+
 /**
  * Storage state.
+ *
+ * File system events of state file are coalesced per instance: state is read, hashed and sent once no new event has
+ * been received for the configured quiet period, but not later than the configured max delay after the first event.
+ *
+ * State is split into chunks of cStateChunkSize bytes. Chunk hashes of the last sent or received state are cached, so
+ * unchanged state is detected without computing the state checksum and only changed chunks are sent as state delta if
+ * sender supports it.
  */
 class StorageState : public StateHandlerItf,
                      public StorageStateItf,
@@ -68,6 +100,14 @@ public:
      */
     Error UpdateState(const aos::UpdateState& state) override;
 
+    /**
+     * Updates storage state with state delta.
+     *
+     * @param delta update state delta.
+     * @return Error.
+     */
+    Error UpdateStateDelta(const aos::UpdateStateDelta& delta) override;
+
     /**
      * Accepts state.
      *
@@ -134,6 +174,13 @@ public:
      */
     bool IsSamePartition() const override;
 
+    /**
+     * Returns state change statistics.
+     *
+     * @return StateChangeStats.
+     */
+    StateChangeStats GetStateChangeStats() const;
+
     /**
      * Destructor.
      */
@@ -141,11 +188,12 @@ public:
 
 private:
     static constexpr auto cStateFilename          = "state.dat";
-    static constexpr auto cStateChangeTimeout     = Time::cSeconds * 1;
-    static constexpr auto cHashAlgorithm          = crypto::HashEnum::eSHA3_224;
-    static constexpr auto cNumSendNewStateThreads = 1;
-    static constexpr auto cInstanceStringLen      = 8;
-    static constexpr auto cAllocatorSize          = sizeof(InstanceInfoArray) + sizeof(NewState);
+    static constexpr auto cHashAlgorithm     = crypto::HashEnum::eSHA3_224;
+    static constexpr auto cInstanceStringLen = 8;
+    static constexpr auto cAllocatorSize     = sizeof(InstanceInfoArray) + sizeof(NewState) + sizeof(NewStateDelta);
+    static constexpr auto cEventClockID      = CLOCK_MONOTONIC;
+
+    using ChunkHashes = StaticArray<uint64_t, cMaxNumStateChunks>;
 
     struct State {
         State(const InstanceIdent& instanceIdent, const String& filePath, size_t quota)
@@ -162,6 +210,8 @@ private:
         StaticString<cFilePathLen>                mFilePath;
         size_t                                    mQuota = {};
         StaticArray<uint8_t, crypto::cSHA256Size> mChecksum;
+        ChunkHashes                               mChunkHashes;
+        bool                                      mChunkHashesValid = {};
 
         friend Log& operator<<(Log& log, const State& state)
         {
@@ -170,17 +220,27 @@ private:
         }
     };
 
+    struct StateChange {
+        StaticString<cFilePathLen> mPath;
+        Time                       mFirstEventTime;
+        Time                       mLastEventTime;
+    };
+
     void  OnFSEvent(const String& path, const Array<fs::FSEvent>& events) override;
+    void  ProcessStateChanges();
+    void  HandleStateChange(const String& path);
     Error InitStateWatching();
     Error PrepareState(const InstanceIdent& instanceIdent, const SetupParams& setupParams,
         const Array<uint8_t>& checksum, String& statePath);
     Error PrepareStorage(const InstanceIdent& instanceIdent, const SetupParams& setupParams, String& storagePath) const;
-    Error CheckChecksumAndSendUpdateRequest(const State& state);
+    Error CheckChecksumAndSendUpdateRequest(State& state);
     Error CreateStateFileIfNotExist(const String& path, const SetupParams& params) const;
     Error StartStateWatching(const InstanceIdent& instanceIdent, const String& path, size_t quota);
     Error StopStateWatching(const InstanceIdent& instanceIdent);
     Error SetQuotas(const SetupParams& setupParams);
     Error SendNewStateIfFileChanged(State& state);
+    Error SendNewStateDelta(State& state, const NewState& newState, const ChunkHashes& chunkHashes);
+    Error ApplyState(State& state, const String& content, const Array<uint8_t>& checksum);
     Error RemoveFromSystem(const InstanceIdent& instanceIdent);
     bool  QuotasAreEqual(const InstanceInfo& lhs, const SetupParams& rhs) const;
     Error ValidateChecksum(const String& text, const Array<uint8_t>& checksum);
@@ -188,18 +248,35 @@ private:
     StaticString<cFilePathLen> GetStateFilePath(const InstanceIdent& instanceIdent) const;
     StaticString<cFilePathLen> GetStoragePath(const InstanceIdent& instanceIdent) const;
     Error                      CalculateChecksum(const String& data, Array<uint8_t>& checksum);
+    static Error               CalculateChunkHashes(const String& data, ChunkHashes& chunkHashes);
+    State*                     FindState(const InstanceIdent& instanceIdent);
+    State*                     FindStateByPath(const String& path);
+    Error                      IndexState(size_t position);
+    void                       RebuildStateIndex();
 
-    StaticAllocator<cAllocatorSize>                                         mAllocator;
-    ThreadPool<cNumSendNewStateThreads, cMaxNumInstances, 2 * cFilePathLen> mThreadPool;
-    Mutex                                                                   mMutex;
-    Config                                                                  mConfig;
-    StorageItf*                                                             mStorage                        = {};
-    SenderItf*                                                              mMessageSender                  = {};
-    fs::FSPlatformItf*                                                      mFSPlatform                     = {};
-    fs::FSWatcherItf*                                                       mFSWatcher                      = {};
-    crypto::HasherItf*                                                      mHasher                         = {};
-    bool                                                                    mStateAndStorageOnSamePartition = {};
-    StaticArray<State, cMaxNumInstances>                                    mStates;
+    StaticAllocator<cAllocatorSize>            mAllocator;
+    mutable Mutex                              mMutex;
+    Config                                     mConfig;
+    StorageItf*                                mStorage                        = {};
+    SenderItf*                                 mMessageSender                  = {};
+    fs::FSPlatformItf*                         mFSPlatform                     = {};
+    fs::FSWatcherItf*                          mFSWatcher                      = {};
+    crypto::HasherItf*                         mHasher                         = {};
+    bool                                       mStateAndStorageOnSamePartition = {};
+    StaticArray<State, cMaxNumInstances>       mStates;
+    HashIndex<cMaxNumInstances>                mStateIndex;
+    HashIndex<cMaxNumInstances>                mPathIndex;
+    size_t                                     mSentStates                     = {};
+    size_t                                     mUnchangedStates                = {};
+    size_t                                     mSentDeltas                     = {};
+    bool                                       mDeltaNotSupported              = {};
+    mutable Mutex                              mStateChangeMutex;
+    ConditionalVariable                        mStateChangeCondVar;
+    StaticArray<StateChange, cMaxNumInstances> mStateChanges;
+    size_t                                     mReceivedEvents                 = {};
+    size_t                                     mMergedEvents                   = {};
+    bool                                       mStopped                        = true;
+    Thread<>                                   mStateChangeThread;
 };
 
 /** @}*/
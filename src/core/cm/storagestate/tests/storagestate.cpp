@@ -168,6 +168,7 @@ class SenderMock : public SenderItf {
 public:
     MOCK_METHOD(Error, SendStateRequest, (const StateRequest& request), (override));
     MOCK_METHOD(Error, SendNewState, (const NewState& state), (override));
+    MOCK_METHOD(Error, SendNewStateDelta, (const NewStateDelta& delta), (override));
 };
 
 /***********************************************************************************************************************
@@ -254,6 +255,43 @@ protected:
         return ErrorEnum::eNone;
     }
 
+    void SetupWithState(const std::string& stateContent, fs::FSEventSubscriberItf*& fsEventSubscriber)
+    {
+        const auto                 cSetupParams = SetupParams {getuid(), getgid(), cStateLen, 1000};
+        StaticString<cFilePathLen> storagePath;
+        StaticString<cFilePathLen> statePath;
+
+        auto err
+            = mStorageState.Init(mConfig, mStorageStub, mSenderMock, mFSPlatformMock, mFSWatcherMock, mCryptoProvider);
+        ASSERT_TRUE(err.IsNone()) << "Failed to initialize storage state: " << tests::utils::ErrorToStr(err);
+
+        err = mStorageState.Start();
+        ASSERT_TRUE(err.IsNone()) << "Failed to start storage state: " << tests::utils::ErrorToStr(err);
+
+        EXPECT_CALL(mFSWatcherMock, Subscribe)
+            .WillOnce(Invoke([&fsEventSubscriber](const String&, fs::FSEventSubscriberItf& subscriber) {
+                fsEventSubscriber = &subscriber;
+
+                return ErrorEnum::eNone;
+            }));
+        EXPECT_CALL(mFSPlatformMock, SetUserQuota).WillOnce(Return(ErrorEnum::eNone));
+        EXPECT_CALL(mSenderMock, SendStateRequest).WillOnce(Return(ErrorEnum::eNone));
+
+        err = mStorageState.Setup(cInstanceIdent, cSetupParams, storagePath, statePath);
+        ASSERT_TRUE(err.IsNone()) << "Failed to setup storage state: " << tests::utils::ErrorToStr(err);
+
+        auto updateState = std::make_unique<UpdateState>();
+
+        static_cast<InstanceIdent&>(*updateState) = cInstanceIdent;
+        updateState->mState                       = stateContent.c_str();
+
+        err = CalculateChecksum(stateContent, updateState->mChecksum);
+        ASSERT_TRUE(err.IsNone()) << "Failed to calculate checksum: " << tests::utils::ErrorToStr(err);
+
+        err = mStorageState.UpdateState(*updateState);
+        ASSERT_TRUE(err.IsNone()) << "Failed to update state: " << tests::utils::ErrorToStr(err);
+    }
+
     crypto::DefaultCryptoProvider mCryptoProvider;
     StorageStub                   mStorageStub;
     StrictMock<FSPlatformMock>    mFSPlatformMock;
@@ -816,4 +854,261 @@ TEST_F(StorageStateTests, UpdateAndAcceptStateFlow)
     EXPECT_TRUE(err.IsNone()) << "Failed to stop storage state: " << tests::utils::ErrorToStr(err);
 }
 
+TEST_F(StorageStateTests, StateChangeEventsAreCoalesced)
+{
+    constexpr auto             cNumEvents    = 10;
+    const auto                 cSetupParams  = SetupParams {getuid(), getgid(), 2000, 1000};
+    constexpr auto             cStateContent = "updated state content";
+    StaticString<cFilePathLen> storagePath;
+    StaticString<cFilePathLen> statePath;
+
+    mConfig.mStateChangeQuietPeriod = Time::cMilliseconds * 200;
+    mConfig.mStateChangeMaxDelay    = Time::cSeconds * 10;
+
+    auto err = mStorageState.Init(mConfig, mStorageStub, mSenderMock, mFSPlatformMock, mFSWatcherMock, mCryptoProvider);
+    ASSERT_TRUE(err.IsNone()) << "Failed to initialize storage state: " << tests::utils::ErrorToStr(err);
+
+    err = mStorageState.Start();
+    ASSERT_TRUE(err.IsNone()) << "Failed to start storage state: " << tests::utils::ErrorToStr(err);
+
+    fs::FSEventSubscriberItf* fsEventSubscriber = nullptr;
+
+    EXPECT_CALL(mFSWatcherMock, Subscribe)
+        .WillOnce(Invoke([&fsEventSubscriber](const String&, fs::FSEventSubscriberItf& subscriber) {
+            fsEventSubscriber = &subscriber;
+
+            return ErrorEnum::eNone;
+        }));
+    EXPECT_CALL(mFSPlatformMock, SetUserQuota).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mSenderMock, SendStateRequest).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Setup(cInstanceIdent, cSetupParams, storagePath, statePath);
+    ASSERT_TRUE(err.IsNone()) << "Failed to setup storage state: " << tests::utils::ErrorToStr(err);
+
+    // Emulate service writes its state in many small writes
+
+    std::promise<void> stateSentPromise;
+
+    EXPECT_CALL(mSenderMock, SendNewState).WillOnce(Invoke([&stateSentPromise](const auto&) {
+        stateSentPromise.set_value();
+
+        return ErrorEnum::eNone;
+    }));
+
+    for (auto i = 0; i < cNumEvents; i++) {
+        err = fs::WriteStringToFile(
+            ToStatePath(cInstanceIdent).c_str(), std::string(cStateContent).substr(0, i + 1).c_str(), 0600);
+        ASSERT_TRUE(err.IsNone()) << "Failed to write state file: " << tests::utils::ErrorToStr(err);
+
+        fsEventSubscriber->OnFSEvent(ToStatePath(cInstanceIdent).c_str(), {});
+    }
+
+    EXPECT_EQ(stateSentPromise.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready)
+        << "State was not sent in time";
+
+    EXPECT_EQ(mStorageState.GetStateChangeStats(), (StateChangeStats {cNumEvents, cNumEvents - 1, 1, 0}));
+
+    // Event without content change doesn't send state
+
+    fsEventSubscriber->OnFSEvent(ToStatePath(cInstanceIdent).c_str(), {});
+
+    EXPECT_CALL(mFSWatcherMock, Unsubscribe).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Stop();
+    EXPECT_TRUE(err.IsNone()) << "Failed to stop storage state: " << tests::utils::ErrorToStr(err);
+
+    EXPECT_EQ(mStorageState.GetStateChangeStats(), (StateChangeStats {cNumEvents + 1, cNumEvents - 1, 1, 1}));
+}
+
+TEST_F(StorageStateTests, StateChangeIsSentWithinMaxDelay)
+{
+    const auto                 cSetupParams  = SetupParams {getuid(), getgid(), 2000, 1000};
+    constexpr auto             cStateContent = "updated state content";
+    StaticString<cFilePathLen> storagePath;
+    StaticString<cFilePathLen> statePath;
+
+    mConfig.mStateChangeQuietPeriod = Time::cSeconds * 30;
+    mConfig.mStateChangeMaxDelay    = Time::cMilliseconds * 200;
+
+    auto err = mStorageState.Init(mConfig, mStorageStub, mSenderMock, mFSPlatformMock, mFSWatcherMock, mCryptoProvider);
+    ASSERT_TRUE(err.IsNone()) << "Failed to initialize storage state: " << tests::utils::ErrorToStr(err);
+
+    err = mStorageState.Start();
+    ASSERT_TRUE(err.IsNone()) << "Failed to start storage state: " << tests::utils::ErrorToStr(err);
+
+    fs::FSEventSubscriberItf* fsEventSubscriber = nullptr;
+
+    EXPECT_CALL(mFSWatcherMock, Subscribe)
+        .WillOnce(Invoke([&fsEventSubscriber](const String&, fs::FSEventSubscriberItf& subscriber) {
+            fsEventSubscriber = &subscriber;
+
+            return ErrorEnum::eNone;
+        }));
+    EXPECT_CALL(mFSPlatformMock, SetUserQuota).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mSenderMock, SendStateRequest).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Setup(cInstanceIdent, cSetupParams, storagePath, statePath);
+    ASSERT_TRUE(err.IsNone()) << "Failed to setup storage state: " << tests::utils::ErrorToStr(err);
+
+    err = fs::WriteStringToFile(ToStatePath(cInstanceIdent).c_str(), cStateContent, 0600);
+    ASSERT_TRUE(err.IsNone()) << "Failed to write state file: " << tests::utils::ErrorToStr(err);
+
+    std::promise<void> stateSentPromise;
+
+    EXPECT_CALL(mSenderMock, SendNewState).WillOnce(Invoke([&stateSentPromise](const auto&) {
+        stateSentPromise.set_value();
+
+        return ErrorEnum::eNone;
+    }));
+
+    fsEventSubscriber->OnFSEvent(ToStatePath(cInstanceIdent).c_str(), {});
+
+    EXPECT_EQ(stateSentPromise.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready)
+        << "State was not sent in time";
+
+    EXPECT_CALL(mFSWatcherMock, Unsubscribe).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Stop();
+    EXPECT_TRUE(err.IsNone()) << "Failed to stop storage state: " << tests::utils::ErrorToStr(err);
+}
+
+TEST_F(StorageStateTests, ChangedChunksAreSentAsDelta)
+{
+    const auto cStateContent = std::string(cStateChunkSize, 'a') + std::string(cStateChunkSize, 'b')
+        + std::string(cStateChunkSize / 2, 'c');
+    auto cNewStateContent = cStateContent;
+
+    cNewStateContent.replace(cStateChunkSize + 10, 5, "delta");
+
+    fs::FSEventSubscriberItf* fsEventSubscriber = nullptr;
+
+    ASSERT_NO_FATAL_FAILURE(SetupWithState(cStateContent, fsEventSubscriber));
+
+    auto expectedDelta = std::make_unique<NewStateDelta>();
+
+    static_cast<InstanceIdent&>(*expectedDelta) = cInstanceIdent;
+    expectedDelta->mSize                        = cNewStateContent.size();
+    expectedDelta->mChunks.PushBack(1);
+    expectedDelta->mData = cNewStateContent.substr(cStateChunkSize, cStateChunkSize).c_str();
+
+    ASSERT_TRUE(CalculateChecksum(cStateContent, expectedDelta->mBaseChecksum).IsNone());
+    ASSERT_TRUE(CalculateChecksum(cNewStateContent, expectedDelta->mChecksum).IsNone());
+
+    std::promise<void> stateSentPromise;
+
+    EXPECT_CALL(mSenderMock, SendNewStateDelta(*expectedDelta)).WillOnce(Invoke([&stateSentPromise](const auto&) {
+        stateSentPromise.set_value();
+
+        return ErrorEnum::eNone;
+    }));
+
+    auto err = fs::WriteStringToFile(ToStatePath(cInstanceIdent).c_str(), cNewStateContent.c_str(), 0600);
+    ASSERT_TRUE(err.IsNone()) << "Failed to write state file: " << tests::utils::ErrorToStr(err);
+
+    fsEventSubscriber->OnFSEvent(ToStatePath(cInstanceIdent).c_str(), {});
+
+    EXPECT_EQ(stateSentPromise.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready)
+        << "State delta was not sent in time";
+
+    StaticArray<uint8_t, crypto::cSHA256Size> checksum;
+
+    ASSERT_TRUE(mStorageState.GetInstanceCheckSum(cInstanceIdent, checksum).IsNone());
+    EXPECT_EQ(checksum, expectedDelta->mChecksum);
+
+    EXPECT_CALL(mFSWatcherMock, Unsubscribe).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Stop();
+    EXPECT_TRUE(err.IsNone()) << "Failed to stop storage state: " << tests::utils::ErrorToStr(err);
+
+    EXPECT_EQ(mStorageState.GetStateChangeStats().mSentDeltas, 1);
+}
+
+TEST_F(StorageStateTests, FullStateIsSentIfDeltaIsNotSupported)
+{
+    const auto cStateContent    = std::string(cStateChunkSize * 2, 'a');
+    auto       cNewStateContent = cStateContent;
+
+    cNewStateContent.replace(0, 5, "delta");
+
+    fs::FSEventSubscriberItf* fsEventSubscriber = nullptr;
+
+    ASSERT_NO_FATAL_FAILURE(SetupWithState(cStateContent, fsEventSubscriber));
+
+    std::promise<void> stateSentPromise;
+
+    EXPECT_CALL(mSenderMock, SendNewStateDelta).WillOnce(Return(ErrorEnum::eNotSupported));
+    EXPECT_CALL(mSenderMock, SendNewState).WillOnce(Invoke([&](const NewState& state) {
+        EXPECT_EQ(std::string(state.mState.CStr()), cNewStateContent);
+
+        stateSentPromise.set_value();
+
+        return ErrorEnum::eNone;
+    }));
+
+    auto err = fs::WriteStringToFile(ToStatePath(cInstanceIdent).c_str(), cNewStateContent.c_str(), 0600);
+    ASSERT_TRUE(err.IsNone()) << "Failed to write state file: " << tests::utils::ErrorToStr(err);
+
+    fsEventSubscriber->OnFSEvent(ToStatePath(cInstanceIdent).c_str(), {});
+
+    EXPECT_EQ(stateSentPromise.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready)
+        << "State was not sent in time";
+
+    EXPECT_CALL(mFSWatcherMock, Unsubscribe).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Stop();
+    EXPECT_TRUE(err.IsNone()) << "Failed to stop storage state: " << tests::utils::ErrorToStr(err);
+}
+
+TEST_F(StorageStateTests, UpdateStateDelta)
+{
+    const auto cStateContent    = std::string(cStateChunkSize * 2, 'a');
+    const auto cNewStateContent = std::string(cStateChunkSize, 'a') + std::string(cStateChunkSize + 10, 'b');
+
+    fs::FSEventSubscriberItf* fsEventSubscriber = nullptr;
+
+    ASSERT_NO_FATAL_FAILURE(SetupWithState(cStateContent, fsEventSubscriber));
+
+    auto delta = std::make_unique<UpdateStateDelta>();
+
+    static_cast<InstanceIdent&>(*delta) = cInstanceIdent;
+    delta->mSize                        = cNewStateContent.size();
+    delta->mChunks.PushBack(1);
+    delta->mChunks.PushBack(2);
+    delta->mData = cNewStateContent.substr(cStateChunkSize).c_str();
+
+    ASSERT_TRUE(CalculateChecksum(cNewStateContent, delta->mChecksum).IsNone());
+
+    // Wrong base state
+
+    ASSERT_TRUE(CalculateChecksum("wrong base", delta->mBaseChecksum).IsNone());
+    EXPECT_TRUE(mStorageState.UpdateStateDelta(*delta).Is(ErrorEnum::eInvalidChecksum));
+
+    // Valid delta
+
+    ASSERT_TRUE(CalculateChecksum(cStateContent, delta->mBaseChecksum).IsNone());
+
+    auto err = mStorageState.UpdateStateDelta(*delta);
+    ASSERT_TRUE(err.IsNone()) << "Failed to update state delta: " << tests::utils::ErrorToStr(err);
+
+    std::ifstream file(ToStatePath(cInstanceIdent));
+
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(file), {}), cNewStateContent);
+
+    EXPECT_TRUE(mStorageStub.Contains([&delta](const InstanceInfo& info) {
+        return info.mInstanceIdent == cInstanceIdent && info.mStateChecksum == delta->mChecksum;
+    }));
+
+    // Delta data mismatch
+
+    delta->mBaseChecksum = delta->mChecksum;
+    delta->mData.Resize(delta->mData.Size() - 1);
+
+    EXPECT_TRUE(mStorageState.UpdateStateDelta(*delta).Is(ErrorEnum::eInvalidArgument));
+
+    EXPECT_CALL(mFSWatcherMock, Unsubscribe).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mStorageState.Stop();
+    EXPECT_TRUE(err.IsNone()) << "Failed to stop storage state: " << tests::utils::ErrorToStr(err);
+}
+
 } // namespace aos::cm::storagestate
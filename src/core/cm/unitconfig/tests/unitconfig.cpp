@@ -4,6 +4,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -105,6 +110,24 @@ protected:
         return nodeInfo;
     }
 
+    void SetupConnectedNodes(size_t numNodes)
+    {
+        StaticArray<StaticString<cIDLen>, cMaxNumNodes> nodeIds;
+
+        for (size_t i = 0; i < numNodes; i++) {
+            nodeIds.PushBack(("node" + std::to_string(i)).c_str());
+        }
+
+        EXPECT_CALL(mNodeInfoProvider, GetAllNodeIDs(_))
+            .WillRepeatedly(DoAll(SetArgReferee<0>(nodeIds), Return(ErrorEnum::eNone)));
+        EXPECT_CALL(mNodeInfoProvider, GetNodeInfo(_, _))
+            .WillRepeatedly(Invoke([this](const String& nodeID, UnitNodeInfo& info) {
+                info = CreateTestNodeInfo(nodeID);
+
+                return ErrorEnum::eNone;
+            }));
+    }
+
     void SetupValidUnitConfig()
     {
         auto config = CreateTestUnitConfig("1.0.0");
@@ -526,4 +549,102 @@ TEST_F(UnitConfigTest, CheckUnitConfigMultipleNodes)
     EXPECT_TRUE(err.IsNone());
 }
 
+TEST_F(UnitConfigTest, UpdateUnitConfigUpdatesNodesInParallel)
+{
+    constexpr size_t cNumNodes = AOS_CONFIG_CM_UNITCONFIG_NUM_NODE_THREADS;
+
+    CreateTestConfigFile(cValidTestUnitConfig);
+
+    SetupValidUnitConfig();
+
+    ASSERT_TRUE(mUnitConfig.Init({cTestConfigFile}, mNodeInfoProvider, mNodeConfigHandler, mJSONProvider).IsNone());
+
+    EXPECT_CALL(mJSONProvider, UnitConfigToJSON(_, _)).WillOnce(Return(ErrorEnum::eNone));
+
+    SetupConnectedNodes(cNumNodes);
+
+    std::mutex              mutex;
+    std::condition_variable condVar;
+    size_t                  numCalls = 0;
+
+    // Each update waits for all others, so it succeeds only if updates are sent concurrently.
+    EXPECT_CALL(mNodeConfigHandler, UpdateNodeConfig(_, _))
+        .Times(cNumNodes)
+        .WillRepeatedly(Invoke([&](const String&, const NodeConfig&) -> Error {
+            std::unique_lock lock {mutex};
+
+            numCalls++;
+            condVar.notify_all();
+
+            if (!condVar.wait_for(lock, std::chrono::seconds(5), [&] { return numCalls == cNumNodes; })) {
+                return ErrorEnum::eTimeout;
+            }
+
+            return ErrorEnum::eNone;
+        }));
+
+    auto err = mUnitConfig.UpdateUnitConfig(CreateTestUnitConfig("2.0.0"));
+    EXPECT_TRUE(err.IsNone());
+}
+
+TEST_F(UnitConfigTest, UpdateUnitConfigReportsPartialFailure)
+{
+    CreateTestConfigFile(cValidTestUnitConfig);
+
+    SetupValidUnitConfig();
+
+    ASSERT_TRUE(mUnitConfig.Init({cTestConfigFile}, mNodeInfoProvider, mNodeConfigHandler, mJSONProvider).IsNone());
+
+    EXPECT_CALL(mJSONProvider, UnitConfigToJSON(_, _)).WillOnce(Return(ErrorEnum::eNone));
+
+    SetupConnectedNodes(3);
+
+    // Failure on one node doesn't prevent update of other nodes.
+    EXPECT_CALL(mNodeConfigHandler, UpdateNodeConfig(String("node0"), _)).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mNodeConfigHandler, UpdateNodeConfig(String("node1"), _)).WillOnce(Return(ErrorEnum::eFailed));
+    EXPECT_CALL(mNodeConfigHandler, UpdateNodeConfig(String("node2"), _)).WillOnce(Return(ErrorEnum::eNone));
+
+    auto err = mUnitConfig.UpdateUnitConfig(CreateTestUnitConfig("2.0.0"));
+    EXPECT_TRUE(err.Is(ErrorEnum::eFailed));
+
+    UnitConfigStatus status;
+
+    ASSERT_TRUE(mUnitConfig.GetUnitConfigStatus(status).IsNone());
+    EXPECT_EQ(status.mVersion, "2.0.0");
+}
+
+TEST_F(UnitConfigTest, CheckUnitConfigSkipsUnchangedNodes)
+{
+    CreateTestConfigFile(cValidTestUnitConfig);
+
+    SetupValidUnitConfig();
+
+    ASSERT_TRUE(mUnitConfig.Init({cTestConfigFile}, mNodeInfoProvider, mNodeConfigHandler, mJSONProvider).IsNone());
+
+    EXPECT_CALL(mJSONProvider, UnitConfigToJSON(_, _)).WillOnce(Return(ErrorEnum::eNone));
+
+    SetupConnectedNodes(3);
+
+    EXPECT_CALL(mNodeConfigHandler, UpdateNodeConfig(_, _)).Times(3).WillRepeatedly(Return(ErrorEnum::eNone));
+
+    ASSERT_TRUE(mUnitConfig.UpdateUnitConfig(CreateTestUnitConfig("2.0.0")).IsNone());
+
+    // Only node1 config content is changed, other nodes have already accepted the same content.
+    auto newUnitConfig = CreateTestUnitConfig("3.0.0");
+
+    auto node1Config      = CreateTestUnitConfigWithNodeID("3.0.0", "node1").mNodes[0];
+    node1Config.mPriority = 10;
+
+    newUnitConfig.mNodes.PushBack(node1Config);
+
+    NodeConfigStatus node1Status;
+    node1Status.mVersion = "2.0.0";
+
+    EXPECT_CALL(mNodeConfigHandler, GetNodeConfigStatus(String("node1"), _))
+        .WillOnce(DoAll(SetArgReferee<1>(node1Status), Return(ErrorEnum::eNone)));
+    EXPECT_CALL(mNodeConfigHandler, CheckNodeConfig(String("node1"), _)).WillOnce(Return(ErrorEnum::eNone));
+
+    EXPECT_TRUE(mUnitConfig.CheckUnitConfig(newUnitConfig).IsNone());
+}
+
 } // namespace aos::cm::unitconfig
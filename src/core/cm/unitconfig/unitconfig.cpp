@@ -5,6 +5,7 @@
  */
 
 #include <core/common/tools/fs.hpp>
+#include <core/common/tools/hashindex.hpp>
 #include <core/common/tools/logger.hpp>
 #include <core/common/tools/semver.hpp>
 
@@ -12,6 +13,106 @@
 
 namespace aos::cm::unitconfig {
 
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+namespace {
+
+uint64_t HashField(uint64_t value, uint64_t hash)
+{
+    return FNVHash(&value, sizeof(value), hash);
+}
+
+uint64_t HashField(double value, uint64_t hash)
+{
+    return FNVHash(&value, sizeof(value), hash);
+}
+
+uint64_t HashField(const String& value, uint64_t hash)
+{
+    // Include terminating zero, so adjacent strings can't be shifted into each other.
+    return FNVHash(value.CStr(), value.Size() + 1, hash);
+}
+
+uint64_t HashField(const AlertRulePercents& rule, uint64_t hash)
+{
+    hash = HashField(static_cast<uint64_t>(rule.mMinTimeout.Nanoseconds()), hash);
+    hash = HashField(rule.mMinThreshold, hash);
+
+    return HashField(rule.mMaxThreshold, hash);
+}
+
+uint64_t HashField(const AlertRulePoints& rule, uint64_t hash)
+{
+    hash = HashField(static_cast<uint64_t>(rule.mMinTimeout.Nanoseconds()), hash);
+    hash = HashField(rule.mMinThreshold, hash);
+
+    return HashField(rule.mMaxThreshold, hash);
+}
+
+uint64_t HashField(const PartitionAlertRule& rule, uint64_t hash)
+{
+    return HashField(static_cast<const AlertRulePercents&>(rule), HashField(rule.mName, hash));
+}
+
+uint64_t HashField(const AlertRules& rules, uint64_t hash);
+uint64_t HashField(const ResourceRatios& ratios, uint64_t hash);
+
+template <typename T>
+uint64_t HashField(const Optional<T>& value, uint64_t hash)
+{
+    hash = HashField(static_cast<uint64_t>(value.HasValue()), hash);
+
+    return value.HasValue() ? HashField(value.GetValue(), hash) : hash;
+}
+
+template <typename T>
+uint64_t HashField(const Array<T>& items, uint64_t hash)
+{
+    hash = HashField(static_cast<uint64_t>(items.Size()), hash);
+
+    for (const auto& item : items) {
+        hash = HashField(item, hash);
+    }
+
+    return hash;
+}
+
+uint64_t HashField(const AlertRules& rules, uint64_t hash)
+{
+    hash = HashField(rules.mRAM, hash);
+    hash = HashField(rules.mCPU, hash);
+    hash = HashField(rules.mPartitions, hash);
+    hash = HashField(rules.mDownload, hash);
+
+    return HashField(rules.mUpload, hash);
+}
+
+uint64_t HashField(const ResourceRatios& ratios, uint64_t hash)
+{
+    hash = HashField(ratios.mCPU, hash);
+    hash = HashField(ratios.mRAM, hash);
+    hash = HashField(ratios.mStorage, hash);
+
+    return HashField(ratios.mState, hash);
+}
+
+// Version is not hashed: it changes with every unit config while node config content usually stays the same.
+uint64_t HashNodeConfig(const NodeConfig& config)
+{
+    auto hash = HashField(config.mNodeID, cFNVOffsetBasis);
+
+    hash = HashField(config.mNodeType, hash);
+    hash = HashField(config.mAlertRules, hash);
+    hash = HashField(config.mResourceRatios, hash);
+    hash = HashField(config.mLabels, hash);
+
+    return HashField(config.mPriority, hash);
+}
+
+} // namespace
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -76,45 +177,11 @@ Error UnitConfig::CheckUnitConfig(const aos::UnitConfig& config)
         return AOS_ERROR_WRAP(err);
     }
 
-    StaticArray<StaticString<cIDLen>, cMaxNumNodes> nodeIds;
-
-    if (auto err = mNodeInfoProvider->GetAllNodeIDs(nodeIds); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
+    if (auto err = PrepareNodeTasks(); !err.IsNone()) {
+        return err;
     }
 
-    for (const auto& id : nodeIds) {
-        auto nodeInfo = MakeUnique<UnitNodeInfo>(&mAllocator);
-
-        if (auto err = mNodeInfoProvider->GetNodeInfo(id, *nodeInfo); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
-
-        if (!nodeInfo->mIsConnected) {
-            LOG_DBG() << "Skip node config check due to node is not connected" << Log::Field("nodeID", id);
-
-            continue;
-        }
-
-        NodeConfigStatus nodeConfigStatus;
-
-        if (auto err = mNodeConfigHandler->GetNodeConfigStatus(id, nodeConfigStatus); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
-
-        if (nodeConfigStatus.mVersion != config.mVersion || !nodeConfigStatus.mError.IsNone()) {
-            auto nodeConfig = MakeUnique<NodeConfig>(&mAllocator);
-
-            if (auto err = FindNodeConfig(nodeInfo->mNodeID, nodeInfo->mNodeType, config, *nodeConfig); !err.IsNone()) {
-                return err;
-            }
-
-            if (auto err = mNodeConfigHandler->CheckNodeConfig(id, *nodeConfig); !err.IsNone()) {
-                return AOS_ERROR_WRAP(err);
-            }
-        }
-    }
-
-    return ErrorEnum::eNone;
+    return RunNodeTasks(config, false);
 }
 
 Error UnitConfig::GetNodeConfig(const String& nodeID, const String& nodeType, NodeConfig& config)
@@ -149,43 +216,19 @@ Error UnitConfig::UpdateUnitConfig(const aos::UnitConfig& unitConfig)
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = fs::WriteStringToFile(mUnitConfigFile, *unitConfigJSON, 0600); !err.IsNone()) {
+    if (auto err = fs::WriteStringToFile(mUnitConfigFile, *unitConfigJSON, 0600, fs::Durability::Data);
+        !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
     mUnitConfigState = UnitConfigStateEnum::eInstalled;
     mUnitConfigError = ErrorEnum::eNone;
 
-    StaticArray<StaticString<cIDLen>, cMaxNumNodes> nodeIds;
-
-    if (auto err = mNodeInfoProvider->GetAllNodeIDs(nodeIds); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
-
-    for (const auto& id : nodeIds) {
-        auto nodeConfig = MakeUnique<NodeConfig>(&mAllocator);
-        auto nodeInfo   = MakeUnique<UnitNodeInfo>(&mAllocator);
-
-        if (auto err = mNodeInfoProvider->GetNodeInfo(id, *nodeInfo); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
-
-        if (!nodeInfo->mIsConnected) {
-            LOG_DBG() << "Skip node config update due to node is not connected" << Log::Field("nodeID", id);
-
-            continue;
-        }
-
-        if (auto err = FindNodeConfig(nodeInfo->mNodeID, nodeInfo->mNodeType, unitConfig, *nodeConfig); !err.IsNone()) {
-            return err;
-        }
-
-        if (auto err = mNodeConfigHandler->UpdateNodeConfig(id, *nodeConfig); !err.IsNone()) {
-            return AOS_ERROR_WRAP(err);
-        }
+    if (auto err = PrepareNodeTasks(); !err.IsNone()) {
+        return err;
     }
 
-    return ErrorEnum::eNone;
+    return RunNodeTasks(unitConfig, true);
 }
 
 void UnitConfig::OnNodeInfoChanged(const UnitNodeInfo& info)
@@ -206,6 +249,8 @@ void UnitConfig::OnNodeInfoChanged(const UnitNodeInfo& info)
     if (!info.mIsConnected) {
         LOG_DBG() << "Skip node config update due to node is not connected" << Log::Field("nodeID", info.mNodeID);
 
+        ResetNodeConfigApplied(info.mNodeID);
+
         return;
     }
 
@@ -232,8 +277,12 @@ void UnitConfig::OnNodeInfoChanged(const UnitNodeInfo& info)
     if (auto err = mNodeConfigHandler->UpdateNodeConfig(info.mNodeID, *nodeConfig); !err.IsNone()) {
         LOG_ERR() << "Error updating node config" << Log::Field(err);
 
+        ResetNodeConfigApplied(info.mNodeID);
+
         return;
     }
+
+    SetNodeConfigApplied(info.mNodeID, HashNodeConfig(*nodeConfig));
 }
 
 /***********************************************************************************************************************
@@ -318,4 +367,180 @@ Error UnitConfig::FindNodeConfig(
     return ErrorEnum::eNone;
 }
 
+Error UnitConfig::PrepareNodeTasks()
+{
+    StaticArray<StaticString<cIDLen>, cMaxNumNodes> nodeIds;
+
+    if (auto err = mNodeInfoProvider->GetAllNodeIDs(nodeIds); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    mNodeTasks.Clear();
+
+    for (const auto& id : nodeIds) {
+        auto nodeInfo = MakeUnique<UnitNodeInfo>(&mAllocator);
+
+        if (auto err = mNodeInfoProvider->GetNodeInfo(id, *nodeInfo); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (!nodeInfo->mIsConnected) {
+            LOG_DBG() << "Skip node due to node is not connected" << Log::Field("nodeID", id);
+
+            ResetNodeConfigApplied(id);
+
+            continue;
+        }
+
+        if (auto err = mNodeTasks.PushBack({id, nodeInfo->mNodeType, 0, ErrorEnum::eNone}); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error UnitConfig::RunNodeTasks(const aos::UnitConfig& config, bool update)
+{
+    if (mNodeTasks.IsEmpty()) {
+        return ErrorEnum::eNone;
+    }
+
+    if (auto err = mThreadPool.Run(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    Error err;
+
+    for (auto& task : mNodeTasks) {
+        if (err = mThreadPool.AddTask([this, &config, &task, update](void*) {
+                update ? UpdateNode(config, task) : CheckNode(config, task);
+            });
+            !err.IsNone()) {
+            err = AOS_ERROR_WRAP(err);
+
+            break;
+        }
+    }
+
+    if (auto waitErr = mThreadPool.Wait(); !waitErr.IsNone() && err.IsNone()) {
+        err = AOS_ERROR_WRAP(waitErr);
+    }
+
+    if (auto shutdownErr = mThreadPool.Shutdown(); !shutdownErr.IsNone() && err.IsNone()) {
+        err = AOS_ERROR_WRAP(shutdownErr);
+    }
+
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    size_t numFailed = 0;
+
+    for (const auto& task : mNodeTasks) {
+        if (!task.mError.IsNone()) {
+            LOG_ERR() << "Node config " << (update ? "update" : "check") << " failed"
+                      << Log::Field("nodeID", task.mNodeID) << Log::Field(task.mError);
+
+            if (update) {
+                ResetNodeConfigApplied(task.mNodeID);
+            }
+
+            if (err.IsNone()) {
+                err = task.mError;
+            }
+
+            numFailed++;
+
+            continue;
+        }
+
+        if (update) {
+            SetNodeConfigApplied(task.mNodeID, task.mDigest);
+        }
+    }
+
+    if (numFailed != 0) {
+        LOG_ERR() << "Node config " << (update ? "update" : "check") << " failed on some nodes"
+                  << Log::Field("failed", numFailed) << Log::Field("total", mNodeTasks.Size());
+    }
+
+    return err;
+}
+
+void UnitConfig::CheckNode(const aos::UnitConfig& config, NodeTask& task)
+{
+    auto nodeConfig = MakeUnique<NodeConfig>(&mNodeConfigAllocator);
+
+    if (task.mError = FindNodeConfig(task.mNodeID, task.mNodeType, config, *nodeConfig); !task.mError.IsNone()) {
+        return;
+    }
+
+    task.mDigest = HashNodeConfig(*nodeConfig);
+
+    // Node has already accepted the same config content, there is nothing to check.
+    if (IsNodeConfigApplied(task.mNodeID, task.mDigest)) {
+        LOG_DBG() << "Skip node config check due to config is not changed" << Log::Field("nodeID", task.mNodeID);
+
+        return;
+    }
+
+    NodeConfigStatus nodeConfigStatus;
+
+    if (auto err = mNodeConfigHandler->GetNodeConfigStatus(task.mNodeID, nodeConfigStatus); !err.IsNone()) {
+        task.mError = AOS_ERROR_WRAP(err);
+
+        return;
+    }
+
+    if (nodeConfigStatus.mVersion == config.mVersion && nodeConfigStatus.mError.IsNone()) {
+        return;
+    }
+
+    if (auto err = mNodeConfigHandler->CheckNodeConfig(task.mNodeID, *nodeConfig); !err.IsNone()) {
+        task.mError = AOS_ERROR_WRAP(err);
+    }
+}
+
+void UnitConfig::UpdateNode(const aos::UnitConfig& config, NodeTask& task)
+{
+    auto nodeConfig = MakeUnique<NodeConfig>(&mNodeConfigAllocator);
+
+    if (task.mError = FindNodeConfig(task.mNodeID, task.mNodeType, config, *nodeConfig); !task.mError.IsNone()) {
+        return;
+    }
+
+    task.mDigest = HashNodeConfig(*nodeConfig);
+
+    // Update is sent even if config content is not changed: node reports config version in its status.
+    if (auto err = mNodeConfigHandler->UpdateNodeConfig(task.mNodeID, *nodeConfig); !err.IsNone()) {
+        task.mError = AOS_ERROR_WRAP(err);
+    }
+}
+
+bool UnitConfig::IsNodeConfigApplied(const String& nodeID, uint64_t digest) const
+{
+    auto it = mNodeDigests.FindIf([&nodeID](const NodeDigest& item) { return item.mNodeID == nodeID; });
+
+    return it != mNodeDigests.end() && it->mDigest == digest;
+}
+
+void UnitConfig::SetNodeConfigApplied(const String& nodeID, uint64_t digest)
+{
+    auto it = mNodeDigests.FindIf([&nodeID](const NodeDigest& item) { return item.mNodeID == nodeID; });
+    if (it != mNodeDigests.end()) {
+        it->mDigest = digest;
+
+        return;
+    }
+
+    // Digests only allow to skip redundant checks, so it is fine to not keep one if there is no room.
+    mNodeDigests.PushBack({nodeID, digest});
+}
+
+void UnitConfig::ResetNodeConfigApplied(const String& nodeID)
+{
+    mNodeDigests.RemoveIf([&nodeID](const NodeDigest& item) { return item.mNodeID == nodeID; });
+}
+
 } // namespace aos::cm::unitconfig
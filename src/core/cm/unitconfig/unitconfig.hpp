@@ -99,11 +99,31 @@ public:
 
 private:
     static constexpr auto cUnitConfigJSONLen = AOS_CONFIG_CM_UNITCONFIG_JSON_LEN;
+    static constexpr auto cNumNodeThreads    = AOS_CONFIG_CM_UNITCONFIG_NUM_NODE_THREADS;
+
+    struct NodeTask {
+        StaticString<cIDLen>       mNodeID;
+        StaticString<cNodeTypeLen> mNodeType;
+        uint64_t                   mDigest {};
+        Error                      mError;
+    };
+
+    struct NodeDigest {
+        StaticString<cIDLen> mNodeID;
+        uint64_t             mDigest {};
+    };
 
     Error LoadConfig();
     Error CheckVersion(const String& version);
     Error FindNodeConfig(
         const String& nodeID, const String& nodeType, const aos::UnitConfig& config, NodeConfig& nodeConfig);
+    Error PrepareNodeTasks();
+    Error RunNodeTasks(const aos::UnitConfig& config, bool update);
+    void  CheckNode(const aos::UnitConfig& config, NodeTask& task);
+    void  UpdateNode(const aos::UnitConfig& config, NodeTask& task);
+    bool  IsNodeConfigApplied(const String& nodeID, uint64_t digest) const;
+    void  SetNodeConfigApplied(const String& nodeID, uint64_t digest);
+    void  ResetNodeConfigApplied(const String& nodeID);
 
     StaticString<cFilePathLen>             mUnitConfigFile;
     nodeinfoprovider::NodeInfoProviderItf* mNodeInfoProvider {};
@@ -118,7 +138,12 @@ private:
         + sizeof(UnitNodeInfo)>
         mAllocator;
 
+    StaticAllocator<sizeof(NodeConfig) * cNumNodeThreads, cNumNodeThreads> mNodeConfigAllocator;
+
     StaticArray<NodeConfigStatus, cMaxNumNodes> mNodeConfigStatuses;
+    StaticArray<NodeTask, cMaxNumNodes>         mNodeTasks;
+    StaticArray<NodeDigest, cMaxNumNodes>       mNodeDigests;
+    ThreadPool<cNumNodeThreads, cMaxNumNodes>   mThreadPool;
 
     Mutex mMutex;
 };
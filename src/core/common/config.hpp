@@ -554,6 +554,13 @@
 #define AOS_CONFIG_TYPES_STATE_LEN 64 * 1024
 #endif
 
+/**
+ * State chunk size.
+ */
+#ifndef AOS_CONFIG_TYPES_STATE_CHUNK_SIZE
+#define AOS_CONFIG_TYPES_STATE_CHUNK_SIZE 4 * 1024
+#endif
+
 /**
  * Max length of JSON.
  */
@@ -617,6 +624,34 @@
 #define AOS_CONFIG_MONITORING_AVERAGE_WINDOW_SEC 60
 #endif
 
+/**
+ * Downloader segment size.
+ */
+#ifndef AOS_CONFIG_DOWNLOADER_SEGMENT_SIZE
+#define AOS_CONFIG_DOWNLOADER_SEGMENT_SIZE (16 * 1024 * 1024)
+#endif
+
+/**
+ * Downloader max number of segments per blob.
+ */
+#ifndef AOS_CONFIG_DOWNLOADER_MAX_NUM_SEGMENTS
+#define AOS_CONFIG_DOWNLOADER_MAX_NUM_SEGMENTS 64
+#endif
+
+/**
+ * Downloader number of parallel segment downloads.
+ */
+#ifndef AOS_CONFIG_DOWNLOADER_NUM_SEGMENT_THREADS
+#define AOS_CONFIG_DOWNLOADER_NUM_SEGMENT_THREADS 4
+#endif
+
+/**
+ * Downloader max number of concurrent segmented downloads.
+ */
+#ifndef AOS_CONFIG_DOWNLOADER_MAX_NUM_DOWNLOADS
+#define AOS_CONFIG_DOWNLOADER_MAX_NUM_DOWNLOADS 2
+#endif
+
 /**
  * Certificate issuer max size is not specified in general.
  * (RelativeDistinguishedName ::= SET SIZE (1..MAX) OF AttributeTypeAndValue)
@@ -912,6 +947,20 @@
 #define AOS_CONFIG_CRYPTO_MAX_NUM_CERTIFICATES 32
 #endif
 
+/**
+ * Number of parsed certificates cached by crypto helper.
+ */
+#ifndef AOS_CONFIG_CRYPTO_CERT_CACHE_SIZE
+#define AOS_CONFIG_CRYPTO_CERT_CACHE_SIZE 8
+#endif
+
+/**
+ * Number of verified certificate chains cached by crypto helper.
+ */
+#ifndef AOS_CONFIG_CRYPTO_VERIFIED_CHAIN_CACHE_SIZE
+#define AOS_CONFIG_CRYPTO_VERIFIED_CHAIN_CACHE_SIZE 8
+#endif
+
 /**
  * Maximum length of PKCS11 slot description.
  */
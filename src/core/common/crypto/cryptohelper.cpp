@@ -12,6 +12,36 @@
 
 namespace aos::crypto {
 
+namespace {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+template <typename T>
+T* GetCacheSlot(Array<T>& cache)
+{
+    if (cache.Size() < cache.MaxSize()) {
+        if (auto err = cache.EmplaceBack(); !err.IsNone()) {
+            return nullptr;
+        }
+
+        return &cache.Back();
+    }
+
+    auto slot = cache.begin();
+
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if (it->mLastUsed < slot->mLastUsed) {
+            slot = it;
+        }
+    }
+
+    return slot;
+}
+
+} // namespace
+
 /***********************************************************************************************************************
  * Public
  **********************************************************************************************************************/
@@ -29,7 +59,7 @@ Error CryptoHelper::Init(iamclient::CertProviderItf& certProvider, CryptoProvide
     mCertLoader          = &certLoader;
     mServiceDiscoveryURL = serviceDiscoveryURL;
 
-    auto caCertsPEM = MakeUnique<StaticString<cCertPEMLen>>(&mAllocator);
+    auto caCertsPEM = MakeUnique<StaticString<cCertPEMLen>>(&mWorkers[0].mAllocator);
 
     if (auto err = fs::ReadFileToString(caCert, *caCertsPEM); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
@@ -39,44 +69,74 @@ Error CryptoHelper::Init(iamclient::CertProviderItf& certProvider, CryptoProvide
         return AOS_ERROR_WRAP(err);
     }
 
+    if (auto err = mCertProvider->SubscribeListener(cOnlineCert, *this); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    mSubscribed = true;
+
+    return ErrorEnum::eNone;
+}
+
+Error CryptoHelper::Deinit()
+{
+    if (!mSubscribed) {
+        return ErrorEnum::eNone;
+    }
+
+    mSubscribed = false;
+
+    if (auto err = mCertProvider->UnsubscribeListener(*this); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     return ErrorEnum::eNone;
 }
 
 Error CryptoHelper::GetServiceDiscoveryURLs(Array<StaticString<cURLLen>>& urls)
 {
-    LockGuard lock {mSemaphore};
+    uint64_t generation = 0;
 
-    const auto [certs, certErr] = GetOnlineCert();
-    if (!certErr.IsNone()) {
-        return SetDefaultServiceDiscoveryURL(urls);
+    {
+        LockGuard lock {mServiceDiscoveryMutex};
+
+        if (mServiceDiscoveryCached) {
+            return AOS_ERROR_WRAP(urls.Insert(urls.end(), mServiceDiscoveryURLs.begin(), mServiceDiscoveryURLs.end()));
+        }
+
+        generation = mOnlineCertGeneration;
     }
 
-    if (auto err = GetServiceDiscoveryFromExtensions((*certs)[0], urls); !err.IsNone()) {
-        if (!err.Is(ErrorEnum::eNotFound)) {
-            LOG_WRN() << "Can't get service discovery url from extensions" << Log::Field(err);
+    auto& worker        = AcquireWorker();
+    auto  releaseWorker = DeferRelease(&worker, [this](Worker* item) { ReleaseWorker(*item); });
 
+    auto foundURLs = MakeUnique<StaticArray<StaticString<cURLLen>, cMaxNumURLs>>(&worker.mAllocator);
+
+    if (auto err = FindServiceDiscoveryURLs(*foundURLs, worker.mAllocator); !err.IsNone()) {
+        if (!err.Is(ErrorEnum::eNotFound)) {
             return err;
         }
-    } else {
-        return ErrorEnum::eNone;
+
+        return SetDefaultServiceDiscoveryURL(urls);
     }
 
-    if (auto err = GetServiceDiscoveryFromOrganization((*certs)[0], urls); !err.IsNone()) {
-        if (!err.Is(ErrorEnum::eNotFound)) {
-            LOG_WRN() << "Can't get service discovery url from organization" << Log::Field(err);
+    {
+        LockGuard lock {mServiceDiscoveryMutex};
 
-            return err;
+        // Don't cache URLs if online certificate was changed while they were being parsed.
+        if (generation == mOnlineCertGeneration) {
+            mServiceDiscoveryURLs   = *foundURLs;
+            mServiceDiscoveryCached = true;
         }
-    } else {
-        return ErrorEnum::eNone;
     }
 
-    return SetDefaultServiceDiscoveryURL(urls);
+    return AOS_ERROR_WRAP(urls.Insert(urls.end(), foundURLs->begin(), foundURLs->end()));
 }
 
 Error CryptoHelper::Decrypt(const String& encryptedFile, const String& decryptedFile, const DecryptInfo& decryptInfo)
 {
-    LockGuard lock {mSemaphore};
+    auto& worker        = AcquireWorker();
+    auto  releaseWorker = DeferRelease(&worker, [this](Worker* item) { ReleaseWorker(*item); });
 
     const auto& symmetricAlgName = decryptInfo.mBlockAlg;
     const auto& sessionKey       = decryptInfo.mBlockKey;
@@ -98,7 +158,7 @@ Error CryptoHelper::Decrypt(const String& encryptedFile, const String& decrypted
         return AOS_ERROR_WRAP(checkErr);
     }
 
-    if (auto decodeErr = DecodeFile(encryptedFile, decryptedFile, *decoder); !decodeErr.IsNone()) {
+    if (auto decodeErr = DecodeFile(encryptedFile, decryptedFile, *decoder, worker.mAllocator); !decodeErr.IsNone()) {
         return AOS_ERROR_WRAP(decodeErr);
     }
 
@@ -108,9 +168,10 @@ Error CryptoHelper::Decrypt(const String& encryptedFile, const String& decrypted
 Error CryptoHelper::ValidateSigns(const String& decryptedPath, const SignInfo& signs,
     const Array<CertificateChainInfo>& chains, const Array<CertificateInfo>& certs)
 {
-    LockGuard lock {mSemaphore};
+    auto& worker        = AcquireWorker();
+    auto  releaseWorker = DeferRelease(&worker, [this](Worker* item) { ReleaseWorker(*item); });
 
-    auto signCtx = MakeUnique<SignContext>(&mAllocator);
+    auto signCtx = MakeUnique<SignContext>(&worker.mAllocator);
 
     if (auto err = AddCertificates(certs, *signCtx); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
@@ -120,7 +181,7 @@ Error CryptoHelper::ValidateSigns(const String& decryptedPath, const SignInfo& s
         return AOS_ERROR_WRAP(err);
     }
 
-    if (auto err = VerifySigns(decryptedPath, signs, *signCtx); !err.IsNone()) {
+    if (auto err = VerifySigns(decryptedPath, signs, *signCtx, worker.mAllocator); !err.IsNone()) {
         return err;
     }
 
@@ -129,10 +190,11 @@ Error CryptoHelper::ValidateSigns(const String& decryptedPath, const SignInfo& s
 
 Error CryptoHelper::DecryptMetadata(const Array<uint8_t>& input, Array<uint8_t>& output)
 {
-    LockGuard lock {mSemaphore};
+    auto& worker        = AcquireWorker();
+    auto  releaseWorker = DeferRelease(&worker, [this](Worker* item) { ReleaseWorker(*item); });
 
-    auto contentInfo = MakeUnique<ContentInfo>(&mAllocator);
-    auto symKey      = MakeUnique<StaticArray<uint8_t, cPrivKeyPEMLen>>(&mAllocator);
+    auto contentInfo = MakeUnique<ContentInfo>(&worker.mAllocator);
+    auto symKey      = MakeUnique<StaticArray<uint8_t, cPrivKeyPEMLen>>(&worker.mAllocator);
 
     auto err = UnmarshalCMS(input, *contentInfo);
     if (!err.IsNone()) {
@@ -140,13 +202,13 @@ Error CryptoHelper::DecryptMetadata(const Array<uint8_t>& input, Array<uint8_t>&
     }
 
     for (const auto& recipient : contentInfo->mEnvelopeData.mRecipientInfos) {
-        err = GetKeyForEnvelope(recipient, *symKey);
+        err = GetKeyForEnvelope(recipient, *symKey, worker.mAllocator);
         if (!err.IsNone()) {
             LOG_WRN() << "Can't get key for envelope" << Log::Field(err);
             continue;
         }
 
-        err = DecryptMessage(contentInfo->mEnvelopeData.mEncryptedContent, *symKey, output);
+        err = DecryptMessage(contentInfo->mEnvelopeData.mEncryptedContent, *symKey, output, worker.mAllocator);
         if (!err.IsNone()) {
             LOG_WRN() << "Can't decrypt message" << Log::Field(err);
             continue;
@@ -162,9 +224,82 @@ Error CryptoHelper::DecryptMetadata(const Array<uint8_t>& input, Array<uint8_t>&
  * Private
  **********************************************************************************************************************/
 
-RetWithError<SharedPtr<x509::CertificateChain>> CryptoHelper::GetOnlineCert()
+void CryptoHelper::OnCertChanged(const CertInfo& info)
 {
-    auto certInfo = MakeUnique<CertInfo>(&mAllocator);
+    (void)info;
+
+    LockGuard lock {mServiceDiscoveryMutex};
+
+    LOG_DBG() << "Online certificate changed, reset service discovery URLs";
+
+    mServiceDiscoveryCached = false;
+    mOnlineCertGeneration++;
+
+    mServiceDiscoveryURLs.Clear();
+}
+
+CryptoHelper::Worker& CryptoHelper::AcquireWorker()
+{
+    mSemaphore.Lock();
+
+    LockGuard lock {mWorkersMutex};
+
+    // Semaphore guarantees that at least one worker is free.
+    auto worker = mWorkers;
+
+    while (worker->mBusy) {
+        worker++;
+    }
+
+    worker->mBusy = true;
+
+    return *worker;
+}
+
+void CryptoHelper::ReleaseWorker(Worker& worker)
+{
+    {
+        LockGuard lock {mWorkersMutex};
+
+        worker.mBusy = false;
+    }
+
+    mSemaphore.Unlock();
+}
+
+Error CryptoHelper::FindServiceDiscoveryURLs(Array<StaticString<cURLLen>>& urls, Allocator& allocator)
+{
+    const auto [certs, certErr] = GetOnlineCert(allocator);
+    if (!certErr.IsNone()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "online certificate not found"));
+    }
+
+    if (auto err = GetServiceDiscoveryFromExtensions((*certs)[0], urls); !err.IsNone()) {
+        if (!err.Is(ErrorEnum::eNotFound)) {
+            LOG_WRN() << "Can't get service discovery url from extensions" << Log::Field(err);
+
+            return err;
+        }
+    } else {
+        return ErrorEnum::eNone;
+    }
+
+    if (auto err = GetServiceDiscoveryFromOrganization((*certs)[0], urls, allocator); !err.IsNone()) {
+        if (!err.Is(ErrorEnum::eNotFound)) {
+            LOG_WRN() << "Can't get service discovery url from organization" << Log::Field(err);
+
+            return err;
+        }
+    } else {
+        return ErrorEnum::eNone;
+    }
+
+    return SetDefaultServiceDiscoveryURL(urls);
+}
+
+RetWithError<SharedPtr<x509::CertificateChain>> CryptoHelper::GetOnlineCert(Allocator& allocator)
+{
+    auto certInfo = MakeUnique<CertInfo>(&allocator);
     if (auto err = mCertProvider->GetCert(cOnlineCert, {}, {}, *certInfo); !err.IsNone()) {
         return {{}, AOS_ERROR_WRAP(err)};
     }
@@ -203,9 +338,9 @@ Error CryptoHelper::GetServiceDiscoveryFromExtensions(const x509::Certificate& c
 }
 
 Error CryptoHelper::GetServiceDiscoveryFromOrganization(
-    const x509::Certificate& cert, Array<StaticString<cURLLen>>& urls)
+    const x509::Certificate& cert, Array<StaticString<cURLLen>>& urls, Allocator& allocator)
 {
-    auto subject = MakeUnique<StaticString<cCertSubjSize>>(&mAllocator);
+    auto subject = MakeUnique<StaticString<cCertSubjSize>>(&allocator);
 
     if (auto err = mCryptoProvider->ASN1DecodeDN(cert.mSubject, *subject); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
@@ -221,8 +356,8 @@ Error CryptoHelper::GetServiceDiscoveryFromOrganization(
     auto valueStart    = orgPos + orgKey.Size();
     auto [valueEnd, _] = subject->FindSubstr(valueStart, ",");
 
-    auto orgName = MakeUnique<StaticString<cURLLen>>(&mAllocator);
-    auto url     = MakeUnique<StaticString<cURLLen>>(&mAllocator);
+    auto orgName = MakeUnique<StaticString<cURLLen>>(&allocator);
+    auto url     = MakeUnique<StaticString<cURLLen>>(&allocator);
 
     auto assignErr = orgName->Insert(orgName->begin(), subject->begin() + valueStart, subject->begin() + valueEnd);
     if (!assignErr.IsNone()) {
@@ -329,14 +464,15 @@ Error CryptoHelper::CheckSessionKey(
     return ErrorEnum::eNone;
 }
 
-Error CryptoHelper::DecodeFile(const String& encryptedFile, const String& decryptedFile, AESCipherItf& decoder)
+Error CryptoHelper::DecodeFile(
+    const String& encryptedFile, const String& decryptedFile, AESCipherItf& decoder, Allocator& allocator)
 {
-    auto inBlock  = MakeUnique<StaticArray<uint8_t, cFileChunkSize>>(&mAllocator);
-    auto outBlock = MakeUnique<StaticArray<uint8_t, cFileChunkSize>>(&mAllocator);
+    auto inBlock  = MakeUnique<StaticArray<uint8_t, cFileChunkSize>>(&allocator);
+    auto outBlock = MakeUnique<StaticArray<uint8_t, cFileChunkSize>>(&allocator);
 
     fs::File inputFile, outputFile;
 
-    Error err = inputFile.Open(encryptedFile, fs::File::Mode::Read);
+    Error err = inputFile.Open(encryptedFile, fs::File::Mode::ReadSequential);
     if (!err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
@@ -410,18 +546,23 @@ Error CryptoHelper::AddCertificates(const Array<CertificateInfo>& certs, SignCon
             continue;
         }
 
-        auto cert = MakeUnique<x509::Certificate>(&mAllocator);
-
-        if (auto err = mCryptoProvider->DERToX509Cert(certInfo.mCertificate, *cert); !err.IsNone()) {
+        if (auto err = ctx.mCerts.EmplaceBack(); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
 
-        if (auto err = ctx.mCerts.EmplaceBack(); !err.IsNone()) {
+        auto& cert = ctx.mCerts.Back();
+
+        cert.mFingerprint = fingerprint;
+
+        if (GetCachedCert(certInfo, cert)) {
+            continue;
+        }
+
+        if (auto err = mCryptoProvider->DERToX509Cert(certInfo.mCertificate, cert.mCertificate); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
 
-        ctx.mCerts.Back().mCertificate = *cert;
-        ctx.mCerts.Back().mFingerprint = fingerprint;
+        CacheCert(cert);
     }
 
     return ErrorEnum::eNone;
@@ -454,7 +595,7 @@ Error CryptoHelper::AddCertChains(const Array<CertificateChainInfo>& chains, Sig
     return ErrorEnum::eNone;
 }
 
-Error CryptoHelper::VerifySigns(const String& file, const SignInfo& signs, SignContext& signCtx)
+Error CryptoHelper::VerifySigns(const String& file, const SignInfo& signs, SignContext& signCtx, Allocator& allocator)
 {
     x509::Certificate*    signCert = nullptr;
     CertificateChainInfo* chain    = nullptr;
@@ -475,7 +616,7 @@ Error CryptoHelper::VerifySigns(const String& file, const SignInfo& signs, SignC
     }
 
     // Verify sign
-    auto hashSum = MakeUnique<StaticArray<uint8_t, cMaxHashSize>>(&mAllocator);
+    auto hashSum = MakeUnique<StaticArray<uint8_t, cMaxHashSize>>(&allocator);
 
     if (auto err = CalculateFileHash(file, hash, *mCryptoProvider, *hashSum); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
@@ -500,21 +641,10 @@ Error CryptoHelper::VerifySigns(const String& file, const SignInfo& signs, SignC
     }
 
     // Verify certs
-    auto intermCertPool = MakeUnique<StaticArray<x509::Certificate, cMaxNumCertificates>>(&mAllocator);
-
-    if (auto err = CreateIntermCertPool(signCtx, *chain, *intermCertPool); !err.IsNone()) {
+    if (auto err = VerifyChain(signCtx, *chain, *signCert, signs.mTrustedTimestamp, allocator); !err.IsNone()) {
         return err;
     }
 
-    x509::VerifyOptions options;
-
-    options.mCurrentTime = signs.mTrustedTimestamp;
-    // Assume any key usages.
-
-    if (auto err = mCryptoProvider->Verify(mCACerts, *intermCertPool, options, *signCert); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
-
     return ErrorEnum::eNone;
 }
 
@@ -643,6 +773,175 @@ Error CryptoHelper::CreateIntermCertPool(
     return ErrorEnum::eNone;
 }
 
+Error CryptoHelper::VerifyChain(SignContext& signCtx, const CertificateChainInfo& chain,
+    const x509::Certificate& signCert, const Time& trustedTimestamp, Allocator& allocator)
+{
+    StaticArray<uint64_t, cCertChainSize> certIDs;
+
+    if (auto err = GetChainCertIDs(signCtx, chain, certIDs); !err.IsNone()) {
+        return err;
+    }
+
+    if (IsChainVerified(chain.mName, certIDs, trustedTimestamp)) {
+        LOG_DBG() << "Certificate chain already verified" << Log::Field("chain", chain.mName);
+
+        return ErrorEnum::eNone;
+    }
+
+    auto intermCertPool = MakeUnique<StaticArray<x509::Certificate, cMaxNumCertificates>>(&allocator);
+
+    if (auto err = CreateIntermCertPool(signCtx, chain, *intermCertPool); !err.IsNone()) {
+        return err;
+    }
+
+    x509::VerifyOptions options;
+
+    options.mCurrentTime = trustedTimestamp;
+    // Assume any key usages.
+
+    if (auto err = mCryptoProvider->Verify(mCACerts, *intermCertPool, options, signCert); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = CacheVerifiedChain(signCtx, chain, certIDs); !err.IsNone()) {
+        LOG_WRN() << "Can't cache verified certificate chain" << Log::Field("chain", chain.mName) << Log::Field(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+bool CryptoHelper::GetCachedCert(const CertificateInfo& certInfo, X509CertificateInfo& cert)
+{
+    LockGuard lock {mCacheMutex};
+
+    // Match by DER content as well: fingerprint is provided by the caller and is not trusted.
+    auto it = mCertCache.FindIf([&certInfo, &cert](const CachedCertificate& cached) {
+        return cached.mInfo.mFingerprint == cert.mFingerprint
+            && cached.mInfo.mCertificate.mRaw == certInfo.mCertificate;
+    });
+
+    if (it == mCertCache.end()) {
+        return false;
+    }
+
+    it->mLastUsed = ++mCacheCounter;
+    cert          = it->mInfo;
+
+    return true;
+}
+
+void CryptoHelper::CacheCert(X509CertificateInfo& cert)
+{
+    LockGuard lock {mCacheMutex};
+
+    cert.mCacheID = ++mCacheCounter;
+
+    auto slot = GetCacheSlot<CachedCertificate>(mCertCache);
+    if (slot == nullptr) {
+        return;
+    }
+
+    slot->mInfo     = cert;
+    slot->mLastUsed = cert.mCacheID;
+}
+
+Error CryptoHelper::GetChainCertIDs(SignContext& signCtx, const CertificateChainInfo& chain, Array<uint64_t>& ids)
+{
+    ids.Clear();
+
+    for (const auto& fingerprint : chain.mFingerprints) {
+        auto it = signCtx.mCerts.FindIf(
+            [&fingerprint](const X509CertificateInfo& info) { return info.mFingerprint == fingerprint; });
+
+        if (it == signCtx.mCerts.end()) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "chain certificate is absent"));
+        }
+
+        if (auto err = ids.PushBack(it->mCacheID); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+bool CryptoHelper::IsChainVerified(const String& chainName, const Array<uint64_t>& ids, const Time& trustedTimestamp)
+{
+    LockGuard lock {mCacheMutex};
+
+    auto it = mVerifiedChains.FindIf([&](const VerifiedChain& chain) {
+        return chain.mName == chainName && chain.mCertIDs == ids && !(trustedTimestamp < chain.mNotBefore)
+            && !(chain.mNotAfter < trustedTimestamp);
+    });
+
+    if (it == mVerifiedChains.end()) {
+        return false;
+    }
+
+    it->mLastUsed = ++mCacheCounter;
+
+    return true;
+}
+
+Error CryptoHelper::CacheVerifiedChain(
+    SignContext& signCtx, const CertificateChainInfo& chain, const Array<uint64_t>& ids)
+{
+    Time                     notBefore, notAfter;
+    const x509::Certificate* lastCert = nullptr;
+
+    // Verification result depends on trusted timestamp only through certificates validity, so it stays valid within
+    // intersection of validity periods of chain certificates and their trust anchors.
+    for (const auto& fingerprint : chain.mFingerprints) {
+        auto [cert, err] = GetCert(signCtx, fingerprint);
+        if (!err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (lastCert == nullptr || notBefore < cert->mNotBefore) {
+            notBefore = cert->mNotBefore;
+        }
+
+        if (lastCert == nullptr || cert->mNotAfter < notAfter) {
+            notAfter = cert->mNotAfter;
+        }
+
+        lastCert = cert;
+    }
+
+    for (const auto& caCert : mCACerts) {
+        if (lastCert == nullptr || caCert.mSubject != lastCert->mIssuer) {
+            continue;
+        }
+
+        if (notBefore < caCert.mNotBefore) {
+            notBefore = caCert.mNotBefore;
+        }
+
+        if (caCert.mNotAfter < notAfter) {
+            notAfter = caCert.mNotAfter;
+        }
+    }
+
+    LockGuard lock {mCacheMutex};
+
+    auto slot = mVerifiedChains.FindIf(
+        [&](const VerifiedChain& item) { return item.mName == chain.mName && item.mCertIDs == ids; });
+    if (slot == mVerifiedChains.end()) {
+        slot = GetCacheSlot<VerifiedChain>(mVerifiedChains);
+        if (slot == nullptr) {
+            return AOS_ERROR_WRAP(ErrorEnum::eNoMemory);
+        }
+    }
+
+    slot->mName      = chain.mName;
+    slot->mCertIDs   = ids;
+    slot->mNotBefore = notBefore;
+    slot->mNotAfter  = notAfter;
+    slot->mLastUsed  = ++mCacheCounter;
+
+    return ErrorEnum::eNone;
+}
+
 Error CryptoHelper::UnmarshalCMS(const Array<uint8_t>& der, ContentInfo& content)
 {
     auto contentInfoParser = asn1::MakeASN1Reader(
@@ -854,9 +1153,10 @@ Error CryptoHelper::ParseEncryptedContentInfo(const Array<uint8_t>& data, Encryp
     return ErrorEnum::eNone;
 }
 
-Error CryptoHelper::GetKeyForEnvelope(const TransRecipientInfo& info, Array<uint8_t>& symmetricKey)
+Error CryptoHelper::GetKeyForEnvelope(
+    const TransRecipientInfo& info, Array<uint8_t>& symmetricKey, Allocator& allocator)
 {
-    auto certInfo = MakeUnique<CertInfo>(&mAllocator);
+    auto certInfo = MakeUnique<CertInfo>(&allocator);
 
     auto err = mCertProvider->GetCert(cOfflineCert, info.mRID.mIssuer, info.mRID.mSerial, *certInfo);
     if (!err.IsNone()) {
@@ -893,7 +1193,7 @@ Error CryptoHelper::DecryptCMSKey(
 }
 
 Error CryptoHelper::DecryptMessage(
-    const EncryptedContentInfo& content, const Array<uint8_t>& symKey, Array<uint8_t>& message)
+    const EncryptedContentInfo& content, const Array<uint8_t>& symKey, Array<uint8_t>& message, Allocator& allocator)
 {
     static constexpr auto cTagOctetString = 4;
 
@@ -915,12 +1215,13 @@ Error CryptoHelper::DecryptMessage(
         return AOS_ERROR_WRAP(err);
     }
 
-    return DecodeMessage(*decoder, content.mEncryptedContent, message);
+    return DecodeMessage(*decoder, content.mEncryptedContent, message, allocator);
 }
 
-Error CryptoHelper::DecodeMessage(AESCipherItf& decoder, const Array<uint8_t>& input, Array<uint8_t>& message)
+Error CryptoHelper::DecodeMessage(
+    AESCipherItf& decoder, const Array<uint8_t>& input, Array<uint8_t>& message, Allocator& allocator)
 {
-    auto outBlock = MakeUnique<StaticArray<uint8_t, cFileChunkSize>>(&mAllocator);
+    auto outBlock = MakeUnique<StaticArray<uint8_t, cFileChunkSize>>(&allocator);
 
     if (input.Size() % AESCipherItf::cBlockSize != 0) {
         return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "message should be a multiple of CBC block size"));
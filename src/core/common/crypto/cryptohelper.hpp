@@ -74,6 +74,11 @@ struct X509CertificateInfo {
      * Certificate fingerprint.
      */
     StaticString<cCertFingerprintLen> mFingerprint;
+
+    /**
+     * Certificate cache ID.
+     */
+    uint64_t mCacheID {};
 };
 
 /**
@@ -87,7 +92,7 @@ struct SignContext {
 /**
  * CryptoHelper implementation.
  */
-class CryptoHelper : public CryptoHelperItf {
+class CryptoHelper : public CryptoHelperItf, private iamclient::CertListenerItf {
 public:
     /**
      * Constructor
@@ -107,9 +112,20 @@ public:
     Error Init(iamclient::CertProviderItf& certProvider, CryptoProviderItf& cryptoProvider, CertLoaderItf& certLoader,
         const String& serviceDiscoveryURL, const String& caCert);
 
+    /**
+     * Deinitializes crypto helper.
+     *
+     * Must be called by the owner before the crypto helper or the certificate provider is destroyed.
+     *
+     * @return Error.
+     */
+    Error Deinit();
+
     /**
      * Retrieves available service discovery URLs.
      *
+     * URLs found in the online certificate are cached until the online certificate is changed.
+     *
      * @param[out] urls result URLs.
      * @return Error.
      */
@@ -157,24 +173,57 @@ private:
     static constexpr auto cRSAEncryptionOid = "1.2.840.113549.1.1.1";
     static constexpr auto cAES256CBCOid     = "2.16.840.1.101.3.4.1.42";
 
-    static constexpr auto cThreadHeapUsage = 2 * sizeof(CertInfo) + sizeof(StaticString<cCertSubjSize>)
-        + sizeof(StaticArray<uint8_t, cCertPEMLen>) + sizeof(SignContext) + sizeof(x509::Certificate)
-        + sizeof(StaticArray<uint8_t, cMaxHashSize>) + sizeof(StaticArray<x509::Certificate, cMaxNumCertificates>)
-        + sizeof(StaticArray<uint8_t, cFileChunkSize>) * 2 + sizeof(StaticString<cURLLen>) * 2;
-
-    RetWithError<SharedPtr<x509::CertificateChain>> GetOnlineCert();
+    static constexpr auto cInitHeapUsage = sizeof(StaticString<cCertPEMLen>);
+    static constexpr auto cServiceDiscoveryHeapUsage = sizeof(StaticArray<StaticString<cURLLen>, cMaxNumURLs>)
+        + sizeof(CertInfo) + sizeof(StaticString<cCertSubjSize>) + sizeof(StaticString<cURLLen>) * 2;
+    static constexpr auto cDecryptHeapUsage       = sizeof(StaticArray<uint8_t, cFileChunkSize>) * 2;
+    static constexpr auto cValidateSignsHeapUsage = sizeof(SignContext) + sizeof(StaticArray<uint8_t, cMaxHashSize>)
+        + sizeof(StaticArray<x509::Certificate, cMaxNumCertificates>);
+    static constexpr auto cDecryptMetadataHeapUsage = sizeof(ContentInfo) + sizeof(StaticArray<uint8_t, cPrivKeyPEMLen>)
+        + sizeof(CertInfo) + sizeof(StaticArray<uint8_t, cFileChunkSize>);
+    static constexpr auto cWorkerHeapUsage = Max(cInitHeapUsage, cServiceDiscoveryHeapUsage, cDecryptHeapUsage,
+        cValidateSignsHeapUsage, cDecryptMetadataHeapUsage);
+
+    // Each concurrent operation gets its own worker, so operations don't contend on shared allocator.
+    struct Worker {
+        StaticAllocator<cWorkerHeapUsage> mAllocator;
+        bool                              mBusy {};
+    };
+
+    struct CachedCertificate {
+        X509CertificateInfo mInfo;
+        uint64_t            mLastUsed {};
+    };
+
+    struct VerifiedChain {
+        StaticString<cChainNameLen>           mName;
+        StaticArray<uint64_t, cCertChainSize> mCertIDs;
+        Time                                  mNotBefore;
+        Time                                  mNotAfter;
+        uint64_t                              mLastUsed {};
+    };
+
+    void OnCertChanged(const CertInfo& info) override;
+
+    Worker& AcquireWorker();
+    void    ReleaseWorker(Worker& worker);
+
+    RetWithError<SharedPtr<x509::CertificateChain>> GetOnlineCert(Allocator& allocator);
     Error                                           SetDefaultServiceDiscoveryURL(Array<StaticString<cURLLen>>& urls);
+    Error FindServiceDiscoveryURLs(Array<StaticString<cURLLen>>& urls, Allocator& allocator);
     Error GetServiceDiscoveryFromExtensions(const x509::Certificate& cert, Array<StaticString<cURLLen>>& urls);
-    Error GetServiceDiscoveryFromOrganization(const x509::Certificate& cert, Array<StaticString<cURLLen>>& urls);
+    Error GetServiceDiscoveryFromOrganization(
+        const x509::Certificate& cert, Array<StaticString<cURLLen>>& urls, Allocator& allocator);
 
     Error DecodeSymAlgNames(const String& algString, String& algName, String& modeName, String& paddingName);
     Error GetSymmetricAlgInfo(const String& algName, size_t& keySize, size_t& ivSize);
     Error CheckSessionKey(const String& symAlgName, const Array<uint8_t>& sessionIV, const Array<uint8_t>& sessionKey);
-    Error DecodeFile(const String& encryptedFile, const String& decryptedFile, AESCipherItf& decoder);
+    Error DecodeFile(
+        const String& encryptedFile, const String& decryptedFile, AESCipherItf& decoder, Allocator& allocator);
 
     Error AddCertificates(const Array<CertificateInfo>& cert, SignContext& ctx);
     Error AddCertChains(const Array<CertificateChainInfo>& chains, SignContext& ctx);
-    Error VerifySigns(const String& file, const SignInfo& signs, SignContext& signCtx);
+    Error VerifySigns(const String& file, const SignInfo& signs, SignContext& signCtx, Allocator& allocator);
 
     RetWithError<x509::Certificate*> GetCert(SignContext& signCtx, const String& fingerprint);
     Error                            GetSignCert(
@@ -182,6 +231,14 @@ private:
     Error DecodeSignAlgNames(const String& algString, String& algName, String& hashName, String& paddingName);
     RetWithError<Hash> DecodeHash(const String& hashName);
     Error CreateIntermCertPool(SignContext& signCtx, const CertificateChainInfo& chain, Array<x509::Certificate>& pool);
+    Error VerifyChain(SignContext& signCtx, const CertificateChainInfo& chain, const x509::Certificate& signCert,
+        const Time& trustedTimestamp, Allocator& allocator);
+
+    bool  GetCachedCert(const CertificateInfo& certInfo, X509CertificateInfo& cert);
+    void  CacheCert(X509CertificateInfo& cert);
+    Error GetChainCertIDs(SignContext& signCtx, const CertificateChainInfo& chain, Array<uint64_t>& ids);
+    bool  IsChainVerified(const String& chainName, const Array<uint64_t>& ids, const Time& trustedTimestamp);
+    Error CacheVerifiedChain(SignContext& signCtx, const CertificateChainInfo& chain, const Array<uint64_t>& ids);
 
     Error UnmarshalCMS(const Array<uint8_t>& der, ContentInfo& content);
     Error ParseContentInfo(const Array<uint8_t>& data, ContentInfo& content);
@@ -189,20 +246,34 @@ private:
     Error ParseRecipientInfo(const Array<uint8_t>& data, TransRecipientInfo& content);
     Error ParseRID(const Array<uint8_t>& data, RecipientID& content);
     Error ParseEncryptedContentInfo(const Array<uint8_t>& data, EncryptedContentInfo& content);
-    Error GetKeyForEnvelope(const TransRecipientInfo& info, Array<uint8_t>& symmetricKey);
+    Error GetKeyForEnvelope(const TransRecipientInfo& info, Array<uint8_t>& symmetricKey, Allocator& allocator);
     Error DecryptCMSKey(const TransRecipientInfo& ktri, const PrivateKeyItf& privKey, Array<uint8_t>& symmetricKey);
-    Error DecryptMessage(const EncryptedContentInfo& content, const Array<uint8_t>& symKey, Array<uint8_t>& message);
-    Error DecodeMessage(AESCipherItf& decoder, const Array<uint8_t>& input, Array<uint8_t>& message);
+    Error DecryptMessage(const EncryptedContentInfo& content, const Array<uint8_t>& symKey, Array<uint8_t>& message,
+        Allocator& allocator);
+    Error DecodeMessage(
+        AESCipherItf& decoder, const Array<uint8_t>& input, Array<uint8_t>& message, Allocator& allocator);
 
     iamclient::CertProviderItf* mCertProvider {};
     CryptoProviderItf*          mCryptoProvider {};
     CertLoaderItf*              mCertLoader {};
+    bool                        mSubscribed {};
 
     StaticString<cURLLen>  mServiceDiscoveryURL;
     x509::CertificateChain mCACerts;
 
-    Semaphore                                                  mSemaphore;
-    StaticAllocator<cMaxNumConcurrentItems * cThreadHeapUsage> mAllocator;
+    Semaphore mSemaphore;
+    Mutex     mWorkersMutex;
+    Worker    mWorkers[cMaxNumConcurrentItems];
+
+    Mutex                                           mServiceDiscoveryMutex;
+    bool                                            mServiceDiscoveryCached {};
+    uint64_t                                        mOnlineCertGeneration {};
+    StaticArray<StaticString<cURLLen>, cMaxNumURLs> mServiceDiscoveryURLs;
+
+    Mutex                                               mCacheMutex;
+    uint64_t                                            mCacheCounter {};
+    StaticArray<CachedCertificate, cCertCacheSize>      mCertCache;
+    StaticArray<VerifiedChain, cVerifiedChainCacheSize> mVerifiedChains;
 };
 
 } // namespace aos::crypto
@@ -17,8 +17,11 @@ namespace {
  * Static
  **********************************************************************************************************************/
 
-Mutex                                sReadBufferMutex;
-StaticArray<uint8_t, cFileChunkSize> sReadBuffer;
+using ReadBuffer = StaticArray<uint8_t, cHashBufferSize>;
+
+Semaphore sReadBufferSemaphore {cFileHashMaxConcurrent};
+
+StaticAllocator<sizeof(ReadBuffer) * cFileHashMaxConcurrent, cFileHashMaxConcurrent> sReadBufferAllocator;
 
 } // namespace
 
@@ -27,6 +30,16 @@ StaticArray<uint8_t, cFileChunkSize> sReadBuffer;
  **********************************************************************************************************************/
 
 Error CalculateFileHash(const String& path, const Hash& algorithm, HasherItf& hashProvider, Array<uint8_t>& hash)
+{
+    LockGuard lock {sReadBufferSemaphore};
+
+    auto buffer = MakeUnique<ReadBuffer>(&sReadBufferAllocator);
+
+    return CalculateFileHash(path, algorithm, hashProvider, *buffer, hash);
+}
+
+Error CalculateFileHash(const String& path, const Hash& algorithm, HasherItf& hashProvider, Array<uint8_t>& buffer,
+    Array<uint8_t>& hash)
 {
     auto [hasher, err] = hashProvider.CreateHash(algorithm);
     if (!err.IsNone()) {
@@ -35,24 +48,22 @@ Error CalculateFileHash(const String& path, const Hash& algorithm, HasherItf& ha
 
     fs::File file;
 
-    err = file.Open(path, fs::File::Mode::Read);
+    err = file.Open(path, fs::File::Mode::ReadSequential);
     if (!err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    LockGuard lock {sReadBufferMutex};
-
     while (true) {
-        err = file.ReadBlock(sReadBuffer);
+        err = file.ReadBlock(buffer);
         if (!err.IsNone() && !err.Is(ErrorEnum::eEOF)) {
             return AOS_ERROR_WRAP(err);
         }
 
-        if (sReadBuffer.IsEmpty()) {
+        if (buffer.IsEmpty()) {
             break;
         }
 
-        err = hasher->Update(sReadBuffer);
+        err = hasher->Update(buffer);
         if (!err.IsNone()) {
             if (!err.Is(ErrorEnum::eEOF)) {
                 return AOS_ERROR_WRAP(err);
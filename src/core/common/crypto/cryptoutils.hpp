@@ -14,6 +14,9 @@ namespace aos::crypto {
 /**
  * Calculates file hash.
  *
+ * Read buffer is taken from internal pool: up to cFileHashMaxConcurrent files are hashed in parallel, further
+ * callers wait for a free buffer.
+ *
  * @param path file path.
  * @param algorithm hash algorithm.
  * @param hashProvider hash provider.
@@ -22,6 +25,19 @@ namespace aos::crypto {
  */
 Error CalculateFileHash(const String& path, const Hash& algorithm, HasherItf& hashProvider, Array<uint8_t>& hash);
 
+/**
+ * Calculates file hash using caller provided read buffer.
+ *
+ * @param path file path.
+ * @param algorithm hash algorithm.
+ * @param hashProvider hash provider.
+ * @param buffer read buffer, its max size defines read block size.
+ * @param hash output hash.
+ * @return Error.
+ */
+Error CalculateFileHash(const String& path, const Hash& algorithm, HasherItf& hashProvider, Array<uint8_t>& buffer,
+    Array<uint8_t>& hash);
+
 } // namespace aos::crypto
 
 #endif
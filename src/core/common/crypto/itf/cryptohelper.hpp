@@ -58,6 +58,16 @@ constexpr auto cOCSPValueLen = AOS_CONFIG_CRYPTO_OCSP_VALUE_LEN;
  */
 constexpr auto cOCSPValuesCount = AOS_CONFIG_CRYPTO_OCSP_VALUES_COUNT;
 
+/**
+ * Number of parsed certificates cached by crypto helper.
+ */
+constexpr auto cCertCacheSize = AOS_CONFIG_CRYPTO_CERT_CACHE_SIZE;
+
+/**
+ * Number of verified certificate chains cached by crypto helper.
+ */
+constexpr auto cVerifiedChainCacheSize = AOS_CONFIG_CRYPTO_VERIFIED_CHAIN_CACHE_SIZE;
+
 /**
  * Certificate info.
  */
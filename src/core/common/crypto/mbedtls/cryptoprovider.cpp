@@ -11,6 +11,7 @@
 #include <time.h>
 #endif
 
+#include <mbedtls/aes.h>
 #include <mbedtls/asn1.h>
 #include <mbedtls/asn1write.h>
 #include <mbedtls/md.h>
@@ -18,6 +19,7 @@
 #include <mbedtls/pem.h>
 #include <mbedtls/pk.h>
 #include <mbedtls/platform.h>
+#include <mbedtls/platform_util.h>
 #include <mbedtls/psa_util.h>
 #include <mbedtls/rsa.h>
 #include <mbedtls/sha1.h>
@@ -574,6 +576,15 @@ Error VerifyECDSASignature(const ECDSAPublicKey& pubKey, const Array<uint8_t>& d
  * Public
  **********************************************************************************************************************/
 
+MbedTLSCryptoProvider::~MbedTLSCryptoProvider()
+{
+    for (auto& cipherCtx : mCipherCtxs) {
+        if (cipherCtx.mInfo) {
+            mbedtls_cipher_free(&cipherCtx.mCtx);
+        }
+    }
+}
+
 Error MbedTLSCryptoProvider::Init()
 {
     LOG_DBG() << "Init mbedTLS crypto provider";
@@ -1055,7 +1066,7 @@ RetWithError<UniquePtr<AESCipherItf>> MbedTLSCryptoProvider::CreateAESEncoder(
         return {{}, AOS_ERROR_WRAP(ErrorEnum::eNotSupported)};
     }
 
-    auto cipher = MakeUnique<MbedTLSAESCipher>(&mAllocator);
+    auto cipher = MakeUnique<MbedTLSAESCipher>(&mAllocator, *this);
 
     auto err = cipher->Init(key, iv, true);
     if (!err.IsNone()) {
@@ -1072,7 +1083,7 @@ RetWithError<UniquePtr<AESCipherItf>> MbedTLSCryptoProvider::CreateAESDecoder(
         return {{}, AOS_ERROR_WRAP(ErrorEnum::eNotSupported)};
     }
 
-    auto cipher = MakeUnique<MbedTLSAESCipher>(&mAllocator);
+    auto cipher = MakeUnique<MbedTLSAESCipher>(&mAllocator, *this);
 
     auto err = cipher->Init(key, iv, false);
     if (!err.IsNone()) {
@@ -1588,6 +1599,11 @@ static const mbedtls_cipher_info_t* GetAesCbcInfoByKeySize(size_t keySize)
     }
 }
 
+MbedTLSCryptoProvider::MbedTLSAESCipher::MbedTLSAESCipher(MbedTLSCryptoProvider& provider)
+    : mProvider(provider)
+{
+}
+
 Error MbedTLSCryptoProvider::MbedTLSAESCipher::Init(const Array<uint8_t>& key, const Array<uint8_t>& iv, bool encrypt)
 {
     if (iv.Size() != 16) {
@@ -1599,50 +1615,42 @@ Error MbedTLSCryptoProvider::MbedTLSAESCipher::Init(const Array<uint8_t>& key, c
         return AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument);
     }
 
-    mbedtls_cipher_init(&mCtx);
-    auto releaseCtx = DeferRelease(&mCtx, mbedtls_cipher_free);
-
-    int ret = mbedtls_cipher_setup(&mCtx, info);
-    if (ret != 0) {
-        return AOS_ERROR_WRAP(ErrorEnum::eFailed);
+    auto [ctx, err] = mProvider.AcquireCipherCtx(info);
+    if (!err.IsNone()) {
+        return err;
     }
 
-    ret = mbedtls_cipher_set_padding_mode(&mCtx, MBEDTLS_PADDING_PKCS7);
-    if (ret != 0) {
-        return AOS_ERROR_WRAP(ErrorEnum::eFailed);
-    }
+    auto releaseCtx
+        = DeferRelease(ctx, [this](mbedtls_cipher_context_t* cipherCtx) { mProvider.ReleaseCipherCtx(cipherCtx); });
 
     // Set key (in bits)
-    ret = mbedtls_cipher_setkey(
-        &mCtx, key.Get(), static_cast<int>(key.Size() * 8), encrypt ? MBEDTLS_ENCRYPT : MBEDTLS_DECRYPT);
+    int ret = mbedtls_cipher_setkey(
+        ctx, key.Get(), static_cast<int>(key.Size() * 8), encrypt ? MBEDTLS_ENCRYPT : MBEDTLS_DECRYPT);
     if (ret != 0) {
         return AOS_ERROR_WRAP(ErrorEnum::eFailed);
     }
 
     // Set IV
-    ret = mbedtls_cipher_set_iv(&mCtx, iv.Get(), iv.Size());
+    ret = mbedtls_cipher_set_iv(ctx, iv.Get(), iv.Size());
     if (ret != 0) {
         return AOS_ERROR_WRAP(ErrorEnum::eFailed);
     }
 
     // Reset (prepare for update/finish)
-    ret = mbedtls_cipher_reset(&mCtx);
+    ret = mbedtls_cipher_reset(ctx);
     if (ret != 0) {
         return AOS_ERROR_WRAP(ErrorEnum::eFailed);
     }
 
-    mInfo        = info;
-    mEncrypt     = encrypt;
-    mInitialized = true;
-
-    releaseCtx.Release();
+    mCtx     = releaseCtx.Release();
+    mEncrypt = encrypt;
 
     return ErrorEnum::eNone;
 }
 
 Error MbedTLSCryptoProvider::MbedTLSAESCipher::EncryptBlock(const Array<uint8_t>& input, Array<uint8_t>& output)
 {
-    if (!mInitialized) {
+    if (!mCtx) {
         return AOS_ERROR_WRAP(ErrorEnum::eWrongState);
     }
 
@@ -1657,7 +1665,7 @@ Error MbedTLSCryptoProvider::MbedTLSAESCipher::EncryptBlock(const Array<uint8_t>
     output.Resize(output.MaxSize());
 
     size_t outLen = 0;
-    int    ret    = mbedtls_cipher_update(&mCtx, input.Get(), input.Size(), output.Get(), &outLen);
+    int    ret    = mbedtls_cipher_update(mCtx, input.Get(), input.Size(), output.Get(), &outLen);
     if (ret != 0) {
         return AOS_ERROR_WRAP(ErrorEnum::eFailed);
     }
@@ -1669,7 +1677,7 @@ Error MbedTLSCryptoProvider::MbedTLSAESCipher::EncryptBlock(const Array<uint8_t>
 
 Error MbedTLSCryptoProvider::MbedTLSAESCipher::DecryptBlock(const Array<uint8_t>& input, Array<uint8_t>& output)
 {
-    if (!mInitialized) {
+    if (!mCtx) {
         return AOS_ERROR_WRAP(ErrorEnum::eWrongState);
     }
 
@@ -1684,7 +1692,7 @@ Error MbedTLSCryptoProvider::MbedTLSAESCipher::DecryptBlock(const Array<uint8_t>
     output.Resize(output.MaxSize());
 
     size_t outLen = 0;
-    int    ret    = mbedtls_cipher_update(&mCtx, input.Get(), input.Size(), output.Get(), &outLen);
+    int    ret    = mbedtls_cipher_update(mCtx, input.Get(), input.Size(), output.Get(), &outLen);
     if (ret != 0) {
         return AOS_ERROR_WRAP(ErrorEnum::eFailed);
     }
@@ -1696,7 +1704,7 @@ Error MbedTLSCryptoProvider::MbedTLSAESCipher::DecryptBlock(const Array<uint8_t>
 
 Error MbedTLSCryptoProvider::MbedTLSAESCipher::Finalize(Array<uint8_t>& output)
 {
-    if (!mInitialized || mInfo == nullptr) {
+    if (!mCtx) {
         return AOS_ERROR_WRAP(ErrorEnum::eWrongState);
     }
 
@@ -1705,30 +1713,104 @@ Error MbedTLSCryptoProvider::MbedTLSAESCipher::Finalize(Array<uint8_t>& output)
     }
 
     size_t outLen = 0;
-    int    ret    = mbedtls_cipher_finish(&mCtx, output.Get(), &outLen);
-    if (ret != 0) {
-        mbedtls_cipher_free(&mCtx);
-        mInitialized = false;
-        mInfo        = nullptr;
+    int    ret    = mbedtls_cipher_finish(mCtx, output.Get(), &outLen);
+
+    mProvider.ReleaseCipherCtx(mCtx);
+    mCtx = nullptr;
 
+    if (ret != 0) {
         return AOS_ERROR_WRAP(ErrorEnum::eFailed);
     }
 
     output.Resize(outLen);
 
-    mbedtls_cipher_free(&mCtx);
-    mInitialized = false;
-    mInfo        = nullptr;
-
     return ErrorEnum::eNone;
 }
 
 MbedTLSCryptoProvider::MbedTLSAESCipher::~MbedTLSAESCipher()
 {
-    if (mInitialized) {
-        mbedtls_cipher_free(&mCtx);
-        mInitialized = false;
-        mInfo        = nullptr;
+    if (mCtx) {
+        mProvider.ReleaseCipherCtx(mCtx);
+        mCtx = nullptr;
+    }
+}
+
+/***********************************************************************************************************************
+ * Cipher contexts implementation
+ **********************************************************************************************************************/
+
+RetWithError<mbedtls_cipher_context_t*> MbedTLSCryptoProvider::AcquireCipherCtx(const mbedtls_cipher_info_t* info)
+{
+    LockGuard lock {mCipherCtxMutex};
+
+    CipherContext* cipherCtx = nullptr;
+
+    // Prefer free context already set up for the same cipher, then never used one, then any free one.
+    for (auto& item : mCipherCtxs) {
+        if (item.mInUse) {
+            continue;
+        }
+
+        if (item.mInfo == info) {
+            cipherCtx = &item;
+
+            break;
+        }
+
+        if (!cipherCtx || (cipherCtx->mInfo && !item.mInfo)) {
+            cipherCtx = &item;
+        }
+    }
+
+    if (!cipherCtx) {
+        return {nullptr, AOS_ERROR_WRAP(ErrorEnum::eNoMemory)};
+    }
+
+    if (cipherCtx->mInfo != info) {
+        if (cipherCtx->mInfo) {
+            mbedtls_cipher_free(&cipherCtx->mCtx);
+            cipherCtx->mInfo = nullptr;
+        }
+
+        mbedtls_cipher_init(&cipherCtx->mCtx);
+
+        if (mbedtls_cipher_setup(&cipherCtx->mCtx, info) != 0
+            || mbedtls_cipher_set_padding_mode(&cipherCtx->mCtx, MBEDTLS_PADDING_PKCS7) != 0) {
+            mbedtls_cipher_free(&cipherCtx->mCtx);
+
+            return {nullptr, AOS_ERROR_WRAP(ErrorEnum::eFailed)};
+        }
+
+        cipherCtx->mInfo = info;
+    }
+
+    cipherCtx->mInUse = true;
+
+    return &cipherCtx->mCtx;
+}
+
+void MbedTLSCryptoProvider::ReleaseCipherCtx(mbedtls_cipher_context_t* ctx)
+{
+    LockGuard lock {mCipherCtxMutex};
+
+    for (auto& item : mCipherCtxs) {
+        if (&item.mCtx == ctx) {
+            // Wipe key schedule, IV and buffered data, but keep cipher set up, so the context can be reused without
+            // heap allocation. mbedtls_aes_free only zeroises AES context, the memory is freed by mbedtls_cipher_free.
+            mbedtls_aes_free(static_cast<mbedtls_aes_context*>(ctx->MBEDTLS_PRIVATE(cipher_ctx)));
+            mbedtls_platform_zeroize(ctx->MBEDTLS_PRIVATE(iv), sizeof(ctx->MBEDTLS_PRIVATE(iv)));
+            mbedtls_platform_zeroize(
+                ctx->MBEDTLS_PRIVATE(unprocessed_data), sizeof(ctx->MBEDTLS_PRIVATE(unprocessed_data)));
+
+            if (mbedtls_cipher_reset(ctx) != 0) {
+                mbedtls_cipher_free(ctx);
+                item.mInfo = nullptr;
+            }
+
+            item.mInUse = false;
+
+            return;
+        }
     }
 }
 
@@ -14,6 +14,8 @@
 #include <mbedtls/x509_csr.h>
 #include <psa/crypto_types.h>
 
+#include <core/common/tools/thread.hpp>
+
 #include "../itf/crypto.hpp"
 #include "driverwrapper.hpp"
 
@@ -24,6 +26,11 @@ namespace aos::crypto {
  */
 class MbedTLSCryptoProvider : public CryptoProviderItf {
 public:
+    /**
+     * Destructor.
+     */
+    ~MbedTLSCryptoProvider();
+
     /**
      * Initializes the object.
      *
@@ -367,6 +374,7 @@ private:
 
     class MbedTLSAESCipher : public crypto::AESCipherItf, private NonCopyable {
     public:
+        explicit MbedTLSAESCipher(MbedTLSCryptoProvider& provider);
         Error Init(const Array<uint8_t>& key, const Array<uint8_t>& iv, bool encrypt = true);
         Error EncryptBlock(const Array<uint8_t>& input, Array<uint8_t>& output) override;
         Error DecryptBlock(const Array<uint8_t>& input, Array<uint8_t>& output) override;
@@ -374,10 +382,15 @@ private:
         ~MbedTLSAESCipher();
 
     private:
-        bool                         mEncrypt = false;
+        MbedTLSCryptoProvider&    mProvider;
+        bool                      mEncrypt = false;
+        mbedtls_cipher_context_t* mCtx     = nullptr;
+    };
+
+    struct CipherContext {
         mbedtls_cipher_context_t     mCtx;
-        const mbedtls_cipher_info_t* mInfo        = nullptr;
-        bool                         mInitialized = false;
+        const mbedtls_cipher_info_t* mInfo  = nullptr;
+        bool                         mInUse = false;
     };
 
     class MbedTLSRSAPrivKey : public crypto::PrivateKeyItf {
@@ -399,6 +412,7 @@ private:
     static constexpr auto cAllocatorSize
         = AOS_CONFIG_CRYPTO_PUB_KEYS_COUNT * Max(sizeof(RSAPublicKey), sizeof(ECDSAPublicKey))
         + AOS_CONFIG_CRYPTO_HASHER_COUNT * sizeof(MBedTLSHash)
+        + AOS_CONFIG_CRYPTO_AES_CIPHER_COUNT * sizeof(MbedTLSAESCipher)
         + AOS_CONFIG_CRYPTO_PRIV_KEYS_COUNT * sizeof(MbedTLSRSAPrivKey);
 
     static int                             VerifyTime(void* data, mbedtls_x509_crt* crt, int depth, uint32_t* flags);
@@ -432,7 +446,15 @@ private:
         mbedtls_x509write_cert& cert, const x509::Certificate& templ, const x509::Certificate& parent);
     Error SetCertificateValidityPeriod(mbedtls_x509write_cert& cert, const x509::Certificate& templ);
 
+    RetWithError<mbedtls_cipher_context_t*> AcquireCipherCtx(const mbedtls_cipher_info_t* info);
+    void                                    ReleaseCipherCtx(mbedtls_cipher_context_t* ctx);
+
     StaticAllocator<cAllocatorSize> mAllocator;
+
+    // Set up cipher contexts are kept for the provider lifetime: context setup allocates cipher state on the heap.
+    // Key material of released contexts is wiped.
+    Mutex         mCipherCtxMutex;
+    CipherContext mCipherCtxs[AOS_CONFIG_CRYPTO_AES_CIPHER_COUNT];
 };
 
 } // namespace aos::crypto
@@ -1247,6 +1247,22 @@ asn1::ASN1ParseResult ReadASN1Container(const Array<uint8_t>& data, const asn1::
 
 OpenSSLCryptoProvider::~OpenSSLCryptoProvider()
 {
+    for (auto ctx : mFreeMDCtxs) {
+        EVP_MD_CTX_free(ctx);
+    }
+
+    for (auto ctx : mFreeCipherCtxs) {
+        EVP_CIPHER_CTX_free(ctx);
+    }
+
+    for (auto type : mMDTypes) {
+        EVP_MD_free(type);
+    }
+
+    for (auto type : mAESCBCTypes) {
+        EVP_CIPHER_free(type);
+    }
+
     mOpenSSLProvider.Unload();
     OSSL_LIB_CTX_free(mLibCtx);
 }
@@ -1765,13 +1781,17 @@ RetWithError<UniquePtr<HashItf>> OpenSSLCryptoProvider::CreateHash(Hash algorith
         return {{}, AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument)};
     }
 
-    auto hasher = MakeUnique<OpenSSLHash>(&mAllocator);
-
-    auto err = hasher->Init(mLibCtx, algorithm.ToString().CStr());
+    auto [type, err] = GetMDType(algorithm);
     if (!err.IsNone()) {
         return {{}, err};
     }
 
+    auto hasher = MakeUnique<OpenSSLHash>(&mAllocator, *this);
+
+    if (err = hasher->Init(type); !err.IsNone()) {
+        return {{}, err};
+    }
+
     return {UniquePtr<HashItf>(Move(hasher)), ErrorEnum::eNone};
 }
 
@@ -1852,9 +1872,9 @@ RetWithError<UniquePtr<AESCipherItf>> OpenSSLCryptoProvider::CreateAESEncoder(
         return {{}, AOS_ERROR_WRAP(ErrorEnum::eNotSupported)};
     }
 
-    auto cipher = MakeUnique<OpenSSLAESCipher>(&mAllocator);
+    auto cipher = MakeUnique<OpenSSLAESCipher>(&mAllocator, *this);
 
-    auto err = cipher->Init(mLibCtx, key, iv, true);
+    auto err = cipher->Init(key, iv, true);
     if (!err.IsNone()) {
         return {{}, err};
     }
@@ -1869,9 +1889,9 @@ RetWithError<UniquePtr<AESCipherItf>> OpenSSLCryptoProvider::CreateAESDecoder(
         return {{}, AOS_ERROR_WRAP(ErrorEnum::eNotSupported)};
     }
 
-    auto cipher = MakeUnique<OpenSSLAESCipher>(&mAllocator);
+    auto cipher = MakeUnique<OpenSSLAESCipher>(&mAllocator, *this);
 
-    auto err = cipher->Init(mLibCtx, key, iv, false);
+    auto err = cipher->Init(key, iv, false);
     if (!err.IsNone()) {
         return {{}, err};
     }
@@ -2368,30 +2388,159 @@ asn1::ASN1ParseResult OpenSSLCryptoProvider::ReadRawValue(
  * Private
  **********************************************************************************************************************/
 
-Error OpenSSLCryptoProvider::OpenSSLHash::Init(OSSL_LIB_CTX* libCtx, const char* mdtype)
+RetWithError<EVP_MD*> OpenSSLCryptoProvider::GetMDType(Hash algorithm)
 {
-    mType = EVP_MD_fetch(libCtx, mdtype, nullptr);
-    if (!mType) {
-        return OPENSSL_ERROR();
+    auto index = static_cast<size_t>(algorithm.GetValue());
+    if (index >= cNumHashTypes) {
+        return {nullptr, AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument)};
     }
 
-    mMDCtx = EVP_MD_CTX_new();
-    if (!mMDCtx) {
-        EVP_MD_free(mType);
-        mType = nullptr;
+    LockGuard lock {mCacheMutex};
 
-        return OPENSSL_ERROR();
+    if (!mMDTypes[index]) {
+        if (mMDTypes[index] = EVP_MD_fetch(mLibCtx, algorithm.ToString().CStr(), nullptr); !mMDTypes[index]) {
+            return {nullptr, OPENSSL_ERROR()};
+        }
+    }
+
+    return mMDTypes[index];
+}
+
+RetWithError<EVP_CIPHER*> OpenSSLCryptoProvider::GetAESCBCType(size_t keySize)
+{
+    size_t      index = 0;
+    const char* name  = nullptr;
+
+    switch (keySize) {
+    case 16:
+        index = 0;
+        name  = "AES-128-CBC";
+        break;
+
+    case 24:
+        index = 1;
+        name  = "AES-192-CBC";
+        break;
+
+    case 32:
+        index = 2;
+        name  = "AES-256-CBC";
+        break;
+
+    default:
+        return {nullptr, AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument)};
+    }
+
+    LockGuard lock {mCacheMutex};
+
+    if (!mAESCBCTypes[index]) {
+        if (mAESCBCTypes[index] = EVP_CIPHER_fetch(mLibCtx, name, nullptr); !mAESCBCTypes[index]) {
+            return {nullptr, OPENSSL_ERROR()};
+        }
+    }
+
+    return mAESCBCTypes[index];
+}
+
+RetWithError<EVP_MD_CTX*> OpenSSLCryptoProvider::AcquireMDCtx()
+{
+    {
+        LockGuard lock {mCacheMutex};
+
+        if (!mFreeMDCtxs.IsEmpty()) {
+            auto ctx = mFreeMDCtxs.Back();
+
+            mFreeMDCtxs.PopBack();
+
+            return ctx;
+        }
+    }
+
+    auto ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        return {nullptr, OPENSSL_ERROR()};
+    }
+
+    return ctx;
+}
+
+void OpenSSLCryptoProvider::ReleaseMDCtx(EVP_MD_CTX* ctx)
+{
+    EVP_MD_CTX_reset(ctx);
+
+    {
+        LockGuard lock {mCacheMutex};
+
+        if (!mFreeMDCtxs.IsFull()) {
+            mFreeMDCtxs.PushBack(ctx);
+
+            return;
+        }
     }
 
-    if (EVP_DigestInit_ex(mMDCtx, mType, nullptr) != 1) {
-        EVP_MD_CTX_free(mMDCtx);
-        EVP_MD_free(mType);
-        mMDCtx = nullptr;
-        mType  = nullptr;
+    EVP_MD_CTX_free(ctx);
+}
+
+RetWithError<EVP_CIPHER_CTX*> OpenSSLCryptoProvider::AcquireCipherCtx()
+{
+    {
+        LockGuard lock {mCacheMutex};
+
+        if (!mFreeCipherCtxs.IsEmpty()) {
+            auto ctx = mFreeCipherCtxs.Back();
+
+            mFreeCipherCtxs.PopBack();
+
+            return ctx;
+        }
+    }
+
+    auto ctx = EVP_CIPHER_CTX_new();
+    if (!ctx) {
+        return {nullptr, OPENSSL_ERROR()};
+    }
+
+    return ctx;
+}
+
+void OpenSSLCryptoProvider::ReleaseCipherCtx(EVP_CIPHER_CTX* ctx)
+{
+    EVP_CIPHER_CTX_reset(ctx);
+
+    {
+        LockGuard lock {mCacheMutex};
+
+        if (!mFreeCipherCtxs.IsFull()) {
+            mFreeCipherCtxs.PushBack(ctx);
+
+            return;
+        }
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+}
+
+OpenSSLCryptoProvider::OpenSSLHash::OpenSSLHash(OpenSSLCryptoProvider& provider)
+    : mProvider(provider)
+{
+}
+
+Error OpenSSLCryptoProvider::OpenSSLHash::Init(EVP_MD* type)
+{
+    auto [ctx, err] = mProvider.AcquireMDCtx();
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    if (EVP_DigestInit_ex(ctx, type, nullptr) != 1) {
+        mProvider.ReleaseMDCtx(ctx);
 
         return OPENSSL_ERROR();
     }
 
+    mMDCtx = ctx;
+    mType  = type;
+
     return ErrorEnum::eNone;
 }
 
@@ -2424,11 +2573,9 @@ Error OpenSSLCryptoProvider::OpenSSLHash::Finalize(Array<uint8_t>& hash)
         return OPENSSL_ERROR();
     }
 
-    EVP_MD_free(mType);
-    mType = nullptr;
-
-    EVP_MD_CTX_free(mMDCtx);
+    mProvider.ReleaseMDCtx(mMDCtx);
     mMDCtx = nullptr;
+    mType  = nullptr;
 
     err = hash.Resize(size);
     if (!err.IsNone()) {
@@ -2440,56 +2587,40 @@ Error OpenSSLCryptoProvider::OpenSSLHash::Finalize(Array<uint8_t>& hash)
 
 OpenSSLCryptoProvider::OpenSSLHash::~OpenSSLHash()
 {
-    if (mType) {
-        EVP_MD_free(mType);
-    }
-
     if (mMDCtx) {
-        EVP_MD_CTX_free(mMDCtx);
+        mProvider.ReleaseMDCtx(mMDCtx);
     }
 }
 
-Error OpenSSLCryptoProvider::OpenSSLAESCipher::Init(
-    OSSL_LIB_CTX* libCtx, const Array<uint8_t>& key, const Array<uint8_t>& iv, bool encrypt)
+OpenSSLCryptoProvider::OpenSSLAESCipher::OpenSSLAESCipher(OpenSSLCryptoProvider& provider)
+    : mProvider(provider)
+{
+}
+
+Error OpenSSLCryptoProvider::OpenSSLAESCipher::Init(const Array<uint8_t>& key, const Array<uint8_t>& iv, bool encrypt)
 {
     if (iv.Size() != 16) {
         return AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument);
     }
 
-    auto cipherType = DeferRelease<EVP_CIPHER>(nullptr, EVP_CIPHER_free);
-    switch (key.Size()) {
-    case 16:
-        cipherType.Reset(EVP_CIPHER_fetch(libCtx, "AES-128-CBC", nullptr));
-        break;
-
-    case 24:
-        cipherType.Reset(EVP_CIPHER_fetch(libCtx, "AES-192-CBC", nullptr));
-        break;
-
-    case 32:
-        cipherType.Reset(EVP_CIPHER_fetch(libCtx, "AES-256-CBC", nullptr));
-        break;
-
-    default:
-        return AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument);
+    auto [cipherType, err] = mProvider.GetAESCBCType(key.Size());
+    if (!err.IsNone()) {
+        return err;
     }
 
-    if (!cipherType) {
-        return OPENSSL_ERROR();
+    auto [cipherCtx, ctxErr] = mProvider.AcquireCipherCtx();
+    if (!ctxErr.IsNone()) {
+        return ctxErr;
     }
 
-    auto cipherCtx = DeferRelease<EVP_CIPHER_CTX>(EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free);
-    if (!cipherCtx) {
-        return OPENSSL_ERROR();
-    }
+    if (EVP_CipherInit_ex(cipherCtx, cipherType, nullptr, key.Get(), iv.Get(), encrypt ? 1 : 0) != 1) {
+        mProvider.ReleaseCipherCtx(cipherCtx);
 
-    if (EVP_CipherInit_ex(cipherCtx.Get(), cipherType.Get(), nullptr, key.Get(), iv.Get(), encrypt ? 1 : 0) != 1) {
         return OPENSSL_ERROR();
     }
 
-    mCipherType = cipherType.Release();
-    mCipherCtx  = cipherCtx.Release();
-    mEncrypt    = encrypt;
+    mCipherCtx = cipherCtx;
+    mEncrypt   = encrypt;
 
     return ErrorEnum::eNone;
 }
@@ -2540,7 +2671,7 @@ Error OpenSSLCryptoProvider::OpenSSLAESCipher::DecryptBlock(const Array<uint8_t>
 
 Error OpenSSLCryptoProvider::OpenSSLAESCipher::Finalize(Array<uint8_t>& output)
 {
-    if (!mCipherCtx || !mCipherType) {
+    if (!mCipherCtx) {
         return AOS_ERROR_WRAP(ErrorEnum::eWrongState);
     }
 
@@ -2564,26 +2695,18 @@ Error OpenSSLCryptoProvider::OpenSSLAESCipher::Finalize(Array<uint8_t>& output)
         output.Resize(outLen);
     }
 
-    EVP_CIPHER_CTX_free(mCipherCtx);
+    mProvider.ReleaseCipherCtx(mCipherCtx);
     mCipherCtx = nullptr;
 
-    EVP_CIPHER_free(mCipherType);
-    mCipherType = nullptr;
-
     return ErrorEnum::eNone;
 }
 
 OpenSSLCryptoProvider::OpenSSLAESCipher::~OpenSSLAESCipher()
 {
     if (mCipherCtx) {
-        EVP_CIPHER_CTX_free(mCipherCtx);
+        mProvider.ReleaseCipherCtx(mCipherCtx);
         mCipherCtx = nullptr;
     }
-
-    if (mCipherType) {
-        EVP_CIPHER_free(mCipherType);
-        mCipherType = nullptr;
-    }
 }
 
 Error OpenSSLCryptoProvider::OpenSSLRSAPrivKey::Init(EVP_PKEY* pkey)
@@ -8,6 +8,7 @@
 #define AOS_CORE_COMMON_CRYPTO_OPENSSL_CRYPTOPROVIDER_HPP_
 
 #include <core/common/config.hpp>
+#include <core/common/tools/thread.hpp>
 
 #include "../itf/crypto.hpp"
 #include "opensslprovider.hpp"
@@ -354,29 +355,31 @@ public:
 private:
     class OpenSSLHash : public crypto::HashItf, private NonCopyable {
     public:
-        Error Init(struct ossl_lib_ctx_st* libCtx, const char* mdtype);
+        explicit OpenSSLHash(OpenSSLCryptoProvider& provider);
+        Error Init(struct evp_md_st* type);
         Error Update(const Array<uint8_t>& data) override;
         Error Finalize(Array<uint8_t>& hash) override;
         ~OpenSSLHash();
 
     private:
-        struct evp_md_ctx_st* mMDCtx = nullptr;
-        struct evp_md_st*     mType  = nullptr;
+        OpenSSLCryptoProvider& mProvider;
+        struct evp_md_ctx_st*  mMDCtx = nullptr;
+        struct evp_md_st*      mType  = nullptr;
     };
 
     class OpenSSLAESCipher : public crypto::AESCipherItf, private NonCopyable {
     public:
-        Error Init(
-            struct ossl_lib_ctx_st* libCtx, const Array<uint8_t>& key, const Array<uint8_t>& iv, bool encrypt = true);
+        explicit OpenSSLAESCipher(OpenSSLCryptoProvider& provider);
+        Error Init(const Array<uint8_t>& key, const Array<uint8_t>& iv, bool encrypt = true);
         Error EncryptBlock(const Array<uint8_t>& input, Array<uint8_t>& output) override;
         Error DecryptBlock(const Array<uint8_t>& input, Array<uint8_t>& output) override;
         Error Finalize(Array<uint8_t>& output) override;
         ~OpenSSLAESCipher();
 
     private:
-        bool                      mEncrypt    = false;
-        struct evp_cipher_ctx_st* mCipherCtx  = nullptr;
-        struct evp_cipher_st*     mCipherType = nullptr;
+        OpenSSLCryptoProvider&    mProvider;
+        bool                      mEncrypt   = false;
+        struct evp_cipher_ctx_st* mCipherCtx = nullptr;
     };
 
     class OpenSSLRSAPrivKey : public crypto::PrivateKeyItf {
@@ -398,9 +401,27 @@ private:
         + AOS_CONFIG_CRYPTO_AES_CIPHER_COUNT * sizeof(OpenSSLAESCipher)
         + AOS_CONFIG_CRYPTO_PRIV_KEYS_COUNT * sizeof(OpenSSLRSAPrivKey);
 
+    static constexpr auto cNumHashTypes   = static_cast<size_t>(HashEnum::eNone);
+    static constexpr auto cNumAESKeySizes = 3;
+
+    RetWithError<struct evp_md_st*>         GetMDType(Hash algorithm);
+    RetWithError<struct evp_cipher_st*>     GetAESCBCType(size_t keySize);
+    RetWithError<struct evp_md_ctx_st*>     AcquireMDCtx();
+    void                                    ReleaseMDCtx(struct evp_md_ctx_st* ctx);
+    RetWithError<struct evp_cipher_ctx_st*> AcquireCipherCtx();
+    void                                    ReleaseCipherCtx(struct evp_cipher_ctx_st* ctx);
+
     ossl_lib_ctx_st*         mLibCtx = nullptr;
     openssl::OpenSSLProvider mOpenSSLProvider;
 
+    // Fetched algorithms and released contexts are kept for the provider lifetime: algorithm fetch takes global
+    // OpenSSL property lock and context creation allocates memory on each hash or cipher operation.
+    Mutex                                                                      mCacheMutex;
+    struct evp_md_st*                                                          mMDTypes[cNumHashTypes]       = {};
+    struct evp_cipher_st*                                                      mAESCBCTypes[cNumAESKeySizes] = {};
+    StaticArray<struct evp_md_ctx_st*, AOS_CONFIG_CRYPTO_HASHER_COUNT>         mFreeMDCtxs;
+    StaticArray<struct evp_cipher_ctx_st*, AOS_CONFIG_CRYPTO_AES_CIPHER_COUNT> mFreeCipherCtxs;
+
     StaticAllocator<cAllocatorSize> mAllocator;
 };
 
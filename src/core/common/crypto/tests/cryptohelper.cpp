@@ -6,16 +6,22 @@
 
 #include <gmock/gmock.h>
 
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include <core/common/crypto/certloader.hpp>
 #include <core/common/crypto/cryptohelper.hpp>
+#include <core/common/crypto/cryptoprovider.hpp>
 #include <core/common/tests/crypto/providers/cryptofactory.hpp>
 #include <core/common/tests/crypto/softhsmenv.hpp>
 #include <core/common/tests/utils/log.hpp>
+#include <core/common/tests/utils/utils.hpp>
 #include <core/common/tools/fs.hpp>
 #include <core/common/tools/utils.hpp>
 
+#include "stubs/certloader.hpp"
 #include "stubs/certprovider.hpp"
 
 using namespace testing;
@@ -114,6 +120,27 @@ SignInfo CreateSigns(const char* chainName, const char* algName)
     return signs;
 }
 
+/**
+ * Crypto provider counting certificate chain verifications.
+ */
+class VerifyCountingCryptoProvider : public DefaultCryptoProvider {
+public:
+    using DefaultCryptoProvider::Verify;
+
+    Error Verify(const Array<x509::Certificate>& rootCerts, const Array<x509::Certificate>& intermCerts,
+        const x509::VerifyOptions& options, const x509::Certificate& cert) override
+    {
+        mNumChainVerifies++;
+
+        return DefaultCryptoProvider::Verify(rootCerts, intermCerts, options, cert);
+    }
+
+    size_t GetNumChainVerifies() const { return mNumChainVerifies; }
+
+private:
+    std::atomic_size_t mNumChainVerifies {};
+};
+
 /***********************************************************************************************************************
  * Suite
  **********************************************************************************************************************/
@@ -153,6 +180,36 @@ protected:
     test::SoftHSMEnv mSoftHSMEnv;
 };
 
+class CryptoHelperConcurrencyTest : public Test {
+public:
+    void SetUp() override
+    {
+        tests::utils::InitLog();
+
+        ASSERT_TRUE(mCryptoFactory.Init().IsNone());
+
+        mCertLoader.Init(mCryptoFactory.GetCryptoProvider());
+
+        ASSERT_TRUE(mCryptoHelper
+                        .Init(mCertProvider, mCryptoFactory.GetCryptoProvider(), mCertLoader,
+                            cDefaultServiceDiscoveryURL, cCACert)
+                        .IsNone());
+    }
+
+protected:
+    static constexpr auto cDefaultServiceDiscoveryURL = "http://service-discovery-url.html";
+    static constexpr auto cCACert                     = CRYPTOHELPER_CERTS_DIR "/rootCA.pem";
+
+    DefaultCryptoFactory mCryptoFactory;
+    CertProviderStub     mCertProvider;
+    CertLoaderStub       mCertLoader;
+    CryptoHelper         mCryptoHelper;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
 TEST_F(CryptoHelperTest, ServiceDiscoveryURLs)
 {
     struct TestData {
@@ -248,6 +305,53 @@ TEST_F(CryptoHelperTest, ValidateSigns)
     }
 }
 
+TEST_F(CryptoHelperTest, ValidateSignsUsesVerifiedChainWithinValidity)
+{
+    constexpr auto cDecryptedFile = CRYPTOHELPER_CERTS_DIR "/hello-world.txt";
+
+    StaticArray<CertificateInfo, 10> certs;
+
+    ASSERT_TRUE(certs.PushBack(CreateCert(*mCryptoProvider, "online")).IsNone());
+    ASSERT_TRUE(certs.PushBack(CreateCert(*mCryptoProvider, "intermediateCA")).IsNone());
+    ASSERT_TRUE(certs.PushBack(CreateCert(*mCryptoProvider, "secondaryCA")).IsNone());
+
+    StaticArray<CertificateChainInfo, 1> chains;
+
+    ASSERT_TRUE(chains.PushBack(CreateCertChain("online", {"online", "intermediateCA", "secondaryCA"})).IsNone());
+
+    auto signs = CreateSigns("online", "RSA/SHA256/PKCS1v1_5");
+
+    auto cryptoProvider = std::make_unique<VerifyCountingCryptoProvider>();
+    auto cryptoHelper   = std::make_unique<CryptoHelper>();
+
+    ASSERT_TRUE(cryptoProvider->Init().IsNone());
+    ASSERT_TRUE(
+        cryptoHelper->Init(mCertProvider, *cryptoProvider, mCertLoader, cDefaultServiceDiscoveryURL, cCACert).IsNone());
+
+    ASSERT_TRUE(cryptoHelper->ValidateSigns(cDecryptedFile, signs, chains, certs).IsNone());
+    EXPECT_EQ(cryptoProvider->GetNumChainVerifies(), 1);
+
+    // Chain verified within certificates validity is not verified again.
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(cryptoHelper->ValidateSigns(cDecryptedFile, signs, chains, certs).IsNone());
+    }
+
+    EXPECT_EQ(cryptoProvider->GetNumChainVerifies(), 1);
+
+    // Trusted timestamp outside of certificates validity must not be accepted from cache.
+    signs.mTrustedTimestamp = Time::Now().Add(Years(100));
+
+    EXPECT_FALSE(cryptoHelper->ValidateSigns(cDecryptedFile, signs, chains, certs).IsNone());
+    EXPECT_EQ(cryptoProvider->GetNumChainVerifies(), 2);
+
+    signs.mTrustedTimestamp = Time::Now();
+
+    EXPECT_TRUE(cryptoHelper->ValidateSigns(cDecryptedFile, signs, chains, certs).IsNone());
+    EXPECT_EQ(cryptoProvider->GetNumChainVerifies(), 2);
+
+    ASSERT_TRUE(cryptoHelper->Deinit().IsNone());
+}
+
 TEST_F(CryptoHelperTest, DecryptMetadata)
 {
     StaticArray<uint8_t, cCloudMetadataSize> output;
@@ -263,4 +367,110 @@ TEST_F(CryptoHelperTest, DecryptMetadata)
     EXPECT_EQ(std::vector<uint8_t>(output.begin(), output.end()), expected);
 }
 
+TEST_F(CryptoHelperConcurrencyTest, ServiceDiscoveryURLsCached)
+{
+    struct TestData {
+        std::string mCert;
+        std::string mServiceDiscoveryURL;
+    };
+
+    TestData testData[] = {{"onlineTest1", "https://Test1:9000"}, {"online", "https://www.mytest.com"},
+        {"onlineTest2", cDefaultServiceDiscoveryURL}};
+
+    for (size_t i = 0; i < ArraySize(testData); i++) {
+        mCertProvider.AddCert("online", testData[i].mCert);
+
+        for (int j = 0; j < 3; j++) {
+            StaticArray<StaticString<cURLLen>, cMaxNumURLs> discoveryURLs;
+
+            ASSERT_TRUE(mCryptoHelper.GetServiceDiscoveryURLs(discoveryURLs).IsNone());
+            ASSERT_EQ(discoveryURLs.Size(), 1);
+            EXPECT_EQ(testData[i].mServiceDiscoveryURL, discoveryURLs[0].CStr());
+        }
+
+        // Online certificate is parsed only once after each change.
+        EXPECT_EQ(mCertLoader.GetNumCertsChainLoads(), i + 1);
+    }
+}
+
+TEST_F(CryptoHelperConcurrencyTest, DeinitUnsubscribesListenerOnce)
+{
+    CertProviderStub certProvider;
+    CryptoHelper     cryptoHelper;
+
+    ASSERT_TRUE(
+        cryptoHelper
+            .Init(certProvider, mCryptoFactory.GetCryptoProvider(), mCertLoader, cDefaultServiceDiscoveryURL, cCACert)
+            .IsNone());
+    EXPECT_EQ(certProvider.GetNumListeners(), 1);
+
+    ASSERT_TRUE(cryptoHelper.Deinit().IsNone());
+    EXPECT_EQ(certProvider.GetNumListeners(), 0);
+
+    // Second deinit doesn't unsubscribe again.
+    EXPECT_TRUE(cryptoHelper.Deinit().IsNone());
+}
+
+TEST_F(CryptoHelperConcurrencyTest, ParallelOperations)
+{
+    mCertProvider.SetParallelCalls(cMaxNumConcurrentItems);
+
+    std::vector<std::thread> threads;
+    std::vector<Error>       errors(cMaxNumConcurrentItems);
+    std::vector<std::string> urls(cMaxNumConcurrentItems);
+
+    for (size_t i = 0; i < cMaxNumConcurrentItems; i++) {
+        threads.emplace_back([&, i]() {
+            StaticArray<StaticString<cURLLen>, cMaxNumURLs> discoveryURLs;
+
+            errors[i] = mCryptoHelper.GetServiceDiscoveryURLs(discoveryURLs);
+
+            if (!discoveryURLs.IsEmpty()) {
+                urls[i] = discoveryURLs[0].CStr();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < cMaxNumConcurrentItems; i++) {
+        EXPECT_TRUE(errors[i].IsNone()) << tests::utils::ErrorToStr(errors[i]);
+        EXPECT_EQ(urls[i], cDefaultServiceDiscoveryURL);
+    }
+
+    EXPECT_EQ(mCertProvider.GetMaxParallelCalls(), cMaxNumConcurrentItems);
+}
+
+TEST_F(CryptoHelperConcurrencyTest, DecryptSaturated)
+{
+    constexpr auto cNumOperations = 2 * cMaxNumConcurrentItems;
+
+    auto decryptInfo = CreateDecryptionInfo("AES256/CBC/PKCS7PADDING", {1, 2, 3, 4, 5}, ReadFileFromAESDir("aes.key"));
+    auto expected    = ReadFileFromAESDir("hello-world.txt");
+
+    std::vector<std::thread> threads;
+    std::vector<Error>       errors(cNumOperations);
+
+    for (size_t i = 0; i < cNumOperations; i++) {
+        threads.emplace_back([&, i]() {
+            auto decryptedFile = "decrypted" + std::to_string(i) + ".raw";
+
+            errors[i] = mCryptoHelper.Decrypt(
+                CRYPTOHELPER_AES_DIR "/hello-world.txt.enc", (CRYPTOHELPER_AES_DIR "/" + decryptedFile).c_str(),
+                decryptInfo);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < cNumOperations; i++) {
+        ASSERT_TRUE(errors[i].IsNone()) << tests::utils::ErrorToStr(errors[i]);
+        EXPECT_EQ(ReadFileFromAESDir(("decrypted" + std::to_string(i) + ".raw").c_str()), expected);
+    }
+}
+
 } // namespace aos::crypto
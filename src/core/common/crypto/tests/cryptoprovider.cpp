@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <vector>
+
 #include <gmock/gmock.h>
 
 #include <core/common/tests/crypto/providers/cryptofactory.hpp>
@@ -641,6 +643,46 @@ TEST_P(CryptoProviderTest, SHA256ByChunks)
     LOG_DBG() << "SHA256: " << hashStr;
 }
 
+TEST_P(CryptoProviderTest, HashReuse)
+{
+    const char* data = "abc";
+
+    struct {
+        Hash        mAlgorithm;
+        const char* mExpectedHash;
+    } testCases[] = {
+        {HashEnum::eSHA256, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+        {HashEnum::eSHA3_256, "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532"},
+    };
+
+    // Abandoned hash should not affect following hashes.
+    {
+        auto [hasherPtr, err] = mHashProvider->CreateHash(HashEnum::eSHA256);
+        ASSERT_TRUE(err.IsNone());
+
+        ASSERT_TRUE(hasherPtr->Update(Array<uint8_t>(reinterpret_cast<const uint8_t*>("xyz"), 3)).IsNone());
+    }
+
+    for (size_t i = 0; i < 2 * AOS_CONFIG_CRYPTO_HASHER_COUNT; i++) {
+        const auto& testCase = testCases[i % ArraySize(testCases)];
+
+        auto [hasherPtr, err] = mHashProvider->CreateHash(testCase.mAlgorithm);
+        ASSERT_TRUE(err.IsNone());
+
+        ASSERT_TRUE(hasherPtr->Update(Array<uint8_t>(reinterpret_cast<const uint8_t*>(data), strlen(data))).IsNone());
+
+        StaticArray<uint8_t, cSHA256Size> result;
+
+        ASSERT_TRUE(hasherPtr->Finalize(result).IsNone());
+        EXPECT_FALSE(hasherPtr->Finalize(result).IsNone());
+
+        StaticString<cSHA256Size * 2> hashStr;
+        ASSERT_TRUE(hashStr.ByteArrayToHex(result).IsNone());
+
+        EXPECT_EQ(hashStr, String(testCase.mExpectedHash));
+    }
+}
+
 TEST_P(CryptoProviderTest, RandInt)
 {
     constexpr uint64_t cMaxValue           = 100;
@@ -823,6 +865,105 @@ TEST_P(CryptoProviderTest, AES_CBC_Decryption)
     EXPECT_EQ(plaintext, expected);
 }
 
+TEST_P(CryptoProviderTest, AES_CBC_Reuse)
+{
+    const uint8_t ivRaw[16]
+        = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+    const char* plainRaw = "TWO BLOCK AES RAW MESSAGE";
+
+    const Array<uint8_t> iv(ivRaw, sizeof(ivRaw));
+    const Array<uint8_t> plain(reinterpret_cast<const uint8_t*>(plainRaw), strlen(plainRaw));
+
+    auto outBuf   = std::make_unique<StaticArray<uint8_t, cFileChunkSize>>();
+    auto finalBuf = std::make_unique<StaticArray<uint8_t, cFileChunkSize>>();
+
+    for (size_t i = 0; i < 2 * AOS_CONFIG_CRYPTO_AES_CIPHER_COUNT; i++) {
+        StaticArray<uint8_t, 32> key;
+
+        // Iterate over 128, 192 and 256 bit keys.
+        key.Resize(16 + 8 * (i % 3));
+
+        for (size_t j = 0; j < key.Size(); j++) {
+            key[j] = static_cast<uint8_t>(i + j);
+        }
+
+        // Abandoned cipher should not affect following ciphers.
+        {
+            auto [cipherPtr, err] = mCryptoProvider->CreateAESEncoder("CBC", key, iv);
+            ASSERT_TRUE(err.IsNone());
+
+            ASSERT_TRUE(cipherPtr->EncryptBlock(plain, *outBuf).IsNone());
+        }
+
+        StaticArray<uint8_t, 64> ciphertext;
+
+        {
+            auto [cipherPtr, err] = mCryptoProvider->CreateAESEncoder("CBC", key, iv);
+            ASSERT_TRUE(err.IsNone());
+
+            ASSERT_TRUE(cipherPtr->EncryptBlock(plain, *outBuf).IsNone());
+            ciphertext.Append(*outBuf);
+            ASSERT_TRUE(cipherPtr->Finalize(*finalBuf).IsNone());
+            ciphertext.Append(*finalBuf);
+        }
+
+        StaticArray<uint8_t, 64> plaintext;
+
+        {
+            auto [cipherPtr, err] = mCryptoProvider->CreateAESDecoder("CBC", key, iv);
+            ASSERT_TRUE(err.IsNone());
+
+            ASSERT_TRUE(cipherPtr->DecryptBlock(ciphertext, *outBuf).IsNone());
+            plaintext.Append(*outBuf);
+            ASSERT_TRUE(cipherPtr->Finalize(*finalBuf).IsNone());
+            plaintext.Append(*finalBuf);
+        }
+
+        EXPECT_EQ(plaintext, plain);
+    }
+
+    // NIST SP 800-38A CBC-AES vectors: second block encrypted with first ciphertext block as IV. Reused contexts
+    // previously set up with other keys and IV should produce exact ciphertext.
+    struct KnownAnswer {
+        std::vector<uint8_t> mKey;
+        std::vector<uint8_t> mIV;
+        std::vector<uint8_t> mCiphertext;
+    };
+
+    const std::vector<uint8_t> cKnownPlaintext
+        = {0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51};
+
+    const std::vector<KnownAnswer> cKnownAnswers = {
+        {{0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c},
+            {0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d},
+            {0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2}},
+        {{0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52, 0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5, 0x62, 0xf8,
+             0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b},
+            {0x4f, 0x02, 0x1d, 0xb2, 0x43, 0xbc, 0x63, 0x3d, 0x71, 0x78, 0x18, 0x3a, 0x9f, 0xa0, 0x71, 0xe8},
+            {0xb4, 0xd9, 0xad, 0xa9, 0xad, 0x7d, 0xed, 0xf4, 0xe5, 0xe7, 0x38, 0x76, 0x3f, 0x69, 0x14, 0x5a}},
+        {{0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81, 0x1f, 0x35,
+             0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4},
+            {0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba, 0x77, 0x9e, 0xab, 0xfb, 0x5f, 0x7b, 0xfb, 0xd6},
+            {0x9c, 0xfc, 0x4e, 0x96, 0x7e, 0xdb, 0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d}},
+    };
+
+    const Array<uint8_t> knownPlaintext(cKnownPlaintext.data(), cKnownPlaintext.size());
+
+    for (size_t i = 0; i < 2 * AOS_CONFIG_CRYPTO_AES_CIPHER_COUNT; i++) {
+        const auto&          knownAnswer = cKnownAnswers[i % cKnownAnswers.size()];
+        const Array<uint8_t> key(knownAnswer.mKey.data(), knownAnswer.mKey.size());
+        const Array<uint8_t> knownIV(knownAnswer.mIV.data(), knownAnswer.mIV.size());
+        const Array<uint8_t> knownCiphertext(knownAnswer.mCiphertext.data(), knownAnswer.mCiphertext.size());
+
+        auto [cipherPtr, err] = mCryptoProvider->CreateAESEncoder("CBC", key, knownIV);
+        ASSERT_TRUE(err.IsNone());
+
+        ASSERT_TRUE(cipherPtr->EncryptBlock(knownPlaintext, *outBuf).IsNone());
+        EXPECT_EQ(*outBuf, knownCiphertext);
+        ASSERT_TRUE(cipherPtr->Finalize(*finalBuf).IsNone());
+    }
+}
+
 TEST_P(CryptoProviderTest, VerifyRSASignature)
 {
     StaticArray<x509::Certificate, 1> certs;
@@ -4,11 +4,16 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <core/common/crypto/cryptoutils.hpp>
+#include <core/common/tools/fs.hpp>
 
 #include <core/common/tests/crypto/providers/cryptofactory.hpp>
 #include <core/common/tests/utils/log.hpp>
@@ -16,6 +21,100 @@
 
 namespace aos::crypto {
 
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+constexpr auto cWaitTimeout = std::chrono::seconds(5);
+
+/***********************************************************************************************************************
+ * Types
+ **********************************************************************************************************************/
+
+// Hasher which blocks first update of each hash until expected number of hashes are updated simultaneously.
+class BarrierHasher : public HasherItf {
+public:
+    BarrierHasher(HasherItf& hasher, size_t numParallel)
+        : mHasher(hasher)
+        , mNumParallel(numParallel)
+    {
+    }
+
+    RetWithError<UniquePtr<HashItf>> CreateHash(Hash algorithm) override
+    {
+        auto [hash, err] = mHasher.CreateHash(algorithm);
+        if (!err.IsNone()) {
+            return {nullptr, err};
+        }
+
+        return {MakeUnique<BarrierHash>(&mAllocator, *this, hash)};
+    }
+
+    size_t GetMaxParallel()
+    {
+        std::lock_guard lock {mMutex};
+
+        return mMaxParallel;
+    }
+
+private:
+    class BarrierHash : public HashItf {
+    public:
+        BarrierHash(BarrierHasher& hasher, UniquePtr<HashItf>& hash)
+            : mHasher(hasher)
+            , mHash(Move(hash))
+        {
+        }
+
+        Error Update(const Array<uint8_t>& data) override
+        {
+            if (!mEntered) {
+                mEntered = true;
+
+                if (auto err = mHasher.Wait(); !err.IsNone()) {
+                    return err;
+                }
+            }
+
+            return mHash->Update(data);
+        }
+
+        Error Finalize(Array<uint8_t>& hash) override { return mHash->Finalize(hash); }
+
+    private:
+        BarrierHasher&     mHasher;
+        UniquePtr<HashItf> mHash;
+        bool               mEntered = false;
+    };
+
+    Error Wait()
+    {
+        std::unique_lock lock {mMutex};
+
+        mMaxParallel = std::max(mMaxParallel, ++mNumEntered);
+        mCondVar.notify_all();
+
+        if (!mCondVar.wait_for(lock, cWaitTimeout, [this] { return mNumEntered >= mNumParallel; })) {
+            return ErrorEnum::eTimeout;
+        }
+
+        return ErrorEnum::eNone;
+    }
+
+    HasherItf&              mHasher;
+    size_t                  mNumParallel;
+    size_t                  mNumEntered  = 0;
+    size_t                  mMaxParallel = 0;
+    std::mutex              mMutex;
+    std::condition_variable mCondVar;
+
+    StaticAllocator<sizeof(BarrierHash) * cFileHashMaxConcurrent, cFileHashMaxConcurrent> mAllocator;
+};
+
+} // namespace
+
 /***********************************************************************************************************************
  * Suite
  **********************************************************************************************************************/
@@ -72,4 +171,40 @@ TEST_F(CryptoutilsTest, CalculateFileHashNoFile)
     ASSERT_FALSE(err.IsNone());
 }
 
+TEST_F(CryptoutilsTest, CalculateFileHashConcurrently)
+{
+    std::vector<std::string> files;
+
+    for (size_t i = 0; i < cFileHashMaxConcurrent; i++) {
+        files.push_back("test" + std::to_string(i) + ".txt");
+
+        std::ofstream f(files.back());
+        ASSERT_TRUE(f.is_open());
+
+        f << std::string(10000, 'a');
+    }
+
+    BarrierHasher            hasher(mCryptoFactory.GetHashProvider(), cFileHashMaxConcurrent);
+    std::vector<Error>       errors(files.size());
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < files.size(); i++) {
+        threads.emplace_back([&, i]() {
+            StaticArray<uint8_t, cSHA256Size> hash;
+
+            errors[i] = CalculateFileHash(String(files[i].c_str()), crypto::HashEnum::eSHA256, hasher, hash);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& err : errors) {
+        EXPECT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+    }
+
+    EXPECT_EQ(hasher.GetMaxParallel(), cFileHashMaxConcurrent);
+}
+
 } // namespace aos::crypto
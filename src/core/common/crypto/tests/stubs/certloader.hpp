@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_COMMON_CRYPTO_TESTS_STUBS_CERTLOADER_HPP_
+#define AOS_CORE_COMMON_CRYPTO_TESTS_STUBS_CERTLOADER_HPP_
+
+#include <atomic>
+#include <memory>
+
+#include <core/common/consts.hpp>
+#include <core/common/crypto/itf/certloader.hpp>
+#include <core/common/tools/fs.hpp>
+
+namespace aos::crypto {
+
+/**
+ * Stub implementation of CertLoaderItf which loads certificates from files only.
+ */
+class CertLoaderStub : public CertLoaderItf {
+public:
+    void Init(x509::ProviderItf& provider) { mProvider = &provider; }
+
+    RetWithError<SharedPtr<x509::CertificateChain>> LoadCertsChainByURL(const String& url) override
+    {
+        mNumCertsChainLoads++;
+
+        StaticString<cFilePathLen> path;
+
+        if (auto err = ParseFileURL(url, path); !err.IsNone()) {
+            return {nullptr, err};
+        }
+
+        auto pem = std::make_unique<StaticString<cCertPEMLen * cCertChainSize>>();
+
+        if (auto err = fs::ReadFileToString(path, *pem); !err.IsNone()) {
+            return {nullptr, err};
+        }
+
+        auto chain = MakeShared<x509::CertificateChain>(&mAllocator);
+
+        if (auto err = mProvider->PEMToX509Certs(*pem, *chain); !err.IsNone()) {
+            return {nullptr, err};
+        }
+
+        return chain;
+    }
+
+    RetWithError<SharedPtr<PrivateKeyItf>> LoadPrivKeyByURL(const String& url) override
+    {
+        (void)url;
+
+        return {nullptr, ErrorEnum::eNotSupported};
+    }
+
+    size_t GetNumCertsChainLoads() const { return mNumCertsChainLoads; }
+
+private:
+    x509::ProviderItf*  mProvider {};
+    std::atomic<size_t> mNumCertsChainLoads {};
+
+    StaticAllocator<sizeof(x509::CertificateChain) * cMaxNumConcurrentItems, cMaxNumConcurrentItems> mAllocator;
+};
+
+} // namespace aos::crypto
+
+#endif
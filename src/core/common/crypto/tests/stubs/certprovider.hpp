@@ -7,7 +7,10 @@
 #ifndef AOS_CORE_COMMON_CRYPTO_TESTS_STUBS_CERTPROVIDER_HPP_
 #define AOS_CORE_COMMON_CRYPTO_TESTS_STUBS_CERTPROVIDER_HPP_
 
+#include <chrono>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include <core/common/iamclient/itf/certprovider.hpp>
@@ -25,6 +28,10 @@ public:
         (void)issuer;
         (void)serial;
 
+        std::unique_lock lock {mMutex};
+
+        WaitParallelCalls(lock);
+
         if (mCerts.count(certType.CStr()) == 0) {
             return ErrorEnum::eNotFound;
         }
@@ -36,30 +43,104 @@ public:
 
     Error SubscribeListener(const String& certType, iamclient::CertListenerItf& certListener) override
     {
-        (void)certType;
-        (void)certListener;
+        std::lock_guard lock {mMutex};
+
+        mListeners[certType.CStr()] = &certListener;
 
         return ErrorEnum::eNone;
     }
 
     Error UnsubscribeListener(iamclient::CertListenerItf& certListener) override
     {
-        (void)certListener;
+        std::lock_guard lock {mMutex};
+
+        for (auto it = mListeners.begin(); it != mListeners.end();) {
+            if (it->second == &certListener) {
+                it = mListeners.erase(it);
+            } else {
+                ++it;
+            }
+        }
 
         return ErrorEnum::eNone;
     }
 
     void AddCert(const std::string& certType, const std::string& certName)
     {
-        CertInfo certInfo;
+        CertInfo                    certInfo;
+        iamclient::CertListenerItf* listener = nullptr;
 
         certInfo.mCertURL = ("file://" + FullCertPath(certName)).c_str();
         certInfo.mKeyURL  = ("file://" + FullKeyPath(certName)).c_str();
 
-        mCerts[certType] = certInfo;
+        {
+            std::lock_guard lock {mMutex};
+
+            mCerts[certType] = certInfo;
+
+            if (auto it = mListeners.find(certType); it != mListeners.end()) {
+                listener = it->second;
+            }
+        }
+
+        if (listener) {
+            listener->OnCertChanged(certInfo);
+        }
+    }
+
+    /**
+     * Returns number of subscribed listeners.
+     *
+     * @return size_t.
+     */
+    size_t GetNumListeners() const
+    {
+        std::lock_guard lock {mMutex};
+
+        return mListeners.size();
+    }
+
+    /**
+     * Makes GetCert wait until specified number of calls are executed in parallel.
+     *
+     * @param numCalls number of parallel calls.
+     */
+    void SetParallelCalls(size_t numCalls)
+    {
+        std::lock_guard lock {mMutex};
+
+        mNumParallelCalls = numCalls;
+    }
+
+    /**
+     * Returns max number of GetCert calls executed in parallel.
+     *
+     * @return size_t.
+     */
+    size_t GetMaxParallelCalls() const
+    {
+        std::lock_guard lock {mMutex};
+
+        return mMaxParallelCalls;
     }
 
 private:
+    static constexpr auto cWaitTimeout = std::chrono::seconds(5);
+
+    void WaitParallelCalls(std::unique_lock<std::mutex>& lock) const
+    {
+        if (mNumParallelCalls == 0) {
+            return;
+        }
+
+        mMaxParallelCalls = std::max(mMaxParallelCalls, ++mCurrentCalls);
+        mCondVar.notify_all();
+
+        mCondVar.wait_for(lock, cWaitTimeout, [this] { return mMaxParallelCalls >= mNumParallelCalls; });
+
+        mCurrentCalls--;
+    }
+
     static std::string FullCertPath(const std::string& name)
     {
         return std::string(CRYPTOHELPER_CERTS_DIR) + "/" + name + ".pem";
@@ -70,7 +151,13 @@ private:
         return std::string(CRYPTOHELPER_CERTS_DIR) + "/" + name + ".key";
     }
 
-    std::map<std::string, CertInfo> mCerts;
+    std::map<std::string, CertInfo>                     mCerts;
+    std::map<std::string, iamclient::CertListenerItf*> mListeners;
+    mutable std::mutex                                  mMutex;
+    mutable std::condition_variable                     mCondVar;
+    size_t                                              mNumParallelCalls = 0;
+    mutable size_t                                      mCurrentCalls     = 0;
+    mutable size_t                                      mMaxParallelCalls = 0;
 };
 
 } // namespace aos::crypto
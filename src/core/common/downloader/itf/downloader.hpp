@@ -8,10 +8,57 @@
 #ifndef AOS_CORE_COMMON_DOWNLOADER_ITF_DOWNLOADER_HPP_
 #define AOS_CORE_COMMON_DOWNLOADER_ITF_DOWNLOADER_HPP_
 
+#include <core/common/consts.hpp>
+#include <core/common/tools/array.hpp>
+#include <core/common/tools/fs.hpp>
 #include <core/common/tools/string.hpp>
 
 namespace aos::downloader {
 
+/**
+ * Byte range.
+ */
+struct ByteRange {
+    size_t mOffset {};
+    size_t mSize {};
+
+    /**
+     * Compares byte ranges.
+     *
+     * @param rhs byte range to compare with.
+     * @return bool.
+     */
+    bool operator==(const ByteRange& rhs) const { return mOffset == rhs.mOffset && mSize == rhs.mSize; }
+
+    /**
+     * Compares byte ranges.
+     *
+     * @param rhs byte range to compare with.
+     * @return bool.
+     */
+    bool operator!=(const ByteRange& rhs) const { return !operator==(rhs); }
+};
+
+/**
+ * Download progress listener interface.
+ */
+class ProgressListenerItf {
+public:
+    /**
+     * Destroys the progress listener interface.
+     */
+    virtual ~ProgressListenerItf() = default;
+
+    /**
+     * Notifies about download progress.
+     *
+     * @param digest image digest.
+     * @param downloaded downloaded size.
+     * @param total total size.
+     */
+    virtual void OnProgress(const String& digest, size_t downloaded, size_t total) = 0;
+};
+
 /**
  * Downloader interface.
  */
@@ -32,6 +79,59 @@ public:
      */
     virtual Error Download(const String& digest, const String& url, const String& path) = 0;
 
+    /**
+     * Downloads byte range of file and appends it to the file at path.
+     *
+     * @param digest image digest.
+     * @param url URL.
+     * @param path path to file.
+     * @param range byte range.
+     * @return Error.
+     */
+    virtual Error DownloadRange(const String& digest, const String& url, const String& path, const ByteRange& range)
+    {
+        (void)digest;
+        (void)url;
+        (void)path;
+        (void)range;
+
+        return ErrorEnum::eNotSupported;
+    }
+
+    /**
+     * Downloads file from one of mirrors.
+     *
+     * Default implementation tries mirrors one by one until download succeeds.
+     *
+     * @param digest image digest.
+     * @param urls mirror URLs.
+     * @param path path to file.
+     * @param size file size, 0 if unknown.
+     * @param listener progress listener.
+     * @return Error.
+     */
+    virtual Error DownloadFromMirrors(const String& digest, const Array<StaticString<cURLLen>>& urls,
+        const String& path, size_t size, ProgressListenerItf* listener = nullptr)
+    {
+        Error err = ErrorEnum::eNotFound;
+
+        for (const auto& url : urls) {
+            if (err = Download(digest, url, path); err.IsNone()) {
+                if (listener) {
+                    listener->OnProgress(digest, size, size);
+                }
+
+                return ErrorEnum::eNone;
+            }
+
+            if (err == ErrorEnum::eCanceled) {
+                return err;
+            }
+        }
+
+        return err;
+    }
+
     /**
      * Cancels ongoing download.
      *
@@ -40,6 +140,24 @@ public:
      * @return Error.
      */
     virtual Error Cancel(const String& digest) = 0;
+
+    /**
+     * Returns size of data downloaded to the file at path so far.
+     *
+     * Default implementation returns size of the file. Downloaders keeping partial data in other places override it.
+     *
+     * @param path path to file.
+     * @return RetWithError<size_t>.
+     */
+    virtual RetWithError<size_t> GetDownloadedSize(const String& path)
+    {
+        auto [exist, err] = fs::FileExist(path);
+        if (!err.IsNone() || !exist) {
+            return {0, err};
+        }
+
+        return fs::CalculateSize(path);
+    }
 };
 
 } // namespace aos::downloader
@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <core/common/tools/fs.hpp>
+#include <core/common/tools/logger.hpp>
+
+#include "segmenteddownloader.hpp"
+
+namespace aos::downloader {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+Error SegmentedDownloader::Init(DownloaderItf& downloader, size_t segmentSize)
+{
+    LOG_DBG() << "Init segmented downloader" << Log::Field("segmentSize", segmentSize);
+
+    if (segmentSize == 0) {
+        return AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument);
+    }
+
+    mDownloader  = &downloader;
+    mSegmentSize = segmentSize;
+
+    return ErrorEnum::eNone;
+}
+
+Error SegmentedDownloader::Start()
+{
+    LOG_DBG() << "Start segmented downloader";
+
+    if (auto err = mThreadPool.Run(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    LockGuard lock {mMutex};
+
+    mIsRunning = true;
+
+    return ErrorEnum::eNone;
+}
+
+Error SegmentedDownloader::Stop()
+{
+    LOG_DBG() << "Stop segmented downloader";
+
+    auto err = mThreadPool.Shutdown();
+
+    {
+        LockGuard lock {mMutex};
+
+        mIsRunning = false;
+        mCondVar.NotifyAll();
+    }
+
+    if (!err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error SegmentedDownloader::Download(const String& digest, const String& url, const String& path)
+{
+    return mDownloader->Download(digest, url, path);
+}
+
+Error SegmentedDownloader::DownloadRange(
+    const String& digest, const String& url, const String& path, const ByteRange& range)
+{
+    return mDownloader->DownloadRange(digest, url, path, range);
+}
+
+Error SegmentedDownloader::DownloadFromMirrors(const String& digest, const Array<StaticString<cURLLen>>& urls,
+    const String& path, size_t size, ProgressListenerItf* listener)
+{
+    LOG_DBG() << "Download from mirrors" << Log::Field("digest", digest) << Log::Field("numURLs", urls.Size())
+              << Log::Field("size", size);
+
+    if (urls.IsEmpty()) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eNotFound, "no download URLs"));
+    }
+
+    auto [download, err] = AcquireDownload(path);
+    if (!err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    auto releaseDownload
+        = DeferRelease(download, [this](DownloadContext* download) { ReleaseDownload(*download); });
+
+    if (size <= mSegmentSize) {
+        return DownloaderItf::DownloadFromMirrors(digest, urls, path, size, listener);
+    }
+
+    download->mDigest   = &digest;
+    download->mURLs     = &urls;
+    download->mSize     = size;
+    download->mListener = listener;
+
+    if (err = DownloadSegments(*download); !err.IsNone()) {
+        if (!err.Is(ErrorEnum::eNotSupported)) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        LOG_DBG() << "Byte ranges not supported, download whole file" << Log::Field("digest", digest);
+
+        if (err = fs::RemoveAll(JoinSegmentsDir(path)); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        return DownloaderItf::DownloadFromMirrors(digest, urls, path, size, listener);
+    }
+
+    if (err = MergeSegments(*download); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error SegmentedDownloader::Cancel(const String& digest)
+{
+    return mDownloader->Cancel(digest);
+}
+
+RetWithError<size_t> SegmentedDownloader::GetDownloadedSize(const String& path)
+{
+    auto [size, err] = DownloaderItf::GetDownloadedSize(path);
+    if (!err.IsNone()) {
+        return {0, AOS_ERROR_WRAP(err)};
+    }
+
+    auto segmentsDir = JoinSegmentsDir(path);
+
+    auto [exist, existErr] = fs::DirExist(segmentsDir);
+    if (!existErr.IsNone()) {
+        return {0, AOS_ERROR_WRAP(existErr)};
+    }
+
+    if (!exist) {
+        return size;
+    }
+
+    auto [segmentsSize, sizeErr] = fs::CalculateSize(segmentsDir);
+    if (!sizeErr.IsNone()) {
+        return {0, AOS_ERROR_WRAP(sizeErr)};
+    }
+
+    return size + segmentsSize;
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+StaticString<cFilePathLen> SegmentedDownloader::JoinSegmentsDir(const String& path)
+{
+    StaticString<cFilePathLen> segmentsDir;
+
+    segmentsDir.Append(path).Append(cSegmentsDirSuffix);
+
+    return segmentsDir;
+}
+
+RetWithError<SegmentedDownloader::DownloadContext*> SegmentedDownloader::AcquireDownload(const String& path)
+{
+    UniqueLock lock {mMutex};
+
+    DownloadContext* download = nullptr;
+
+    // Downloads to the same path share segments, so they are serialized. Downloads to different paths run
+    // concurrently while there are free download slots.
+    auto err = mCondVar.Wait(lock, [this, &path, &download]() {
+        download = nullptr;
+
+        for (auto& item : mDownloads) {
+            if (item.mInUse && item.mPath == path) {
+                return false;
+            }
+
+            if (!item.mInUse && download == nullptr) {
+                download = &item;
+            }
+        }
+
+        return download != nullptr;
+    });
+    if (!err.IsNone()) {
+        return {nullptr, AOS_ERROR_WRAP(err)};
+    }
+
+    download->mInUse = true;
+    download->mPath  = path;
+
+    return download;
+}
+
+void SegmentedDownloader::ReleaseDownload(DownloadContext& download)
+{
+    LockGuard lock {mMutex};
+
+    download.mInUse = false;
+    download.mPath.Clear();
+    download.mSegments.Clear();
+
+    mCondVar.NotifyAll();
+}
+
+Error SegmentedDownloader::DownloadSegments(DownloadContext& download)
+{
+    if (auto err = PrepareSegments(download); !err.IsNone()) {
+        return err;
+    }
+
+    Error err;
+
+    {
+        UniqueLock lock {mMutex};
+
+        if (!mIsRunning) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "downloader is not started"));
+        }
+
+        for (size_t i = 0; i < download.mSegments.Size(); i++) {
+            if (err = mThreadPool.AddTask([this, &download, i](void*) { DownloadSegment(download, i); });
+                !err.IsNone()) {
+                break;
+            }
+
+            download.mNumPendingSegments++;
+        }
+
+        // Wait for added segments even if not all of them are added: they reference download.
+        if (auto waitErr = mCondVar.Wait(
+                lock, [this, &download]() { return download.mNumPendingSegments == 0 || !mIsRunning; });
+            !waitErr.IsNone() && err.IsNone()) {
+            err = waitErr;
+        }
+
+        if (err.IsNone() && !mIsRunning) {
+            err = Error(ErrorEnum::eCanceled, "downloader is stopped");
+        }
+    }
+
+    if (!err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    for (const auto& segment : download.mSegments) {
+        if (!segment.mError.IsNone()) {
+            return AOS_ERROR_WRAP(segment.mError);
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error SegmentedDownloader::PrepareSegments(DownloadContext& download)
+{
+    auto numSegments = (download.mSize + mSegmentSize - 1) / mSegmentSize;
+    auto segmentSize = mSegmentSize;
+
+    if (numSegments > download.mSegments.MaxSize()) {
+        numSegments = download.mSegments.MaxSize();
+        segmentSize = (download.mSize + numSegments - 1) / numSegments;
+    }
+
+    auto segmentsDir = JoinSegmentsDir(download.mPath);
+
+    if (auto err = fs::MakeDirAll(segmentsDir); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    download.mSegments.Clear();
+
+    for (size_t offset = 0; offset < download.mSize; offset += segmentSize) {
+        if (auto err = download.mSegments.EmplaceBack(); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        auto& segment = download.mSegments.Back();
+
+        segment.mRange = {offset, Min(segmentSize, download.mSize - offset)};
+
+        StaticString<cSegmentIndexLen> index;
+
+        if (auto err = index.Convert(static_cast<uint64_t>(download.mSegments.Size() - 1)); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        segment.mPath = fs::JoinPath(segmentsDir, index);
+
+        auto [exist, err] = fs::FileExist(segment.mPath);
+        if (!err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (!exist) {
+            continue;
+        }
+
+        Tie(segment.mDownloaded, err) = fs::CalculateSize(segment.mPath);
+        if (!err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (segment.mDownloaded > segment.mRange.mSize) {
+            LOG_WRN() << "Segment is bigger than expected, restart" << Log::Field("path", segment.mPath);
+
+            if (err = fs::Remove(segment.mPath); !err.IsNone()) {
+                return AOS_ERROR_WRAP(err);
+            }
+
+            segment.mDownloaded = 0;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+void SegmentedDownloader::DownloadSegment(DownloadContext& download, size_t index)
+{
+    auto& segment = download.mSegments[index];
+    Error err;
+
+    if (segment.mDownloaded != segment.mRange.mSize) {
+        ByteRange range {segment.mRange.mOffset + segment.mDownloaded, segment.mRange.mSize - segment.mDownloaded};
+
+        err = ErrorEnum::eNotFound;
+
+        // Spread segments across mirrors and fall back to the next mirror on failure.
+        for (size_t i = 0; i < download.mURLs->Size(); i++) {
+            const auto& url = (*download.mURLs)[(index + i) % download.mURLs->Size()];
+
+            err = mDownloader->DownloadRange(*download.mDigest, url, segment.mPath, range);
+            if (err.IsNone() || err.Is(ErrorEnum::eCanceled) || err.Is(ErrorEnum::eNotSupported)) {
+                break;
+            }
+
+            LOG_WRN() << "Failed to download segment" << Log::Field("url", url) << Log::Field("offset", range.mOffset)
+                      << Log::Field("size", range.mSize) << Log::Field(err);
+
+            // Keep data received before failure and continue from it.
+            auto [downloaded, sizeErr] = fs::CalculateSize(segment.mPath);
+            if (sizeErr.IsNone() && downloaded >= range.mOffset - segment.mRange.mOffset
+                && downloaded <= segment.mRange.mSize) {
+                range = {segment.mRange.mOffset + downloaded, segment.mRange.mSize - downloaded};
+            }
+        }
+    }
+
+    {
+        LockGuard lock {mMutex};
+
+        segment.mError = err;
+
+        if (err.IsNone()) {
+            segment.mDownloaded = segment.mRange.mSize;
+        }
+    }
+
+    if (err.IsNone()) {
+        NotifyProgress(download);
+    }
+
+    LockGuard lock {mMutex};
+
+    download.mNumPendingSegments--;
+    mCondVar.NotifyAll();
+}
+
+void SegmentedDownloader::NotifyProgress(DownloadContext& download)
+{
+    if (!download.mListener) {
+        return;
+    }
+
+    size_t downloaded = 0;
+
+    {
+        LockGuard lock {mMutex};
+
+        for (const auto& segment : download.mSegments) {
+            if (segment.mDownloaded == segment.mRange.mSize) {
+                downloaded += segment.mRange.mSize;
+            }
+        }
+    }
+
+    download.mListener->OnProgress(*download.mDigest, downloaded, download.mSize);
+}
+
+Error SegmentedDownloader::MergeSegments(DownloadContext& download)
+{
+    LOG_DBG() << "Merge segments" << Log::Field("path", download.mPath)
+              << Log::Field("numSegments", download.mSegments.Size());
+
+    fs::File dstFile;
+
+    if (auto err = dstFile.Open(download.mPath, fs::File::Mode::Write); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    for (const auto& segment : download.mSegments) {
+        fs::File srcFile;
+
+        if (auto err = srcFile.Open(segment.mPath, fs::File::Mode::ReadSequential); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        while (true) {
+            auto err = srcFile.ReadBlock(download.mMergeBuffer);
+            if (!err.IsNone() && !err.Is(ErrorEnum::eEOF)) {
+                return AOS_ERROR_WRAP(err);
+            }
+
+            if (auto writeErr = dstFile.WriteBlock(download.mMergeBuffer); !writeErr.IsNone()) {
+                return AOS_ERROR_WRAP(writeErr);
+            }
+
+            if (err.Is(ErrorEnum::eEOF)) {
+                break;
+            }
+        }
+    }
+
+    if (auto err = dstFile.Close(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = fs::RemoveAll(JoinSegmentsDir(download.mPath)); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+} // namespace aos::downloader
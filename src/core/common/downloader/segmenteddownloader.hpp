@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_COMMON_DOWNLOADER_SEGMENTEDDOWNLOADER_HPP_
+#define AOS_CORE_COMMON_DOWNLOADER_SEGMENTEDDOWNLOADER_HPP_
+
+#include <core/common/config.hpp>
+#include <core/common/tools/thread.hpp>
+
+#include "itf/downloader.hpp"
+
+namespace aos::downloader {
+
+/**
+ * Segment size.
+ */
+constexpr auto cSegmentSize = AOS_CONFIG_DOWNLOADER_SEGMENT_SIZE;
+
+/**
+ * Max number of segments per file.
+ */
+constexpr auto cMaxNumSegments = AOS_CONFIG_DOWNLOADER_MAX_NUM_SEGMENTS;
+
+/**
+ * Number of parallel segment downloads.
+ */
+constexpr auto cNumSegmentThreads = AOS_CONFIG_DOWNLOADER_NUM_SEGMENT_THREADS;
+
+/**
+ * Max number of concurrent segmented downloads.
+ */
+constexpr auto cMaxNumDownloads = AOS_CONFIG_DOWNLOADER_MAX_NUM_DOWNLOADS;
+
+/**
+ * Segmented downloader.
+ *
+ * Splits large files into byte range segments which are downloaded in parallel from different mirrors using the
+ * underlying downloader. Each segment is stored in a separate file in the "<path>.segments" directory and is resumed
+ * from its current size on retry. Once all segments are downloaded, they are merged into the destination file.
+ * Small files, files of unknown size and downloaders not supporting byte ranges fall back to whole file download.
+ * Downloads to different paths run concurrently up to cMaxNumDownloads, downloads to the same path are serialized.
+ */
+class SegmentedDownloader : public DownloaderItf {
+public:
+    /**
+     * Initializes segmented downloader.
+     *
+     * @param downloader underlying downloader.
+     * @param segmentSize segment size.
+     * @return Error.
+     */
+    Error Init(DownloaderItf& downloader, size_t segmentSize = cSegmentSize);
+
+    /**
+     * Starts segmented downloader.
+     *
+     * @return Error.
+     */
+    Error Start();
+
+    /**
+     * Stops segmented downloader.
+     *
+     * @return Error.
+     */
+    Error Stop();
+
+    /**
+     * Downloads file.
+     *
+     * @param digest image digest.
+     * @param url URL.
+     * @param path path to file.
+     * @return Error.
+     */
+    Error Download(const String& digest, const String& url, const String& path) override;
+
+    /**
+     * Downloads byte range of file and appends it to the file at path.
+     *
+     * @param digest image digest.
+     * @param url URL.
+     * @param path path to file.
+     * @param range byte range.
+     * @return Error.
+     */
+    Error DownloadRange(const String& digest, const String& url, const String& path, const ByteRange& range) override;
+
+    /**
+     * Downloads file from mirrors using parallel byte range segments.
+     *
+     * @param digest image digest.
+     * @param urls mirror URLs.
+     * @param path path to file.
+     * @param size file size, 0 if unknown.
+     * @param listener progress listener.
+     * @return Error.
+     */
+    Error DownloadFromMirrors(const String& digest, const Array<StaticString<cURLLen>>& urls, const String& path,
+        size_t size, ProgressListenerItf* listener = nullptr) override;
+
+    /**
+     * Cancels ongoing download.
+     *
+     * @param digest image digest.
+     *
+     * @return Error.
+     */
+    Error Cancel(const String& digest) override;
+
+    /**
+     * Returns size of data downloaded to the file at path including not merged segments.
+     *
+     * @param path path to file.
+     * @return RetWithError<size_t>.
+     */
+    RetWithError<size_t> GetDownloadedSize(const String& path) override;
+
+private:
+    static constexpr auto cSegmentsDirSuffix = ".segments";
+    static constexpr auto cMergeBlockSize    = 4096;
+    static constexpr auto cSegmentIndexLen   = 8;
+
+    struct Segment {
+        ByteRange                  mRange;
+        StaticString<cFilePathLen> mPath;
+        size_t                     mDownloaded {};
+        Error                      mError;
+    };
+
+    struct DownloadContext {
+        bool                                  mInUse {};
+        StaticString<cFilePathLen>            mPath;
+        const String*                         mDigest {};
+        const Array<StaticString<cURLLen>>*   mURLs {};
+        size_t                                mSize {};
+        ProgressListenerItf*                  mListener {};
+        size_t                                mNumPendingSegments {};
+        StaticArray<Segment, cMaxNumSegments> mSegments;
+        StaticArray<uint8_t, cMergeBlockSize> mMergeBuffer;
+    };
+
+    static StaticString<cFilePathLen> JoinSegmentsDir(const String& path);
+
+    RetWithError<DownloadContext*> AcquireDownload(const String& path);
+    void                           ReleaseDownload(DownloadContext& download);
+    Error                          DownloadSegments(DownloadContext& download);
+    Error                          PrepareSegments(DownloadContext& download);
+    void                           DownloadSegment(DownloadContext& download, size_t index);
+    void                           NotifyProgress(DownloadContext& download);
+    Error                          MergeSegments(DownloadContext& download);
+
+    DownloaderItf*                                                     mDownloader {};
+    size_t                                                             mSegmentSize {};
+    bool                                                               mIsRunning {};
+    Mutex                                                              mMutex;
+    ConditionalVariable                                                mCondVar;
+    DownloadContext                                                    mDownloads[cMaxNumDownloads];
+    ThreadPool<cNumSegmentThreads, cMaxNumSegments * cMaxNumDownloads> mThreadPool;
+};
+
+} // namespace aos::downloader
+
+#endif
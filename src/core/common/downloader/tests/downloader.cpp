@@ -4,4 +4,377 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <core/common/alerts/itf/sender.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <core/common/downloader/segmenteddownloader.hpp>
+#include <core/common/tests/utils/log.hpp>
+#include <core/common/tools/fs.hpp>
+
+using namespace testing;
+
+namespace aos::downloader {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Consts
+ **********************************************************************************************************************/
+
+const auto cTestDir     = std::filesystem::current_path() / "downloader_test";
+const auto cDownloadDir = cTestDir / "download";
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file {path, std::ios::binary};
+
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/**
+ * Fake downloader serving content from in-memory mirrors.
+ */
+class FakeDownloader : public DownloaderItf {
+public:
+    explicit FakeDownloader(std::string content, bool supportRanges = true)
+        : mContent(std::move(content))
+        , mSupportRanges(supportRanges)
+    {
+    }
+
+    Error Download(const String& digest, const String& url, const String& path) override
+    {
+        (void)digest;
+
+        std::lock_guard lock {mMutex};
+
+        mDownloadURLs.insert(url.CStr());
+
+        if (mFailedURLs.count(url.CStr())) {
+            return ErrorEnum::eFailed;
+        }
+
+        std::ofstream file {path.CStr(), std::ios::binary | std::ios::trunc};
+
+        file << mContent;
+
+        return ErrorEnum::eNone;
+    }
+
+    Error DownloadRange(const String& digest, const String& url, const String& path, const ByteRange& range) override
+    {
+        (void)digest;
+
+        const auto dir = std::filesystem::path(path.CStr()).parent_path().string();
+
+        {
+            std::lock_guard lock {mMutex};
+
+            mActiveDirs[dir]++;
+            mMaxNumActiveDirs = std::max(mMaxNumActiveDirs, mActiveDirs.size());
+        }
+
+        std::this_thread::sleep_for(mRangeDelay);
+
+        std::lock_guard lock {mMutex};
+
+        if (--mActiveDirs[dir] == 0) {
+            mActiveDirs.erase(dir);
+        }
+
+        if (!mSupportRanges) {
+            return ErrorEnum::eNotSupported;
+        }
+
+        mRanges.push_back(range);
+        mRangeURLs.insert(url.CStr());
+
+        std::ofstream file {path.CStr(), std::ios::binary | std::ios::app};
+
+        if (mFailedURLs.count(url.CStr())) {
+            // Simulate connection drop after half of range is received.
+            file << mContent.substr(range.mOffset, range.mSize / 2);
+
+            return ErrorEnum::eFailed;
+        }
+
+        file << mContent.substr(range.mOffset, range.mSize);
+
+        return ErrorEnum::eNone;
+    }
+
+    Error Cancel(const String& digest) override
+    {
+        (void)digest;
+
+        return ErrorEnum::eNone;
+    }
+
+    void SetFailedURL(const std::string& url) { mFailedURLs.insert(url); }
+    void SetRangeDelay(std::chrono::milliseconds delay) { mRangeDelay = delay; }
+
+    size_t GetMaxNumActiveDirs() const { return mMaxNumActiveDirs; }
+
+    std::vector<ByteRange> GetRanges() const { return mRanges; }
+    std::set<std::string>  GetRangeURLs() const { return mRangeURLs; }
+    std::set<std::string>  GetDownloadURLs() const { return mDownloadURLs; }
+
+private:
+    std::mutex                    mMutex;
+    std::string                   mContent;
+    bool                          mSupportRanges;
+    std::chrono::milliseconds     mRangeDelay {};
+    std::set<std::string>         mFailedURLs;
+    std::vector<ByteRange>        mRanges;
+    std::set<std::string>         mRangeURLs;
+    std::set<std::string>         mDownloadURLs;
+    std::map<std::string, size_t> mActiveDirs;
+    size_t                        mMaxNumActiveDirs {};
+};
+
+class ProgressListener : public ProgressListenerItf {
+public:
+    void OnProgress(const String& digest, size_t downloaded, size_t total) override
+    {
+        (void)digest;
+
+        std::lock_guard lock {mMutex};
+
+        mDownloaded = std::max(mDownloaded, downloaded);
+        mTotal      = total;
+    }
+
+    size_t GetDownloaded() const { return mDownloaded; }
+    size_t GetTotal() const { return mTotal; }
+
+private:
+    std::mutex mMutex;
+    size_t     mDownloaded {};
+    size_t     mTotal {};
+};
+
+std::string GenerateContent(size_t size)
+{
+    std::string content;
+
+    for (size_t i = 0; i < size; i++) {
+        content.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    return content;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class DownloaderTest : public Test {
+protected:
+    void SetUp() override
+    {
+        tests::utils::InitLog();
+
+        std::filesystem::remove_all(cTestDir);
+        std::filesystem::create_directories(cDownloadDir);
+
+        mURLs.PushBack("http://mirror1/blob");
+        mURLs.PushBack("http://mirror2/blob");
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cTestDir); }
+
+    StaticArray<StaticString<cURLLen>, cMaxNumURLs> mURLs;
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(DownloaderTest, DefaultDownloadFromMirrorsFallsBackToNextMirror)
+{
+    const auto     content = GenerateContent(100);
+    const auto     path    = cDownloadDir / "blob";
+    FakeDownloader downloader {content};
+
+    downloader.SetFailedURL("http://mirror1/blob");
+
+    ASSERT_TRUE(downloader.DownloaderItf::DownloadFromMirrors("digest", mURLs, path.c_str(), content.size()).IsNone());
+
+    EXPECT_EQ(ReadFile(path), content);
+    EXPECT_EQ(downloader.GetDownloadURLs(), (std::set<std::string> {"http://mirror1/blob", "http://mirror2/blob"}));
+}
+
+TEST_F(DownloaderTest, SegmentedDownload)
+{
+    const auto                           content = GenerateContent(1000);
+    const auto                           path    = cDownloadDir / "blob";
+    FakeDownloader                       fakeDownloader {content};
+    ProgressListener                     listener;
+    std::unique_ptr<SegmentedDownloader> downloader = std::make_unique<SegmentedDownloader>();
+
+    ASSERT_TRUE(downloader->Init(fakeDownloader, 128).IsNone());
+    ASSERT_TRUE(downloader->Start().IsNone());
+
+    ASSERT_TRUE(downloader->DownloadFromMirrors("digest", mURLs, path.c_str(), content.size(), &listener).IsNone());
+
+    EXPECT_EQ(ReadFile(path), content);
+    EXPECT_EQ(fakeDownloader.GetRanges().size(), 8);
+    EXPECT_EQ(fakeDownloader.GetRangeURLs(), (std::set<std::string> {"http://mirror1/blob", "http://mirror2/blob"}));
+    EXPECT_EQ(listener.GetDownloaded(), content.size());
+    EXPECT_EQ(listener.GetTotal(), content.size());
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".segments"));
+
+    ASSERT_TRUE(downloader->Stop().IsNone());
+}
+
+TEST_F(DownloaderTest, SegmentedDownloadResumesSegments)
+{
+    const auto                           content = GenerateContent(1000);
+    const auto                           path    = cDownloadDir / "blob";
+    const auto                           segDir  = path.string() + ".segments";
+    FakeDownloader                       fakeDownloader {content};
+    std::unique_ptr<SegmentedDownloader> downloader = std::make_unique<SegmentedDownloader>();
+
+    // First segment is complete, second segment is partially downloaded.
+    std::filesystem::create_directories(segDir);
+    std::ofstream(segDir + "/0", std::ios::binary) << content.substr(0, 500);
+    std::ofstream(segDir + "/1", std::ios::binary) << content.substr(500, 100);
+
+    ASSERT_TRUE(downloader->Init(fakeDownloader, 500).IsNone());
+    ASSERT_TRUE(downloader->Start().IsNone());
+
+    ASSERT_TRUE(downloader->DownloadFromMirrors("digest", mURLs, path.c_str(), content.size()).IsNone());
+
+    EXPECT_EQ(ReadFile(path), content);
+
+    const auto ranges = fakeDownloader.GetRanges();
+
+    ASSERT_EQ(ranges.size(), 1);
+    EXPECT_EQ(ranges[0], (ByteRange {600, 400}));
+
+    ASSERT_TRUE(downloader->Stop().IsNone());
+}
+
+TEST_F(DownloaderTest, SegmentedDownloadedSize)
+{
+    const auto                           content = GenerateContent(1000);
+    const auto                           path    = cDownloadDir / "blob";
+    const auto                           segDir  = path.string() + ".segments";
+    FakeDownloader                       fakeDownloader {content};
+    std::unique_ptr<SegmentedDownloader> downloader = std::make_unique<SegmentedDownloader>();
+
+    ASSERT_TRUE(downloader->Init(fakeDownloader, 500).IsNone());
+
+    auto [size, err] = downloader->GetDownloadedSize(path.c_str());
+    ASSERT_TRUE(err.IsNone());
+    EXPECT_EQ(size, 0);
+
+    // Partially downloaded segments are not merged to the file yet.
+    std::filesystem::create_directories(segDir);
+    std::ofstream(segDir + "/0", std::ios::binary) << content.substr(0, 500);
+    std::ofstream(segDir + "/1", std::ios::binary) << content.substr(500, 100);
+
+    Tie(size, err) = downloader->GetDownloadedSize(path.c_str());
+    ASSERT_TRUE(err.IsNone());
+    EXPECT_EQ(size, 600);
+
+    ASSERT_TRUE(downloader->Start().IsNone());
+
+    ASSERT_TRUE(downloader->DownloadFromMirrors("digest", mURLs, path.c_str(), content.size()).IsNone());
+
+    Tie(size, err) = downloader->GetDownloadedSize(path.c_str());
+    ASSERT_TRUE(err.IsNone());
+    EXPECT_EQ(size, content.size());
+
+    ASSERT_TRUE(downloader->Stop().IsNone());
+}
+
+TEST_F(DownloaderTest, SegmentedDownloadConcurrentPaths)
+{
+    const auto                           content = GenerateContent(1000);
+    FakeDownloader                       fakeDownloader {content};
+    std::unique_ptr<SegmentedDownloader> downloader = std::make_unique<SegmentedDownloader>();
+
+    fakeDownloader.SetRangeDelay(std::chrono::milliseconds(50));
+
+    ASSERT_TRUE(downloader->Init(fakeDownloader, 250).IsNone());
+    ASSERT_TRUE(downloader->Start().IsNone());
+
+    // Two downloads to different paths and one more to the same path as the first one.
+    const std::vector<std::filesystem::path> paths
+        = {cDownloadDir / "blob1", cDownloadDir / "blob2", cDownloadDir / "blob1"};
+    std::vector<std::thread> threads;
+    std::vector<Error>       errors(paths.size());
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        threads.emplace_back([&, i]() {
+            errors[i] = downloader->DownloadFromMirrors("digest", mURLs, paths[i].c_str(), content.size());
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        EXPECT_TRUE(errors[i].IsNone()) << errors[i].Message();
+        EXPECT_EQ(ReadFile(paths[i]), content);
+    }
+
+    EXPECT_EQ(fakeDownloader.GetMaxNumActiveDirs(), 2);
+
+    ASSERT_TRUE(downloader->Stop().IsNone());
+}
+
+TEST_F(DownloaderTest, SegmentedDownloadFallsBackToNextMirror)
+{
+    const auto                           content = GenerateContent(1000);
+    const auto                           path    = cDownloadDir / "blob";
+    FakeDownloader                       fakeDownloader {content};
+    std::unique_ptr<SegmentedDownloader> downloader = std::make_unique<SegmentedDownloader>();
+
+    fakeDownloader.SetFailedURL("http://mirror1/blob");
+
+    ASSERT_TRUE(downloader->Init(fakeDownloader, 250).IsNone());
+    ASSERT_TRUE(downloader->Start().IsNone());
+
+    ASSERT_TRUE(downloader->DownloadFromMirrors("digest", mURLs, path.c_str(), content.size()).IsNone());
+
+    EXPECT_EQ(ReadFile(path), content);
+
+    ASSERT_TRUE(downloader->Stop().IsNone());
+}
+
+TEST_F(DownloaderTest, SegmentedDownloadWithoutRangeSupport)
+{
+    const auto                           content = GenerateContent(1000);
+    const auto                           path    = cDownloadDir / "blob";
+    FakeDownloader                       fakeDownloader {content, false};
+    std::unique_ptr<SegmentedDownloader> downloader = std::make_unique<SegmentedDownloader>();
+
+    ASSERT_TRUE(downloader->Init(fakeDownloader, 250).IsNone());
+    ASSERT_TRUE(downloader->Start().IsNone());
+
+    ASSERT_TRUE(downloader->DownloadFromMirrors("digest", mURLs, path.c_str(), content.size()).IsNone());
+
+    EXPECT_EQ(ReadFile(path), content);
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".segments"));
+
+    ASSERT_TRUE(downloader->Stop().IsNone());
+}
+
+} // namespace aos::downloader
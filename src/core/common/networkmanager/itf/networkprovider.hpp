@@ -75,6 +75,27 @@ public:
      * @return Error.
      */
     virtual Error SyncNetworkState(const String& nodeID, const Array<InstanceNetworkStateInfo>& instances) = 0;
+
+    /**
+     * Sends instance network state changes since the previous successful sync to CM.
+     *
+     * CM should return error if it doesn't keep the previously synced state of the node, then the caller sends full
+     * state with SyncNetworkState.
+     *
+     * @param nodeID node identifier.
+     * @param updated added or changed instances.
+     * @param removed removed instances.
+     * @return Error.
+     */
+    virtual Error SyncNetworkStateDelta(
+        const String& nodeID, const Array<InstanceNetworkStateInfo>& updated, const Array<InstanceIdent>& removed)
+    {
+        (void)nodeID;
+        (void)updated;
+        (void)removed;
+
+        return ErrorEnum::eNotSupported;
+    }
 };
 
 /** @}*/
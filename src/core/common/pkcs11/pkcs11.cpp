@@ -555,6 +555,101 @@ RetWithError<SharedPtr<SessionContext>> LibraryContext::PKCS11OpenSession(SlotID
     return {session, ErrorEnum::eNone};
 }
 
+/***********************************************************************************************************************
+ * SessionPool
+ **********************************************************************************************************************/
+
+SessionPool::SessionPool(const SharedPtr<SessionContext>& session)
+    : mPrimarySession(session)
+{
+    [[maybe_unused]] auto err = mSessions.PushBack({session, false});
+    assert(err.IsNone());
+}
+
+RetWithError<SharedPtr<SessionContext>> SessionPool::Borrow()
+{
+    UniqueLock lock {mMutex};
+
+    while (true) {
+        auto entry = mSessions.FindIf([](const Entry& entry) { return !entry.mBusy; });
+        if (entry != mSessions.end()) {
+            entry->mBusy = true;
+
+            return {entry->mSession, ErrorEnum::eNone};
+        }
+
+        if (mSessions.Size() < mSessions.MaxSize()) {
+            auto [session, err] = OpenSession();
+            if (err.IsNone()) {
+                if (err = mSessions.PushBack({session, true}); !err.IsNone()) {
+                    return {nullptr, AOS_ERROR_WRAP(err)};
+                }
+
+                return {session, ErrorEnum::eNone};
+            }
+
+            // Token may limit number of sessions, wait for busy one then.
+            LOG_WRN() << "Can't open pool session: err=" << err;
+        }
+
+        if (auto err = mCondVar.Wait(lock); !err.IsNone()) {
+            return {nullptr, AOS_ERROR_WRAP(err)};
+        }
+    }
+}
+
+void SessionPool::Return(const SharedPtr<SessionContext>& session, bool valid)
+{
+    {
+        LockGuard lock {mMutex};
+
+        auto entry = mSessions.FindIf([&session](const Entry& entry) { return entry.mSession.Get() == session.Get(); });
+        if (entry == mSessions.end()) {
+            return;
+        }
+
+        if (valid || entry->mSession.Get() == mPrimarySession.Get()) {
+            entry->mBusy = false;
+        } else {
+            mSessions.Erase(entry);
+        }
+    }
+
+    mCondVar.NotifyOne();
+}
+
+bool SessionPool::IsSessionLost(const Error& err)
+{
+    return err.Errno() == CKR_SESSION_HANDLE_INVALID || err.Errno() == CKR_SESSION_CLOSED;
+}
+
+RetWithError<SharedPtr<SessionContext>> SessionPool::OpenSession()
+{
+    auto funcList = mPrimarySession->GetFunctionList();
+
+    if (!funcList || !funcList->C_OpenSession) {
+        return {nullptr, ErrorEnum::eWrongState};
+    }
+
+    SessionInfo info;
+
+    if (auto err = mPrimarySession->GetSessionInfo(info); !err.IsNone()) {
+        return {nullptr, err};
+    }
+
+    SessionHandle handle;
+
+    CK_RV rv = funcList->C_OpenSession(
+        info.slotID, info.flags & (CKF_RW_SESSION | CKF_SERIAL_SESSION), nullptr, nullptr, &handle);
+    if (rv != CKR_OK) {
+        return {nullptr, static_cast<int>(rv)};
+    }
+
+    LOG_DBG() << "Open pool session: slotID=" << info.slotID << ", poolSize=" << mSessions.Size() + 1;
+
+    return {MakeShared<SessionContext>(&mAllocator, handle, funcList), ErrorEnum::eNone};
+}
+
 /***********************************************************************************************************************
  * SessionContext
  **********************************************************************************************************************/
@@ -11,6 +11,7 @@
 #include <core/common/crypto/itf/crypto.hpp>
 #include <core/common/tools/log.hpp>
 #include <core/common/tools/memory.hpp>
+#include <core/common/tools/thread.hpp>
 #include <core/common/tools/utils.hpp>
 #include <core/common/tools/uuid.hpp>
 
@@ -641,6 +642,87 @@ private:
     Mutex                                                                          mMutex;
 };
 
+/**
+ * Maximum number of sessions in a key session pool.
+ */
+constexpr auto cSessionPoolMaxSize = AOS_CONFIG_PKCS11_SESSION_POOL_MAX_SIZE;
+
+/**
+ * Pool of sessions to run operations with the same key in parallel.
+ *
+ * The pool starts with the session the key belongs to. Additional sessions for the same slot are opened on demand up
+ * to cSessionPoolMaxSize. Login state is shared by all application sessions on a token, so additional sessions don't
+ * require separate login.
+ */
+class SessionPool : private NonCopyable {
+public:
+    /**
+     * Constructs object instance.
+     *
+     * @param session primary session.
+     */
+    explicit SessionPool(const SharedPtr<SessionContext>& session);
+
+    /**
+     * Borrows idle session from the pool. Waits if all sessions are busy and pool is full.
+     *
+     * @return RetWithError<SharedPtr<SessionContext>>.
+     */
+    RetWithError<SharedPtr<SessionContext>> Borrow();
+
+    /**
+     * Returns borrowed session to the pool.
+     *
+     * @param session borrowed session.
+     * @param valid false if session is not usable anymore and should be closed.
+     */
+    void Return(const SharedPtr<SessionContext>& session, bool valid = true);
+
+    /**
+     * Runs operation on borrowed session.
+     *
+     * @param operation operation to run.
+     * @return Error.
+     */
+    template <typename Operation>
+    Error Run(Operation operation)
+    {
+        while (true) {
+            auto [session, err] = Borrow();
+            if (!err.IsNone()) {
+                return err;
+            }
+
+            err = operation(*session);
+
+            // Additional session may be closed by closing all slot sessions, retry on other session then.
+            auto lost = IsSessionLost(err) && session.Get() != mPrimarySession.Get();
+
+            Return(session, !lost);
+
+            if (!lost) {
+                return err;
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        SharedPtr<SessionContext> mSession;
+        bool                      mBusy = false;
+    };
+
+    static bool IsSessionLost(const Error& err);
+
+    RetWithError<SharedPtr<SessionContext>> OpenSession();
+
+    SharedPtr<SessionContext>                                     mPrimarySession;
+    Mutex                                                         mMutex;
+    ConditionalVariable                                           mCondVar;
+    StaticArray<Entry, cSessionPoolMaxSize>                       mSessions;
+    StaticAllocator<sizeof(SessionContext) * cSessionPoolMaxSize> mAllocator;
+};
+
 /**
  * A Curve represents a short-form Weierstrass curve.
  */
@@ -23,7 +23,7 @@ constexpr uint8_t PKCS11RSAPrivateKey::cSHA512Prefix[];
 
 PKCS11RSAPrivateKey::PKCS11RSAPrivateKey(
     const SharedPtr<SessionContext>& session, ObjectHandle privKeyHandle, const crypto::RSAPublicKey& pubKey)
-    : mSession(session)
+    : mSessionPool(session)
     , mPrivKeyHandle(privKeyHandle)
     , mPublicKey(pubKey)
 {
@@ -45,7 +45,9 @@ Error PKCS11RSAPrivateKey::Sign(
 
     CK_MECHANISM mechanism = {CKM_RSA_PKCS, nullptr, 0};
 
-    return mSession->Sign(&mechanism, mPrivKeyHandle, *t, signature);
+    return mSessionPool.Run([&](const SessionContext& session) {
+        return session.Sign(&mechanism, mPrivKeyHandle, *t, signature);
+    });
 }
 
 Error PKCS11RSAPrivateKey::Decrypt(
@@ -59,7 +61,9 @@ Error PKCS11RSAPrivateKey::Decrypt(
         return AOS_ERROR_WRAP(err);
     }
 
-    return mSession->Decrypt(&mech, mPrivKeyHandle, cipher, result);
+    return mSessionPool.Run([&, mech = mech](const SessionContext& session) mutable {
+        return session.Decrypt(&mech, mPrivKeyHandle, cipher, result);
+    });
 }
 
 Array<uint8_t> PKCS11RSAPrivateKey::GetPrefix(crypto::Hash hash) const
@@ -153,7 +157,7 @@ RetWithError<CK_MECHANISM> PCKS11RSAMechConverter::Visit(const crypto::OAEPDecry
 
 PKCS11ECDSAPrivateKey::PKCS11ECDSAPrivateKey(const SharedPtr<SessionContext>& session,
     crypto::x509::ProviderItf& cryptoProvider, ObjectHandle privKeyHandle, const crypto::ECDSAPublicKey& pubKey)
-    : mSession(session)
+    : mSessionPool(session)
     , mCryptoProvider(cryptoProvider)
     , mPrivKeyHandle(privKeyHandle)
     , mPublicKey(pubKey)
@@ -173,7 +177,9 @@ Error PKCS11ECDSAPrivateKey::Sign(
 
     CK_MECHANISM mechanism = {CKM_ECDSA, nullptr, 0};
 
-    return mSession->Sign(&mechanism, mPrivKeyHandle, digest, signature);
+    return mSessionPool.Run([&](const SessionContext& session) {
+        return session.Sign(&mechanism, mPrivKeyHandle, digest, signature);
+    });
 }
 
 } // namespace aos::pkcs11
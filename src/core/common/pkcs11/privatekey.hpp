@@ -77,9 +77,9 @@ private:
 
     mutable StaticAllocator<sizeof(StaticArray<uint8_t, crypto::cSHA2DigestSize + cMaxPrefixSize>)> mAllocator;
 
-    SharedPtr<SessionContext> mSession;
-    ObjectHandle              mPrivKeyHandle;
-    crypto::RSAPublicKey      mPublicKey;
+    mutable SessionPool  mSessionPool;
+    ObjectHandle         mPrivKeyHandle;
+    crypto::RSAPublicKey mPublicKey;
 };
 
 /**
@@ -162,7 +162,7 @@ public:
     }
 
 private:
-    SharedPtr<SessionContext>  mSession;
+    mutable SessionPool        mSessionPool;
     crypto::x509::ProviderItf& mCryptoProvider;
     ObjectHandle               mPrivKeyHandle;
     crypto::ECDSAPublicKey     mPublicKey;
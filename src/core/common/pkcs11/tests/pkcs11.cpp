@@ -6,6 +6,9 @@
  */
 
 #include <fstream>
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 
 #include <core/common/pkcs11/privatekey.hpp>
@@ -416,6 +419,60 @@ TEST_F(PKCS11Test, PKCS11RSAPrivateKeySign)
     ASSERT_TRUE(mCryptoFactory.VerifySignature(pubKey, signature, digest));
 }
 
+TEST_F(PKCS11Test, PKCS11RSAPrivateKeySignConcurrently)
+{
+    constexpr auto cNumThreads = cSessionPoolMaxSize * 2;
+
+    Error                     err = ErrorEnum::eNone;
+    SharedPtr<SessionContext> session;
+
+    Tie(session, err) = mSoftHSMEnv.OpenUserSession(mPIN, true);
+    ASSERT_TRUE(err.IsNone());
+
+    // generate key
+    uuid::UUID id;
+
+    Tie(id, err) = uuid::StringToUUID("08080808-0404-0404-0404-121212121212");
+    ASSERT_TRUE(err.IsNone());
+
+    PrivateKey pkcs11key;
+
+    Tie(pkcs11key, err) = Utils(session, *mCryptoProvider, mAllocator).GenerateRSAKeyPairWithLabel(id, mLabel, 2048);
+    ASSERT_TRUE(err.IsNone());
+
+    // generate signatures in parallel
+    const std::string        msg = "Hello World";
+    StaticArray<uint8_t, 32> digest;
+
+    auto [hash, hashErr] = mHashProvider->CreateHash(crypto::HashEnum::eSHA256);
+    ASSERT_TRUE(hashErr.IsNone());
+
+    ASSERT_TRUE(hash->Update(Array<uint8_t>(reinterpret_cast<const uint8_t*>(msg.data()), msg.length())).IsNone());
+    ASSERT_TRUE(hash->Finalize(digest).IsNone());
+
+    auto privKey = pkcs11key.GetPrivKey();
+
+    std::vector<StaticArray<uint8_t, 256>> signatures(cNumThreads);
+    std::vector<Error>                     errors(cNumThreads);
+    std::vector<std::thread>               threads;
+
+    for (size_t i = 0; i < cNumThreads; i++) {
+        threads.emplace_back([&, i]() { errors[i] = privKey->Sign(digest, {crypto::HashEnum::eSHA256}, signatures[i]); });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // verify signatures valid
+    const auto& pubKey = static_cast<const crypto::RSAPublicKey&>(privKey->GetPublic());
+
+    for (size_t i = 0; i < cNumThreads; i++) {
+        ASSERT_TRUE(errors[i].IsNone());
+        ASSERT_TRUE(mCryptoFactory.VerifySignature(pubKey, signatures[i], digest));
+    }
+}
+
 TEST_F(PKCS11Test, PKCS11ECDSAPrivateKeySign)
 {
     Error                     err = ErrorEnum::eNone;
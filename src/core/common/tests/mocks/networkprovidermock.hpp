@@ -28,6 +28,9 @@ public:
     MOCK_METHOD(Error, ReleaseNodeNetwork, (const String& networkID, const String& nodeID), (override));
     MOCK_METHOD(
         Error, SyncNetworkState, (const String& nodeID, const Array<InstanceNetworkStateInfo>& instances), (override));
+    MOCK_METHOD(Error, SyncNetworkStateDelta,
+        (const String& nodeID, const Array<InstanceNetworkStateInfo>& updated, const Array<InstanceIdent>& removed),
+        (override));
 };
 
 } // namespace aos::networkmanager
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sched.h>
+
+#include "asynclog.hpp"
+
+namespace aos {
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+AsyncLog::AsyncLog()
+{
+    for (size_t i = 0; i < cAsyncLogQueueSize; i++) {
+        mRecords[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+AsyncLog::~AsyncLog()
+{
+    Stop();
+}
+
+Error AsyncLog::Start(AsyncLogCallback callback)
+{
+    if (!callback) {
+        return AOS_ERROR_WRAP(ErrorEnum::eInvalidArgument);
+    }
+
+    AsyncLog* expected = nullptr;
+
+    if (!GetInstance().compare_exchange_strong(expected, this)) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "async log already started"));
+    }
+
+    mCallback = callback;
+    mStop.store(false);
+
+    if (auto err = mThread.Run([this](void*) {
+            while (true) {
+                mSemaphore.Lock();
+
+                auto stop = mStop.load();
+
+                ProcessRecords();
+
+                if (stop) {
+                    break;
+                }
+            }
+        });
+        !err.IsNone()) {
+        GetInstance().store(nullptr);
+
+        return AOS_ERROR_WRAP(err);
+    }
+
+    mPrevLogCallback = Log::SetCallback(LogCallback);
+
+    return ErrorEnum::eNone;
+}
+
+Error AsyncLog::Stop()
+{
+    AsyncLog* expected = this;
+
+    if (!GetInstance().compare_exchange_strong(expected, nullptr)) {
+        return ErrorEnum::eNone;
+    }
+
+    Log::SetCallback(mPrevLogCallback);
+
+    // Logging threads which have taken the instance before it was reset may still be pushing records: wait for them,
+    // otherwise the records are pushed after the consumer thread is stopped or into destroyed instance.
+    while (GetActiveWriters().load() != 0) {
+        sched_yield();
+    }
+
+    mStop.store(true);
+
+    if (auto err = mSemaphore.Unlock(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (auto err = mThread.Join(); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+std::atomic<AsyncLog*>& AsyncLog::GetInstance()
+{
+    static std::atomic<AsyncLog*> sInstance {};
+
+    return sInstance;
+}
+
+std::atomic<size_t>& AsyncLog::GetActiveWriters()
+{
+    static std::atomic<size_t> sActiveWriters {};
+
+    return sActiveWriters;
+}
+
+void AsyncLog::LogCallback(const String& module, LogLevel level, const String& message)
+{
+    // Sequentially consistent order between writer counter and instance guarantees that Stop either sees this writer
+    // as active or this writer sees reset instance.
+    GetActiveWriters().fetch_add(1);
+
+    if (auto instance = GetInstance().load(); instance) {
+        instance->Push(module, level, message);
+    }
+
+    GetActiveWriters().fetch_sub(1);
+}
+
+void AsyncLog::Push(const String& module, LogLevel level, const String& message)
+{
+    auto    pos    = mEnqueuePos.load(std::memory_order_relaxed);
+    Record* record = nullptr;
+
+    // Bounded MPMC queue: slot sequence equal to position means the slot is free for this position.
+    while (true) {
+        record = &mRecords[pos & (cAsyncLogQueueSize - 1)];
+
+        auto diff = static_cast<intptr_t>(record->mSequence.load(std::memory_order_acquire))
+            - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+
+            return;
+        } else {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->mModule.Assign(String(module.CStr(), Min(module.Size(), record->mModule.MaxSize())));
+    record->mLevel = level;
+    record->mTime  = Time::Now();
+    record->mMessage.Assign(String(message.CStr(), Min(message.Size(), record->mMessage.MaxSize())));
+
+    record->mSequence.store(pos + 1, std::memory_order_release);
+
+    mSemaphore.Unlock();
+}
+
+void AsyncLog::ProcessRecords()
+{
+    while (true) {
+        auto& record = mRecords[mDequeuePos & (cAsyncLogQueueSize - 1)];
+
+        if (record.mSequence.load(std::memory_order_acquire) != mDequeuePos + 1) {
+            break;
+        }
+
+        mCallback(record.mModule, record.mLevel, record.mTime, record.mMessage);
+
+        record.mSequence.store(mDequeuePos + cAsyncLogQueueSize, std::memory_order_release);
+        mDequeuePos++;
+    }
+
+    ReportDropped();
+}
+
+void AsyncLog::ReportDropped()
+{
+    auto droppedCount = mDroppedCount.load(std::memory_order_relaxed);
+
+    if (droppedCount == mReportedCount) {
+        return;
+    }
+
+    StaticString<Log::cMaxLineLen> message = "Log records dropped: count=";
+    StaticString<24>               count;
+
+    count.Convert(static_cast<uint64_t>(droppedCount - mReportedCount));
+    message.Append(count);
+
+    mCallback(cModule, LogLevelEnum::eWarning, Time::Now(), message);
+
+    mReportedCount = droppedCount;
+}
+
+} // namespace aos
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_COMMON_TOOLS_ASYNCLOG_HPP_
+#define AOS_CORE_COMMON_TOOLS_ASYNCLOG_HPP_
+
+#include <atomic>
+
+#include "config.hpp"
+#include "log.hpp"
+#include "thread.hpp"
+#include "time.hpp"
+
+namespace aos {
+
+/**
+ * Async log queue size.
+ */
+constexpr auto cAsyncLogQueueSize = AOS_CONFIG_LOG_ASYNC_QUEUE_SIZE;
+
+/**
+ * Async log sink callback.
+ */
+using AsyncLogCallback = void (*)(const String& module, LogLevel level, const Time& time, const String& message);
+
+/**
+ * Asynchronous log backend.
+ *
+ * Installs itself as log callback. Log records are pushed into lock-free multi-producer ring on the logging thread and
+ * passed to the sink callback by dedicated consumer thread, so slow log sink doesn't stall logging threads. If ring is
+ * full, the record is dropped and counted. Dropped records are reported to the sink as warning.
+ */
+class AsyncLog : private NonCopyable {
+public:
+    /**
+     * Constructs async log.
+     */
+    AsyncLog();
+
+    /**
+     * Destructs async log.
+     */
+    ~AsyncLog();
+
+    /**
+     * Starts async log.
+     *
+     * @param callback sink callback.
+     * @return Error.
+     */
+    Error Start(AsyncLogCallback callback);
+
+    /**
+     * Stops async log. Waits for logging threads which are pushing records, passes pending records to the sink callback
+     * and restores log callback installed before start.
+     *
+     * @return Error.
+     */
+    Error Stop();
+
+    /**
+     * Returns number of dropped records.
+     *
+     * @return size_t.
+     */
+    size_t GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+private:
+    static_assert(cAsyncLogQueueSize > 0 && (cAsyncLogQueueSize & (cAsyncLogQueueSize - 1)) == 0,
+        "async log queue size should be power of two");
+
+    static constexpr auto cModule = "asynclog";
+
+    struct Record {
+        std::atomic<size_t>            mSequence {};
+        StaticString<Log::cModuleLen>  mModule;
+        LogLevel                       mLevel;
+        Time                           mTime;
+        StaticString<Log::cMaxLineLen> mMessage;
+    };
+
+    static std::atomic<AsyncLog*>& GetInstance();
+    static std::atomic<size_t>&    GetActiveWriters();
+    static void                    LogCallback(const String& module, LogLevel level, const String& message);
+
+    void Push(const String& module, LogLevel level, const String& message);
+    void ProcessRecords();
+    void ReportDropped();
+
+    AsyncLogCallback    mCallback {};
+    aos::LogCallback    mPrevLogCallback {};
+    Record              mRecords[cAsyncLogQueueSize];
+    std::atomic<size_t> mEnqueuePos {};
+    size_t              mDequeuePos {};
+    std::atomic<size_t> mDroppedCount {};
+    size_t              mReportedCount {};
+    std::atomic<bool>   mStop {};
+    Semaphore           mSemaphore {0};
+    Thread<>            mThread;
+};
+
+} // namespace aos
+
+#endif
@@ -34,6 +34,30 @@
 #define AOS_CONFIG_LOG_LINE_LEN 512
 #endif
 
+/**
+ * Max number of modules with runtime log level.
+ *
+ */
+#ifndef AOS_CONFIG_LOG_MAX_NUM_MODULES
+#define AOS_CONFIG_LOG_MAX_NUM_MODULES 32
+#endif
+
+/**
+ * Max log module name length.
+ *
+ */
+#ifndef AOS_CONFIG_LOG_MODULE_LEN
+#define AOS_CONFIG_LOG_MODULE_LEN 32
+#endif
+
+/**
+ * Async log queue size. Should be power of two.
+ *
+ */
+#ifndef AOS_CONFIG_LOG_ASYNC_QUEUE_SIZE
+#define AOS_CONFIG_LOG_ASYNC_QUEUE_SIZE 64
+#endif
+
 /**
  * Configures function max size.
  */
@@ -106,6 +130,55 @@
 #define AOS_CONFIG_FS_DIR_ITERATOR_MAX_COUNT 32
 #endif
 
+/**
+ * Max number of directory size calculations running in parallel.
+ */
+#ifndef AOS_CONFIG_FS_CALCULATE_SIZE_MAX_CONCURRENT
+#define AOS_CONFIG_FS_CALCULATE_SIZE_MAX_CONCURRENT 4
+#endif
+
+/**
+ * Max number of file info calculations running in parallel.
+ */
+#ifndef AOS_CONFIG_FS_FILE_INFO_MAX_CONCURRENT
+#define AOS_CONFIG_FS_FILE_INFO_MAX_CONCURRENT 2
+#endif
+
+/**
+ * Max number of file hash calculations with pooled read buffer running in parallel.
+ */
+#ifndef AOS_CONFIG_FS_FILE_HASH_MAX_CONCURRENT
+#define AOS_CONFIG_FS_FILE_HASH_MAX_CONCURRENT 2
+#endif
+
+/**
+ * Size of pooled read buffer used to calculate file hash.
+ */
+#ifndef AOS_CONFIG_FS_HASH_BUFFER_SIZE
+#define AOS_CONFIG_FS_HASH_BUFFER_SIZE (16 * 1024)
+#endif
+
+/**
+ * Default time to wait for free file info hasher, in seconds.
+ */
+#ifndef AOS_CONFIG_FS_FILE_INFO_ACQUIRE_TIMEOUT_SEC
+#define AOS_CONFIG_FS_FILE_INFO_ACQUIRE_TIMEOUT_SEC 60
+#endif
+
+/**
+ * Size of file block mapped into memory for sequential reading.
+ */
+#ifndef AOS_CONFIG_FS_FILE_MAP_BLOCK_SIZE
+#define AOS_CONFIG_FS_FILE_MAP_BLOCK_SIZE (1024 * 1024)
+#endif
+
+/**
+ * Size of sequentially read file data after which it is dropped from the page cache.
+ */
+#ifndef AOS_CONFIG_FS_FILE_DROP_CACHE_SIZE
+#define AOS_CONFIG_FS_FILE_DROP_CACHE_SIZE (1024 * 1024)
+#endif
+
 /**
  * Size of a time in string representation.
  */
@@ -5,6 +5,8 @@
  */
 
 #include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -21,8 +23,82 @@ namespace aos::fs {
 
 namespace {
 
-Mutex                                     sCalculateSizeMutex;
-StaticAllocator<sizeof(DirIteratorArray)> sCalculateSizeAllocator;
+Semaphore sCalculateSizeSemaphore {cCalculateSizeMaxConcurrent};
+
+StaticAllocator<sizeof(DirIteratorArray) * cCalculateSizeMaxConcurrent, cCalculateSizeMaxConcurrent>
+    sCalculateSizeAllocator;
+
+// Each file info calculation holds one hash, so the pool bounds this provider's hashes by the crypto provider
+// capacity. The hash allocator is shared with other users, so CreateHash may still fail with eNoMemory.
+static_assert(cFileInfoMaxConcurrent <= AOS_CONFIG_CRYPTO_HASHER_COUNT, "too many concurrent file info calculations");
+
+Error WriteData(int fd, const Array<uint8_t>& data)
+{
+    size_t pos = 0;
+
+    while (pos < data.Size()) {
+        auto chunkSize = write(fd, data.Get() + pos, data.Size() - pos);
+        if (chunkSize < 0) {
+            return Error(errno);
+        }
+
+        pos += chunkSize;
+    }
+
+    return ErrorEnum::eNone;
+}
+
+#ifndef __ZEPHYR__
+
+Error WriteTmpFile(int fd, const Array<uint8_t>& data, uint32_t perm, Durability durability)
+{
+    // Permissions are set before rename, so the target never has default mkstemp permissions.
+    if (fchmod(fd, perm) != 0) {
+        return Error(errno);
+    }
+
+    if (auto err = WriteData(fd, data); !err.IsNone()) {
+        return err;
+    }
+
+    if (durability != Durability::None && fdatasync(fd) != 0) {
+        return Error(errno);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error SyncParentDir(const String& fileName)
+{
+    StaticString<cFilePathLen> parentPath;
+
+    if (auto err = ParentPath(fileName, parentPath); !err.IsNone()) {
+        return err;
+    }
+
+    if (parentPath.IsEmpty()) {
+        parentPath = ".";
+    }
+
+    auto fd = open(parentPath.CStr(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return Error(errno);
+    }
+
+    Error err;
+
+    if (fsync(fd) != 0) {
+        err = errno;
+    }
+
+    if (close(fd) != 0 && err.IsNone()) {
+        err = errno;
+    }
+
+    return err;
+}
+
+#endif
 
 } // namespace
 
@@ -97,23 +173,157 @@ bool DirIterator::Next()
  * FileInfoProvider implementation
  **********************************************************************************************************************/
 
-Error FileInfoProvider::Init(crypto::HasherItf& hashProvider)
+Error FileInfoProvider::Init(crypto::HasherItf& hashProvider, Duration acquireTimeout)
 {
-    mHashProvider = &hashProvider;
+    LockGuard lock {mMutex};
+
+    mHashProvider   = &hashProvider;
+    mAcquireTimeout = acquireTimeout;
+    mMetrics        = {};
+
+    if (auto err = mBuffers.Resize(mBuffers.MaxSize()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    mFreeBuffers.Clear();
+
+    for (auto& buffer : mBuffers) {
+        if (auto err = mFreeBuffers.PushBack(&buffer); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
 
     return ErrorEnum::eNone;
 }
 
 Error FileInfoProvider::GetFileInfo(const String& path, FileInfo& info, crypto::Hash hashAlg)
 {
-    auto [size, err] = CalculateSize(path);
+    auto [buffer, err] = AcquireBuffer();
     if (!err.IsNone()) {
         return err;
     }
 
+    err = CalculateFileInfo(path, hashAlg, *buffer, info);
+
+    ReleaseBuffer(buffer);
+
+    return err;
+}
+
+FileInfoProviderMetrics FileInfoProvider::GetMetrics() const
+{
+    LockGuard lock {mMutex};
+
+    return mMetrics;
+}
+
+RetWithError<FileInfoProvider::ReadBuffer*> FileInfoProvider::AcquireBuffer()
+{
+    UniqueLock lock {mMutex};
+
+    mMetrics.mAcquires++;
+
+    if (!mFreeBuffers.IsEmpty()) {
+        auto buffer = mFreeBuffers.Back();
+
+        mFreeBuffers.PopBack();
+
+        return buffer;
+    }
+
+    mMetrics.mWaits++;
+
+    auto startTime = Time::Now();
+    auto err       = mCondVar.Wait(lock, mAcquireTimeout, [this] { return !mFreeBuffers.IsEmpty(); });
+    auto waitTime  = Time::Now().Sub(startTime);
+
+    mMetrics.mTotalWaitTime += waitTime;
+
+    if (waitTime > mMetrics.mMaxWaitTime) {
+        mMetrics.mMaxWaitTime = waitTime;
+    }
+
+    if (!err.IsNone()) {
+        mMetrics.mTimeouts++;
+
+        return {nullptr, AOS_ERROR_WRAP(err)};
+    }
+
+    auto buffer = mFreeBuffers.Back();
+
+    mFreeBuffers.PopBack();
+
+    return buffer;
+}
+
+void FileInfoProvider::ReleaseBuffer(ReadBuffer* buffer)
+{
+    {
+        LockGuard lock {mMutex};
+
+        mFreeBuffers.PushBack(buffer);
+    }
+
+    mCondVar.NotifyOne();
+}
+
+Error FileInfoProvider::CalculateFileInfo(const String& path, crypto::Hash hashAlg, ReadBuffer& buffer, FileInfo& info)
+{
+    struct stat st;
+
+    if (stat(path.CStr(), &st) != 0) {
+        return AOS_ERROR_WRAP(Error(errno));
+    }
+
+    if (!S_ISREG(st.st_mode)) {
+        auto [size, err] = CalculateSize(path);
+        if (!err.IsNone()) {
+            return err;
+        }
+
+        info.mSize = size;
+
+        return crypto::CalculateFileHash(path, hashAlg, *mHashProvider, buffer, info.mCheckSum);
+    }
+
+    auto [hasher, err] = mHashProvider->CreateHash(hashAlg);
+    if (!err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    File file;
+
+    if (err = file.Open(path, File::Mode::ReadSequential); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    // Size is counted while hashing, so the file is read once and size always matches hashed content.
+    size_t size = 0;
+
+    while (true) {
+        err = file.ReadBlock(buffer);
+        if (!err.IsNone() && !err.Is(ErrorEnum::eEOF)) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        if (buffer.IsEmpty()) {
+            break;
+        }
+
+        size += buffer.Size();
+
+        if (err = hasher->Update(buffer); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    if (err = hasher->Finalize(info.mCheckSum); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
     info.mSize = size;
 
-    return crypto::CalculateFileHash(path, hashAlg, *mHashProvider, info.mCheckSum);
+    return ErrorEnum::eNone;
 }
 
 /***********************************************************************************************************************
@@ -463,8 +673,11 @@ Error ReadLine(int fd, size_t pos, String& line, const String& delimiter)
     return line.Resize(eolPos);
 }
 
-Error WriteFile(const String& fileName, const Array<uint8_t>& data, uint32_t perm)
+Error WriteFile(const String& fileName, const Array<uint8_t>& data, uint32_t perm, Durability durability)
 {
+#ifdef __ZEPHYR__
+    (void)durability;
+
     // zephyr doesn't support O_TRUNC flag. This is WA to trunc file if it exists.
     auto err = Remove(fileName);
     if (!err.IsNone()) {
@@ -476,45 +689,65 @@ Error WriteFile(const String& fileName, const Array<uint8_t>& data, uint32_t per
         return Error(errno);
     }
 
-    size_t pos = 0;
-    while (pos < data.Size()) {
-        auto chunkSize = write(fd, data.Get() + pos, data.Size() - pos);
-        if (chunkSize < 0) {
-            err = errno;
+    if (err = WriteData(fd, data); !err.IsNone()) {
+        close(fd);
 
-            close(fd);
+        return err;
+    }
 
-            return Error(err);
-        }
+    if (close(fd) != 0) {
+        return Error(errno);
+    }
 
-        pos += chunkSize;
+    return ErrorEnum::eNone;
+#else
+    StaticString<cFilePathLen> tmpPath;
+
+    if (auto err = tmpPath.Format("%s.XXXXXX", fileName.CStr()); !err.IsNone()) {
+        return err;
     }
 
-    if (close(fd) != 0) {
+    auto fd = mkstemp(tmpPath.Get());
+    if (fd < 0) {
         return Error(errno);
     }
 
-// Zephyr doesn't implement chmod
-#ifndef __ZEPHYR__
-    if (chmod(fileName.CStr(), perm) != 0) {
+    // Temporary file is removed on any error until it is renamed over the target.
+    auto removeTmpFile = DeferRelease(&tmpPath, [](const String* path) { unlink(path->CStr()); });
+
+    auto err = WriteTmpFile(fd, data, perm, durability);
+
+    if (close(fd) != 0 && err.IsNone()) {
+        err = errno;
+    }
+
+    if (!err.IsNone()) {
+        return err;
+    }
+
+    if (rename(tmpPath.CStr(), fileName.CStr()) != 0) {
         return Error(errno);
     }
-#endif
+
+    removeTmpFile.Release();
+
+    if (durability == Durability::Full) {
+        return SyncParentDir(fileName);
+    }
 
     return ErrorEnum::eNone;
+#endif
 }
 
-Error WriteStringToFile(const String& fileName, const String& text, uint32_t perm)
+Error WriteStringToFile(const String& fileName, const String& text, uint32_t perm, Durability durability)
 {
     const auto buff = Array<uint8_t>(reinterpret_cast<const uint8_t*>(text.Get()), text.Size());
 
-    return WriteFile(fileName, buff, perm);
+    return WriteFile(fileName, buff, perm, durability);
 }
 
 RetWithError<size_t> CalculateSize(const String& path)
 {
-    LockGuard lock {sCalculateSizeMutex};
-
     struct stat st;
 
     if (auto ret = stat(path.CStr(), &st); ret != 0) {
@@ -525,6 +758,9 @@ RetWithError<size_t> CalculateSize(const String& path)
         return {static_cast<size_t>(st.st_size)};
     }
 
+    // Each directory walk owns its iterator stack, so walks only wait when all pooled stacks are in use.
+    LockGuard lock {sCalculateSizeSemaphore};
+
     size_t size         = 0;
     auto   dirIterators = MakeUnique<DirIteratorArray>(&sCalculateSizeAllocator);
 
@@ -581,24 +817,43 @@ Error File::Open(const String& path, Mode mode)
         return err;
     }
 
-    int flags = (mode == Mode::Read) ? O_RDONLY : (O_WRONLY | O_CREAT | O_TRUNC);
+    int flags = (mode == Mode::Write) ? (O_WRONLY | O_CREAT | O_TRUNC) : O_RDONLY;
 
     mFd = open(path.CStr(), flags, 0644);
     if (mFd < 0) {
         return Error(errno, "file open failed");
     }
 
+    mSequential = mode == Mode::ReadSequential;
+    mPos        = 0;
+    mDropPos    = 0;
+
+#ifndef __ZEPHYR__
+    // Read ahead is only a hint, so errors are ignored.
+    if (mSequential) {
+        posix_fadvise(mFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#endif
+
     return ErrorEnum::eNone;
 }
 
 Error File::Close()
 {
     if (mFd >= 0) {
+        auto err = Unmap();
+
+        DropCache(true);
+
         if (close(mFd) < 0) {
             return Error(errno, "file close failed");
         }
 
         mFd = -1;
+
+        if (!err.IsNone()) {
+            return err;
+        }
     }
 
     return ErrorEnum::eNone;
@@ -610,6 +865,10 @@ Error File::ReadBlock(Array<uint8_t>& buffer)
         return ErrorEnum::eWrongState;
     }
 
+    if (auto err = Unmap(); !err.IsNone()) {
+        return err;
+    }
+
     auto blockSize = buffer.MaxSize();
     buffer.Resize(blockSize);
 
@@ -630,6 +889,10 @@ Error File::ReadBlock(Array<uint8_t>& buffer)
 
     buffer.Resize(totalRead);
 
+    mPos += totalRead;
+
+    DropCache(false);
+
     return eof ? ErrorEnum::eEOF : ErrorEnum::eNone;
 }
 
@@ -654,6 +917,110 @@ Error File::WriteBlock(const Array<uint8_t>& buffer)
     return ErrorEnum::eNone;
 }
 
+Error File::MapBlock(size_t maxSize, Array<const uint8_t>& block)
+{
+#ifdef __ZEPHYR__
+    (void)maxSize;
+    (void)block;
+
+    return ErrorEnum::eNotSupported;
+#else
+    if (mFd < 0) {
+        return ErrorEnum::eWrongState;
+    }
+
+    if (maxSize == 0) {
+        return ErrorEnum::eInvalidArgument;
+    }
+
+    if (auto err = Unmap(); !err.IsNone()) {
+        return err;
+    }
+
+    DropCache(false);
+
+    block.Rebind(Array<const uint8_t>());
+
+    struct stat st;
+
+    if (fstat(mFd, &st) != 0) {
+        return Error(errno, "file stat failed");
+    }
+
+    auto fileSize = static_cast<size_t>(st.st_size);
+    if (mPos >= fileSize) {
+        return ErrorEnum::eEOF;
+    }
+
+    static const auto sPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    // Mapping offset should be page aligned, so the block starts inside the first mapped page. Pages are populated
+    // on mapping as faulting them one by one is much slower than reading.
+    auto pageOffset = mPos % sPageSize;
+    auto size       = Min(maxSize, fileSize - mPos);
+
+    auto data = mmap(nullptr, size + pageOffset, PROT_READ, MAP_PRIVATE | MAP_POPULATE, mFd, mPos - pageOffset);
+    if (data == MAP_FAILED) {
+        return Error(errno, "file map failed");
+    }
+
+    mMapData = data;
+    mMapSize = size + pageOffset;
+
+    block.Rebind(Array<const uint8_t>(static_cast<const uint8_t*>(mMapData) + pageOffset, size));
+
+    mPos += size;
+
+    // Block is populated on mapping, so start reading the next block in advance.
+    if (mSequential) {
+        posix_fadvise(mFd, mPos, maxSize, POSIX_FADV_WILLNEED);
+    }
+
+    // Keep file position in sync, so map and read calls can be mixed.
+    if (lseek(mFd, mPos, SEEK_SET) < 0) {
+        return Error(errno, "file seek failed");
+    }
+
+    return mPos == fileSize ? ErrorEnum::eEOF : ErrorEnum::eNone;
+#endif
+}
+
+Error File::Unmap()
+{
+#ifndef __ZEPHYR__
+    if (mMapData == nullptr) {
+        return ErrorEnum::eNone;
+    }
+
+    auto ret = munmap(mMapData, mMapSize);
+
+    mMapData = nullptr;
+    mMapSize = 0;
+
+    if (ret != 0) {
+        return Error(errno, "file unmap failed");
+    }
+#endif
+
+    return ErrorEnum::eNone;
+}
+
+void File::DropCache(bool force)
+{
+#ifdef __ZEPHYR__
+    (void)force;
+#else
+    if (!mSequential || mPos <= mDropPos || (!force && mPos - mDropPos < cFileDropCacheSize)) {
+        return;
+    }
+
+    // Dropping cache is only a hint, so errors are ignored.
+    posix_fadvise(mFd, mDropPos, mPos - mDropPos, POSIX_FADV_DONTNEED);
+
+    mDropPos = mPos;
+#endif
+}
+
 Error BaseName(const String& path, String& base)
 {
     if (auto err = base.Assign(path); !err.IsNone()) {
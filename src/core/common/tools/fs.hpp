@@ -17,6 +17,7 @@
 #include "config.hpp"
 #include "noncopyable.hpp"
 #include "string.hpp"
+#include "thread.hpp"
 
 namespace aos {
 
@@ -25,6 +26,41 @@ namespace aos {
  */
 constexpr auto cDirIteratorMaxSize = AOS_CONFIG_FS_DIR_ITERATOR_MAX_COUNT;
 
+/**
+ * Max number of directory size calculations running in parallel.
+ */
+constexpr auto cCalculateSizeMaxConcurrent = AOS_CONFIG_FS_CALCULATE_SIZE_MAX_CONCURRENT;
+
+/**
+ * Max number of file info calculations running in parallel.
+ */
+constexpr auto cFileInfoMaxConcurrent = AOS_CONFIG_FS_FILE_INFO_MAX_CONCURRENT;
+
+/**
+ * Max number of file hash calculations with pooled read buffer running in parallel.
+ */
+constexpr auto cFileHashMaxConcurrent = AOS_CONFIG_FS_FILE_HASH_MAX_CONCURRENT;
+
+/**
+ * Pooled file hash read buffer size.
+ */
+constexpr auto cHashBufferSize = AOS_CONFIG_FS_HASH_BUFFER_SIZE;
+
+/**
+ * Default time to wait for free file info hasher.
+ */
+constexpr auto cFileInfoAcquireTimeout = AOS_CONFIG_FS_FILE_INFO_ACQUIRE_TIMEOUT_SEC * Time::cSeconds;
+
+/**
+ * File map block size.
+ */
+constexpr auto cFileMapBlockSize = AOS_CONFIG_FS_FILE_MAP_BLOCK_SIZE;
+
+/**
+ * File drop cache size.
+ */
+constexpr auto cFileDropCacheSize = AOS_CONFIG_FS_FILE_DROP_CACHE_SIZE;
+
 namespace fs {
 /**
  * File system platform interface.
@@ -283,18 +319,35 @@ public:
     virtual Error GetFileInfo(const String& path, FileInfo& info, crypto::Hash hashAlg = crypto::HashEnum::eSHA256) = 0;
 };
 
+/**
+ * File info provider metrics.
+ */
+struct FileInfoProviderMetrics {
+    size_t   mAcquires {};
+    size_t   mWaits {};
+    size_t   mTimeouts {};
+    Duration mTotalWaitTime {};
+    Duration mMaxWaitTime {};
+};
+
 /**
  * File info provider implementation.
+ *
+ * At most cFileInfoMaxConcurrent files are hashed in parallel. Each calculation takes a hasher slot with its own read
+ * buffer from the pool, other callers wait for a free slot up to the acquire timeout. The pool bounds this provider's
+ * hashes only: the crypto provider hash allocator is shared, so hash creation may still fail if other users exhaust it.
+ * Size and hash of regular files are calculated in a single read pass.
  */
-class FileInfoProvider : public FileInfoProviderItf {
+class FileInfoProvider : public FileInfoProviderItf, private NonCopyable {
 public:
     /**
      * Initializes file info provider.
      *
      * @param hashProvider hash provider.
+     * @param acquireTimeout time to wait for free hasher.
      * @return Error.
      */
-    Error Init(crypto::HasherItf& hashProvider);
+    Error Init(crypto::HasherItf& hashProvider, Duration acquireTimeout = cFileInfoAcquireTimeout);
 
     /**
      * Gets file info.
@@ -305,8 +358,28 @@ public:
      */
     Error GetFileInfo(const String& path, FileInfo& info, crypto::Hash hashAlg = crypto::HashEnum::eSHA256) override;
 
+    /**
+     * Returns hasher pool metrics.
+     *
+     * @return FileInfoProviderMetrics.
+     */
+    FileInfoProviderMetrics GetMetrics() const;
+
 private:
-    crypto::HasherItf* mHashProvider {};
+    using ReadBuffer = StaticArray<uint8_t, cHashBufferSize>;
+
+    RetWithError<ReadBuffer*> AcquireBuffer();
+    void                      ReleaseBuffer(ReadBuffer* buffer);
+
+    Error CalculateFileInfo(const String& path, crypto::Hash hashAlg, ReadBuffer& buffer, FileInfo& info);
+
+    crypto::HasherItf*                               mHashProvider {};
+    Duration                                         mAcquireTimeout {};
+    mutable Mutex                                    mMutex;
+    ConditionalVariable                              mCondVar;
+    StaticArray<ReadBuffer, cFileInfoMaxConcurrent>  mBuffers;
+    StaticArray<ReadBuffer*, cFileInfoMaxConcurrent> mFreeBuffers;
+    FileInfoProviderMetrics                          mMetrics;
 };
 
 using DirIteratorArray = StaticArray<DirIterator, cDirIteratorMaxSize>;
@@ -451,15 +524,29 @@ Error ReadFileToString(const String& fileName, String& text);
  */
 Error ReadLine(int fd, size_t pos, String& line, const String& delimiter = "\n\0");
 
+/**
+ * File write durability level.
+ *
+ * None - file is replaced atomically but may be lost on power failure, default;
+ * Data - file data is flushed to the storage before the file is replaced;
+ * Full - as Data and the parent directory is flushed after the file is replaced.
+ */
+enum class Durability { None, Data, Full };
+
 /**
  * Overwrites file with a specified data.
  *
+ * On Linux the data is written to a temporary file in the same directory which is then renamed over the target, so
+ * readers never observe partially written file.
+ *
  * @param fileName file name.
  * @param data input data.
  * @param perm permissions.
+ * @param durability durability level.
  * @return Error.
  */
-Error WriteFile(const String& fileName, const Array<uint8_t>& data, uint32_t perm);
+Error WriteFile(
+    const String& fileName, const Array<uint8_t>& data, uint32_t perm, Durability durability = Durability::None);
 
 /**
  * Overwrites file with a specified text.
@@ -467,9 +554,11 @@ Error WriteFile(const String& fileName, const Array<uint8_t>& data, uint32_t per
  * @param fileName file name.
  * @param text input text.
  * @param perm permissions.
+ * @param durability durability level.
  * @return Error.
  */
-Error WriteStringToFile(const String& fileName, const String& text, uint32_t perm);
+Error WriteStringToFile(
+    const String& fileName, const String& text, uint32_t perm, Durability durability = Durability::None);
 
 /**
  * Calculates size of the file or directory.
@@ -486,8 +575,11 @@ class File {
 public:
     /**
      * File open mode.
+     *
+     * ReadSequential hints the kernel to read ahead and drops already read data from the page cache, so streaming
+     * large files doesn't evict cached data of other users.
      */
-    enum class Mode { Read, Write };
+    enum class Mode { Read, ReadSequential, Write };
 
     /**
      * Destructor.
@@ -526,8 +618,28 @@ public:
      */
     Error WriteBlock(const Array<uint8_t>& buffer);
 
+    /**
+     * Maps next block of the file into memory.
+     *
+     * The block is rebound to the read-only mapped data which stays valid until the next read, map or close call.
+     * Returns eEOF when the end of file is reached and eNotSupported if the platform doesn't support file mapping.
+     *
+     * @param maxSize max block size.
+     * @param[out] block mapped block.
+     * @return Error.
+     */
+    Error MapBlock(size_t maxSize, Array<const uint8_t>& block);
+
 private:
-    int mFd = -1;
+    Error Unmap();
+    void  DropCache(bool force);
+
+    int    mFd = -1;
+    bool   mSequential {};
+    size_t mPos {};
+    size_t mDropPos {};
+    void*  mMapData {};
+    size_t mMapSize {};
 };
 
 /**
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_COMMON_TOOLS_HASHINDEX_HPP_
+#define AOS_CORE_COMMON_TOOLS_HASHINDEX_HPP_
+
+#include <stdint.h>
+
+#include "error.hpp"
+#include "string.hpp"
+
+namespace aos {
+
+/**
+ * FNV-1a offset basis.
+ */
+constexpr uint64_t cFNVOffsetBasis = 14695981039346656037ULL;
+
+/**
+ * Calculates FNV-1a hash of data.
+ *
+ * @param data data.
+ * @param size data size.
+ * @param hash initial hash, used to combine hashes of several values.
+ * @return uint64_t.
+ */
+inline uint64_t FNVHash(const void* data, size_t size, uint64_t hash = cFNVOffsetBasis)
+{
+    constexpr uint64_t cFNVPrime = 1099511628211ULL;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<const uint8_t*>(data)[i];
+        hash *= cFNVPrime;
+    }
+
+    return hash;
+}
+
+/**
+ * Calculates FNV-1a hash of string.
+ *
+ * @param str string.
+ * @param hash initial hash, used to combine hashes of several values.
+ * @return uint64_t.
+ */
+inline uint64_t FNVHash(const String& str, uint64_t hash = cFNVOffsetBasis)
+{
+    return FNVHash(str.CStr(), str.Size(), hash);
+}
+
+/**
+ * Fixed-capacity hashed index.
+ *
+ * Maps key hashes to positions of items stored in an external container. The index doesn't keep keys: lookups take a
+ * match functor which compares the key with the item at candidate position, so hash collisions are resolved by the
+ * owner. The index uses open addressing with linear probing and has twice more entries than items, so probe chains
+ * stay short. Positions are not updated when the external container shifts its items: the owner should rebuild the
+ * index in this case.
+ *
+ * @tparam cMaxSize max number of indexed items.
+ */
+template <size_t cMaxSize>
+class HashIndex {
+public:
+    /**
+     * Adds item position to index.
+     *
+     * @param hash item key hash.
+     * @param position item position.
+     * @return Error.
+     */
+    Error Add(uint64_t hash, size_t position)
+    {
+        if (mSize >= cMaxSize || position >= cMaxSize) {
+            return ErrorEnum::eNoMemory;
+        }
+
+        // Index has more entries than items, so a free entry is always found.
+        for (auto i = Home(hash);; i = Next(i)) {
+            if (mEntries[i].mPosition == 0) {
+                mEntries[i] = {static_cast<uint32_t>(hash), static_cast<uint32_t>(position + 1)};
+                mSize++;
+
+                return ErrorEnum::eNone;
+            }
+        }
+    }
+
+    /**
+     * Finds item position.
+     *
+     * @param hash item key hash.
+     * @param match functor called with candidate position, returns true if item at position has the key.
+     * @return RetWithError<size_t>.
+     */
+    template <typename Match>
+    RetWithError<size_t> Find(uint64_t hash, Match match) const
+    {
+        for (auto i = Home(hash); mEntries[i].mPosition != 0; i = Next(i)) {
+            if (mEntries[i].mHash == static_cast<uint32_t>(hash) && match(mEntries[i].mPosition - 1)) {
+                return mEntries[i].mPosition - 1;
+            }
+        }
+
+        return {0, ErrorEnum::eNotFound};
+    }
+
+    /**
+     * Removes all positions from index.
+     */
+    void Clear()
+    {
+        for (auto& entry : mEntries) {
+            entry = {};
+        }
+
+        mSize = 0;
+    }
+
+    /**
+     * Returns number of indexed items.
+     *
+     * @return size_t.
+     */
+    size_t Size() const { return mSize; }
+
+private:
+    static constexpr size_t cNumEntries = 2 * cMaxSize;
+
+    static_assert(cMaxSize < UINT32_MAX, "too many items");
+
+    // Entry keeps position + 1, 0 is empty entry.
+    struct Entry {
+        uint32_t mHash {};
+        uint32_t mPosition {};
+    };
+
+    static size_t Home(uint64_t hash) { return static_cast<size_t>(hash % cNumEntries); }
+    static size_t Next(size_t i) { return (i + 1) % cNumEntries; }
+
+    Entry  mEntries[cNumEntries] {};
+    size_t mSize {};
+};
+
+} // namespace aos
+
+#endif
@@ -450,7 +450,7 @@ public:
             return ErrorEnum::eNotFound;
         }
 
-        RemoveNode(*this->mTerminalNode.mPrev);
+        this->RemoveNode(*this->mTerminalNode.mPrev);
 
         return ErrorEnum::eNone;
     }
@@ -466,7 +466,7 @@ public:
             return ErrorEnum::eNotFound;
         }
 
-        RemoveNode(*this->mTerminalNode.mNext);
+        this->RemoveNode(*this->mTerminalNode.mNext);
 
         return ErrorEnum::eNone;
     }
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "log.hpp"
+#include "thread.hpp"
+
+namespace aos {
+
+namespace {
+
+/***********************************************************************************************************************
+ * Static
+ **********************************************************************************************************************/
+
+Mutex& GetLevelsMutex()
+{
+    static Mutex sMutex;
+
+    return sMutex;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Public
+ **********************************************************************************************************************/
+
+void Log::SetLevel(LogLevel level)
+{
+    LockGuard lock {GetLevelsMutex()};
+
+    GetLevels().mDefaultLevel = static_cast<int>(level.GetValue());
+}
+
+Error Log::SetModuleLevel(const String& module, LogLevel level)
+{
+    LockGuard lock {GetLevelsMutex()};
+
+    auto moduleLevel = AddModuleLevel(module);
+    if (!moduleLevel) {
+        return ErrorEnum::eNoMemory;
+    }
+
+    moduleLevel->mLevel = static_cast<int>(level.GetValue());
+
+    return ErrorEnum::eNone;
+}
+
+void Log::ResetLevels()
+{
+    LockGuard lock {GetLevelsMutex()};
+
+    auto& levels = GetLevels();
+
+    levels.mDefaultLevel = static_cast<int>(LogLevelEnum::eDebug);
+
+    for (size_t i = 0; i < levels.mNumModules; i++) {
+        levels.mModules[i].mLevel = cInheritLevel;
+    }
+}
+
+const Log::ModuleLevel* Log::GetModuleLevel(const char* module)
+{
+    LockGuard lock {GetLevelsMutex()};
+
+    return AddModuleLevel(module);
+}
+
+/***********************************************************************************************************************
+ * Private
+ **********************************************************************************************************************/
+
+Log::ModuleLevel* Log::AddModuleLevel(const String& module)
+{
+    auto& levels = GetLevels();
+
+    for (size_t i = 0; i < levels.mNumModules; i++) {
+        if (levels.mModules[i].mModule == module) {
+            return &levels.mModules[i];
+        }
+    }
+
+    if (levels.mNumModules >= cMaxNumModules) {
+        return nullptr;
+    }
+
+    auto& moduleLevel = levels.mModules[levels.mNumModules];
+
+    if (!moduleLevel.mModule.Assign(module).IsNone()) {
+        return nullptr;
+    }
+
+    moduleLevel.mLevel = cInheritLevel;
+    levels.mNumModules++;
+
+    return &moduleLevel;
+}
+
+} // namespace aos
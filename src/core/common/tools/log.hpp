@@ -13,11 +13,26 @@
 #include "error.hpp"
 #include "noncopyable.hpp"
 #include "utils.hpp"
+
+/**
+ * Helper macro to display log if log level is enabled for module at runtime.
+ */
+#define LOG_MODULE_IF_ENABLED(module, level)                                                                           \
+    !aos::Log::IsEnabled(                                                                                              \
+        []() {                                                                                                         \
+            static const auto* sModuleLevel = aos::Log::GetModuleLevel(module);                                       \
+                                                                                                                       \
+            return sModuleLevel;                                                                                       \
+        }(),                                                                                                           \
+        level)                                                                                                         \
+        ? (void)0                                                                                                      \
+        : aos::LogVoid() & aos::Log(module, level)
+
 /**
  * Helper macro to display debug log.
  */
 #if AOS_CONFIG_LOG_LEVEL >= AOS_CONFIG_LOG_LEVEL_DEBUG
-#define LOG_MODULE_DBG(module) aos::Log(module, aos::LogLevelEnum::eDebug)
+#define LOG_MODULE_DBG(module) LOG_MODULE_IF_ENABLED(module, aos::LogLevelEnum::eDebug)
 #else
 #define LOG_MODULE_DBG(module) true ? (void)0 : aos::LogVoid() & aos::Log(module, aos::LogLevelEnum::eDebug)
 #endif
@@ -26,7 +41,7 @@
  * Helper macro to display info log.
  */
 #if AOS_CONFIG_LOG_LEVEL >= AOS_CONFIG_LOG_LEVEL_INFO
-#define LOG_MODULE_INF(module) aos::Log(module, aos::LogLevelEnum::eInfo)
+#define LOG_MODULE_INF(module) LOG_MODULE_IF_ENABLED(module, aos::LogLevelEnum::eInfo)
 #else
 #define LOG_MODULE_INF(module) true ? (void)0 : aos::LogVoid() & Log(module, aos::LogLevelEnum::eInfo)
 #endif
@@ -35,7 +50,7 @@
  * Helper macro to display warning log.
  */
 #if AOS_CONFIG_LOG_LEVEL >= AOS_CONFIG_LOG_LEVEL_WARNING
-#define LOG_MODULE_WRN(module) aos::Log(module, aos::LogLevelEnum::eWarning)
+#define LOG_MODULE_WRN(module) LOG_MODULE_IF_ENABLED(module, aos::LogLevelEnum::eWarning)
 #else
 #define LOG_MODULE_WRN(module) true ? (void)0 : aos::LogVoid() & Log(module, aos::LogLevelEnum::eWarning)
 #endif
@@ -44,7 +59,7 @@
  * Helper macro to display error log.
  */
 #if AOS_CONFIG_LOG_LEVEL >= AOS_CONFIG_LOG_LEVEL_ERROR
-#define LOG_MODULE_ERR(module) aos::Log(module, aos::LogLevelEnum::eError)
+#define LOG_MODULE_ERR(module) LOG_MODULE_IF_ENABLED(module, aos::LogLevelEnum::eError)
 #else
 #define LOG_MODULE_ERR(module) true ? (void)0 : aos::LogVoid() & Log(module, aos::LogLevelEnum::eError)
 #endif
@@ -84,6 +99,11 @@ public:
      */
     static size_t constexpr cMaxLineLen = AOS_CONFIG_LOG_LINE_LEN;
 
+    /**
+     * Max log module name length.
+     */
+    static size_t constexpr cModuleLen = AOS_CONFIG_LOG_MODULE_LEN;
+
     /**
      * Field entry structure for field-based logging
      */
@@ -132,8 +152,84 @@ public:
      * Sets application log callback.
      *
      * @param callback
+     * @return LogCallback previously installed callback.
      */
-    static void SetCallback(LogCallback callback) { GetCallback() = callback; }
+    static LogCallback SetCallback(LogCallback callback)
+    {
+        auto prevCallback = GetCallback();
+
+        GetCallback() = callback;
+
+        return prevCallback;
+    }
+
+    /**
+     * Runtime log level of module.
+     */
+    struct ModuleLevel {
+        StaticString<cModuleLen> mModule;
+        int                      mLevel = cInheritLevel;
+    };
+
+    /**
+     * Sets runtime log level for modules without own log level.
+     *
+     * @param level log level.
+     */
+    static void SetLevel(LogLevel level);
+
+    /**
+     * Sets runtime log level for module.
+     *
+     * @param module log module.
+     * @param level log level.
+     * @return Error.
+     */
+    static Error SetModuleLevel(const String& module, LogLevel level);
+
+    /**
+     * Resets runtime log levels: all modules use debug level.
+     */
+    static void ResetLevels();
+
+    /**
+     * Returns runtime log level of module. Module is added to the module table if it is not there yet.
+     *
+     * Returned level stays valid and reflects further level changes, so log macros resolve it once per call site.
+     *
+     * @param module log module.
+     * @return const ModuleLevel*. nullptr if module table is full, default level is used in this case.
+     */
+    static const ModuleLevel* GetModuleLevel(const char* module);
+
+    /**
+     * Checks if log level is enabled for module level at runtime.
+     *
+     * Levels are read without lock: a level change is applied to a log line which is checked concurrently either way.
+     *
+     * @param moduleLevel module level.
+     * @param level log level.
+     * @return bool.
+     */
+    static bool IsEnabled(const ModuleLevel* moduleLevel, LogLevelEnum level)
+    {
+        auto value = static_cast<int>(level);
+
+        if (moduleLevel && moduleLevel->mLevel != cInheritLevel) {
+            return value >= moduleLevel->mLevel;
+        }
+
+        return value >= GetLevels().mDefaultLevel;
+    }
+
+    /**
+     * Checks if log level is enabled for module at runtime.
+     *
+     * @param module log module.
+     * @param level log level.
+     * @return bool.
+     */
+    static bool IsEnabled(const char* module, LogLevelEnum level) { return IsEnabled(GetModuleLevel(module), level); }
 
     /**
      * Returns FieldEntry (key-value pair).
@@ -232,6 +328,24 @@ public:
     }
 
 private:
+    static constexpr size_t cMaxNumModules = AOS_CONFIG_LOG_MAX_NUM_MODULES;
+    static constexpr int    cInheritLevel  = -1;
+
+    struct Levels {
+        int         mDefaultLevel = static_cast<int>(LogLevelEnum::eDebug);
+        size_t      mNumModules   = 0;
+        ModuleLevel mModules[cMaxNumModules];
+    };
+
+    static Levels& GetLevels()
+    {
+        static Levels sLevels;
+
+        return sLevels;
+    }
+
+    static ModuleLevel* AddModuleLevel(const String& module);
+
     static LogCallback& GetCallback()
     {
         static LogCallback sLogCallback = nullptr;
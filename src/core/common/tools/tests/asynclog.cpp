@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <core/common/tools/asynclog.hpp>
+#include <core/common/tools/logger.hpp>
+
+using namespace aos;
+
+namespace {
+
+/***********************************************************************************************************************
+ * Types
+ **********************************************************************************************************************/
+
+struct LogRecord {
+    std::string mModule;
+    LogLevel    mLevel;
+    std::string mMessage;
+};
+
+/***********************************************************************************************************************
+ * Vars
+ **********************************************************************************************************************/
+
+std::mutex                sMutex;
+std::vector<LogRecord>    sRecords;
+std::thread::id           sSinkThreadID;
+std::chrono::microseconds sSinkDelay {};
+
+/***********************************************************************************************************************
+ * Utils
+ **********************************************************************************************************************/
+
+void LogSink(const String& module, LogLevel level, const Time& time, const String& message)
+{
+    (void)time;
+
+    std::this_thread::sleep_for(sSinkDelay);
+
+    std::lock_guard lock {sMutex};
+
+    sSinkThreadID = std::this_thread::get_id();
+    sRecords.push_back({module.CStr(), level, message.CStr()});
+}
+
+std::atomic<size_t> sPrevCallbackCount {};
+
+void PrevLogCallback(const String& module, LogLevel level, const String& message)
+{
+    (void)module;
+    (void)level;
+    (void)message;
+
+    sPrevCallbackCount++;
+}
+
+} // namespace
+
+/***********************************************************************************************************************
+ * Suite
+ **********************************************************************************************************************/
+
+class AsyncLogTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        sRecords.clear();
+        sSinkThreadID = {};
+        sSinkDelay    = {};
+
+        sPrevCallbackCount = 0;
+    }
+};
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+TEST_F(AsyncLogTest, LogIsPassedToSinkOnConsumerThread)
+{
+    AsyncLog asyncLog;
+
+    ASSERT_TRUE(asyncLog.Start(LogSink).IsNone());
+
+    LOG_DBG() << "Debug log";
+    LOG_INF() << "Info log" << Log::Field("value", 1);
+    LOG_ERR() << "Error log";
+
+    ASSERT_TRUE(asyncLog.Stop().IsNone());
+
+    std::lock_guard lock {sMutex};
+
+    ASSERT_EQ(sRecords.size(), 3);
+
+    EXPECT_EQ(sRecords[0].mModule, "tools_test");
+    EXPECT_EQ(sRecords[0].mLevel, LogLevelEnum::eDebug);
+    EXPECT_EQ(sRecords[0].mMessage, "Debug log");
+    EXPECT_EQ(sRecords[1].mLevel, LogLevelEnum::eInfo);
+    EXPECT_EQ(sRecords[1].mMessage, "Info log: value=1");
+    EXPECT_EQ(sRecords[2].mLevel, LogLevelEnum::eError);
+    EXPECT_EQ(sRecords[2].mMessage, "Error log");
+
+    EXPECT_NE(sSinkThreadID, std::this_thread::get_id());
+    EXPECT_EQ(asyncLog.GetDroppedCount(), 0);
+}
+
+TEST_F(AsyncLogTest, StartTwice)
+{
+    AsyncLog asyncLog1, asyncLog2;
+
+    ASSERT_TRUE(asyncLog1.Start(LogSink).IsNone());
+    EXPECT_FALSE(asyncLog2.Start(LogSink).IsNone());
+
+    ASSERT_TRUE(asyncLog1.Stop().IsNone());
+    ASSERT_TRUE(asyncLog2.Start(LogSink).IsNone());
+    ASSERT_TRUE(asyncLog2.Stop().IsNone());
+}
+
+TEST_F(AsyncLogTest, RecordsAreDroppedWhenQueueIsFull)
+{
+    constexpr auto cNumThreads = 4;
+    constexpr auto cNumRecords = cAsyncLogQueueSize * 2;
+
+    AsyncLog asyncLog;
+
+    sSinkDelay = std::chrono::milliseconds(1);
+
+    ASSERT_TRUE(asyncLog.Start(LogSink).IsNone());
+
+    std::vector<std::thread> threads;
+
+    for (auto i = 0; i < cNumThreads; i++) {
+        threads.emplace_back([]() {
+            for (size_t j = 0; j < cNumRecords; j++) {
+                LOG_DBG() << "Record";
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(asyncLog.Stop().IsNone());
+
+    auto droppedCount = asyncLog.GetDroppedCount();
+
+    EXPECT_GT(droppedCount, 0);
+
+    std::lock_guard lock {sMutex};
+
+    size_t numRecords = 0, reportedCount = 0;
+
+    for (const auto& record : sRecords) {
+        if (record.mModule == "asynclog") {
+            EXPECT_EQ(record.mLevel, LogLevelEnum::eWarning);
+
+            reportedCount += std::stoul(record.mMessage.substr(record.mMessage.find('=') + 1));
+
+            continue;
+        }
+
+        numRecords++;
+    }
+
+    EXPECT_EQ(numRecords + droppedCount, cNumThreads * cNumRecords);
+    EXPECT_EQ(reportedCount, droppedCount);
+}
+
+TEST_F(AsyncLogTest, PrevCallbackIsRestoredOnStop)
+{
+    auto prevCallback = Log::SetCallback(PrevLogCallback);
+
+    AsyncLog asyncLog;
+
+    ASSERT_TRUE(asyncLog.Start(LogSink).IsNone());
+
+    LOG_DBG() << "Async record";
+
+    ASSERT_TRUE(asyncLog.Stop().IsNone());
+
+    EXPECT_EQ(sPrevCallbackCount, 0);
+
+    LOG_DBG() << "Sync record";
+
+    EXPECT_EQ(sPrevCallbackCount, 1);
+
+    EXPECT_EQ(Log::SetCallback(prevCallback), PrevLogCallback);
+
+    std::lock_guard lock {sMutex};
+
+    ASSERT_EQ(sRecords.size(), 1);
+    EXPECT_EQ(sRecords[0].mMessage, "Async record");
+}
+
+TEST_F(AsyncLogTest, StopWhileLogging)
+{
+    constexpr auto cNumThreads    = 4;
+    constexpr auto cNumIterations = 20;
+
+    for (auto i = 0; i < cNumIterations; i++) {
+        auto             asyncLog = std::make_unique<AsyncLog>();
+        std::atomic_bool stop {};
+
+        ASSERT_TRUE(asyncLog->Start(LogSink).IsNone());
+
+        std::vector<std::thread> threads;
+
+        for (auto j = 0; j < cNumThreads; j++) {
+            threads.emplace_back([&stop]() {
+                while (!stop) {
+                    LOG_DBG() << "Record";
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        ASSERT_TRUE(asyncLog->Stop().IsNone());
+
+        size_t numRecords = 0;
+
+        {
+            std::lock_guard lock {sMutex};
+
+            numRecords = sRecords.size();
+        }
+
+        // Records pushed by writers active during stop are processed before Stop returns, nothing is passed to the
+        // sink afterwards.
+        asyncLog.reset();
+
+        stop = true;
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        std::lock_guard lock {sMutex};
+
+        EXPECT_EQ(sRecords.size(), numRecords);
+
+        sRecords.clear();
+    }
+}
@@ -5,10 +5,19 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <stdio.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -43,6 +52,121 @@ static void CheckFile(const char* path, const char* text, const size_t permissio
         << "Wrong permissions for file: " << path;
 }
 
+// Hasher which sums input bytes. Updates block while the hasher is held, so tests can occupy all pool slots.
+class SumHasher : public crypto::HasherItf {
+public:
+    RetWithError<UniquePtr<crypto::HashItf>> CreateHash(crypto::Hash algorithm) override
+    {
+        (void)algorithm;
+
+        std::lock_guard lock {mMutex};
+
+        auto hash = MakeUnique<SumHash>(&mAllocator, *this);
+        if (!hash) {
+            return {nullptr, ErrorEnum::eNoMemory};
+        }
+
+        mNumHashes++;
+        mMaxNumHashes = std::max(mMaxNumHashes, mNumHashes);
+        mCondVar.notify_all();
+
+        return {UniquePtr<crypto::HashItf>(Move(hash))};
+    }
+
+    void Hold()
+    {
+        std::lock_guard lock {mMutex};
+
+        mHold = true;
+    }
+
+    void Release()
+    {
+        std::lock_guard lock {mMutex};
+
+        mHold = false;
+        mCondVar.notify_all();
+    }
+
+    bool WaitNumHashes(size_t numHashes)
+    {
+        std::unique_lock lock {mMutex};
+
+        return mCondVar.wait_for(lock, std::chrono::seconds(5), [&] { return mNumHashes == numHashes; });
+    }
+
+    size_t GetMaxNumHashes()
+    {
+        std::lock_guard lock {mMutex};
+
+        return mMaxNumHashes;
+    }
+
+private:
+    static constexpr auto cMaxNumHashes = 2 * cFileInfoMaxConcurrent;
+
+    class SumHash : public crypto::HashItf {
+    public:
+        explicit SumHash(SumHasher& hasher)
+            : mHasher(hasher)
+        {
+        }
+
+        ~SumHash()
+        {
+            std::lock_guard lock {mHasher.mMutex};
+
+            mHasher.mNumHashes--;
+            mHasher.mCondVar.notify_all();
+        }
+
+        Error Update(const Array<uint8_t>& data) override
+        {
+            {
+                std::unique_lock lock {mHasher.mMutex};
+
+                mHasher.mCondVar.wait(lock, [this] { return !mHasher.mHold; });
+            }
+
+            for (const auto& item : data) {
+                mSum += item;
+            }
+
+            return ErrorEnum::eNone;
+        }
+
+        Error Finalize(Array<uint8_t>& hash) override
+        {
+            return hash.Assign(Array<uint8_t>(reinterpret_cast<const uint8_t*>(&mSum), sizeof(mSum)));
+        }
+
+    private:
+        SumHasher& mHasher;
+        uint64_t   mSum = 0;
+    };
+
+    StaticAllocator<sizeof(SumHash) * cMaxNumHashes, cMaxNumHashes> mAllocator;
+    std::mutex                                                      mMutex;
+    std::condition_variable                                         mCondVar;
+    size_t                                                          mNumHashes    = 0;
+    size_t                                                          mMaxNumHashes = 0;
+    bool                                                            mHold         = false;
+};
+
+static StaticArray<uint8_t, sizeof(uint64_t)> SumHash(const std::string& text)
+{
+    uint64_t                               sum = 0;
+    StaticArray<uint8_t, sizeof(uint64_t)> hash;
+
+    for (const auto& item : text) {
+        sum += static_cast<uint8_t>(item);
+    }
+
+    hash.Assign(Array<uint8_t>(reinterpret_cast<const uint8_t*>(&sum), sizeof(sum)));
+
+    return hash;
+}
+
 class FSTest : public Test {
 private:
     void SetUp() override
@@ -385,6 +509,97 @@ TEST_F(FSTest, WriteFile)
     fs::RemoveAll(existingFile.c_str());
 }
 
+TEST_F(FSTest, WriteFileDurability)
+{
+    const auto file = cBaseTestDir / "write-file-durability.txt";
+
+    const char           text[] = "Hello World";
+    const Array<uint8_t> data {reinterpret_cast<const uint8_t*>(text), strlen(text)};
+
+    for (auto durability : {fs::Durability::None, fs::Durability::Data, fs::Durability::Full}) {
+        fs::RemoveAll(file.c_str());
+
+        EXPECT_TRUE(fs::WriteFile(file.c_str(), data, 0600, durability).IsNone());
+        CheckFile(file.c_str(), text, 0600);
+    }
+
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(cBaseTestDir), {}), 1);
+}
+
+TEST_F(FSTest, WriteFileFailureKeepsTarget)
+{
+    const auto dirTarget = cBaseTestDir / "write-file-dir-target";
+
+    fs::MakeDirAll(dirTarget.c_str());
+    CreateFile((dirTarget / "file.txt").c_str());
+
+    const char           text[] = "Hello World";
+    const Array<uint8_t> data {reinterpret_cast<const uint8_t*>(text), strlen(text)};
+
+    EXPECT_FALSE(fs::WriteFile(dirTarget.c_str(), data, 0664).IsNone());
+    EXPECT_FALSE(fs::WriteFile((cBaseTestDir / "not-exist" / "file.txt").c_str(), data, 0664).IsNone());
+
+    // Write error: data exceeds file size limit.
+    rlimit prevLimit {};
+
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &prevLimit), 0);
+
+    auto prevHandler = signal(SIGXFSZ, SIG_IGN);
+    auto limit       = rlimit {4, prevLimit.rlim_max};
+
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+
+    EXPECT_FALSE(fs::WriteFile((cBaseTestDir / "file.txt").c_str(), data, 0664).IsNone());
+
+    setrlimit(RLIMIT_FSIZE, &prevLimit);
+    signal(SIGXFSZ, prevHandler);
+
+    // Target is not changed and temporary file is removed.
+    EXPECT_TRUE(std::filesystem::is_directory(dirTarget));
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(cBaseTestDir), {}), 1);
+}
+
+TEST_F(FSTest, WriteFileCrash)
+{
+    constexpr auto cNumIterations = 20;
+
+    const auto file = cBaseTestDir / "write-file-crash.bin";
+
+    // Contents differ both in data and size, so any torn write is detected.
+    const std::vector<uint8_t> contentA(1024 * 1024, 'a');
+    const std::vector<uint8_t> contentB(512 * 1024 + 17, 'b');
+
+    ASSERT_TRUE(fs::WriteFile(file.c_str(), Array<uint8_t>(contentA.data(), contentA.size()), 0644).IsNone());
+
+    for (auto i = 0; i < cNumIterations; i++) {
+        auto pid = fork();
+        ASSERT_GE(pid, 0);
+
+        if (pid == 0) {
+            for (size_t j = 0;; j++) {
+                const auto& content = (j % 2 == 0) ? contentB : contentA;
+
+                fs::WriteFile(file.c_str(), Array<uint8_t>(content.data(), content.size()), 0644,
+                    fs::Durability::None);
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1 + i % 5));
+
+        ASSERT_EQ(kill(pid, SIGKILL), 0);
+        ASSERT_EQ(waitpid(pid, nullptr, 0), pid);
+
+        std::vector<uint8_t> result(contentA.size());
+        Array<uint8_t>       buffer(result.data(), result.size());
+
+        ASSERT_TRUE(fs::ReadFile(file.c_str(), buffer).IsNone());
+
+        result.resize(buffer.Size());
+
+        EXPECT_TRUE(result == contentA || result == contentB) << "Torn file at iteration " << i;
+    }
+}
+
 TEST_F(FSTest, WriteStringToFile)
 {
     const auto newFile      = cBaseTestDir / "write-file-to-string-new.txt";
@@ -504,6 +719,235 @@ TEST_F(FSTest, CalculateNoMemory)
     EXPECT_EQ(fs::CalculateSize(walkDirRoot.c_str()), RetWithError<size_t>(cExpectedSize));
 }
 
+TEST_F(FSTest, FileInfoProvider)
+{
+    const auto file    = cBaseTestDir / "file-info.txt";
+    const auto dir     = cBaseTestDir / "file-info-dir";
+    const auto content = std::string(2 * cHashBufferSize + 5, 'a');
+
+    CreateFile(file.c_str(), content.c_str());
+    ASSERT_TRUE(fs::MakeDirAll(dir.c_str()).IsNone());
+
+    SumHasher    hasher;
+    auto         provider = std::make_unique<fs::FileInfoProvider>();
+    fs::FileInfo info;
+
+    ASSERT_TRUE(provider->Init(hasher).IsNone());
+
+    ASSERT_TRUE(provider->GetFileInfo(file.c_str(), info).IsNone());
+    EXPECT_EQ(info.mSize, content.size());
+    EXPECT_EQ(info.mCheckSum, SumHash(content));
+
+    EXPECT_FALSE(provider->GetFileInfo((cBaseTestDir / "does-not-exist").c_str(), info).IsNone());
+    EXPECT_FALSE(provider->GetFileInfo(dir.c_str(), info).IsNone());
+
+    auto metrics = provider->GetMetrics();
+
+    EXPECT_EQ(metrics.mAcquires, 3);
+    EXPECT_EQ(metrics.mWaits, 0);
+    EXPECT_EQ(metrics.mTimeouts, 0);
+    EXPECT_EQ(hasher.GetMaxNumHashes(), 1);
+}
+
+TEST_F(FSTest, FileInfoProviderWaitsForFreeHasher)
+{
+    constexpr auto cNumCallers = cFileInfoMaxConcurrent + 2;
+
+    const auto content = std::string(1024, 'b');
+
+    std::vector<std::string> files;
+
+    for (size_t i = 0; i < cNumCallers; i++) {
+        files.push_back((cBaseTestDir / ("file-info-" + std::to_string(i) + ".txt")).string());
+
+        CreateFile(files.back().c_str(), content.c_str());
+    }
+
+    SumHasher hasher;
+    auto      provider = std::make_unique<fs::FileInfoProvider>();
+
+    ASSERT_TRUE(provider->Init(hasher).IsNone());
+
+    hasher.Hold();
+
+    std::vector<Error>        errors(cNumCallers);
+    std::vector<fs::FileInfo> infos(cNumCallers);
+    std::vector<std::thread>  threads;
+
+    for (size_t i = 0; i < cNumCallers; i++) {
+        threads.emplace_back([&, i]() { errors[i] = provider->GetFileInfo(files[i].c_str(), infos[i]); });
+    }
+
+    EXPECT_TRUE(hasher.WaitNumHashes(cFileInfoMaxConcurrent));
+
+    while (provider->GetMetrics().mWaits != cNumCallers - cFileInfoMaxConcurrent) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    hasher.Release();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < cNumCallers; i++) {
+        EXPECT_TRUE(errors[i].IsNone()) << "Caller: " << i;
+        EXPECT_EQ(infos[i].mSize, content.size());
+        EXPECT_EQ(infos[i].mCheckSum, SumHash(content));
+    }
+
+    auto metrics = provider->GetMetrics();
+
+    EXPECT_EQ(hasher.GetMaxNumHashes(), cFileInfoMaxConcurrent);
+    EXPECT_EQ(metrics.mAcquires, cNumCallers);
+    EXPECT_EQ(metrics.mWaits, cNumCallers - cFileInfoMaxConcurrent);
+    EXPECT_EQ(metrics.mTimeouts, 0);
+    EXPECT_GT(metrics.mMaxWaitTime, Duration(0));
+    EXPECT_GE(metrics.mTotalWaitTime, metrics.mMaxWaitTime);
+}
+
+TEST_F(FSTest, FileInfoProviderAcquireTimeout)
+{
+    const auto file = cBaseTestDir / "file-info-timeout.txt";
+
+    CreateFile(file.c_str());
+
+    SumHasher hasher;
+    auto      provider = std::make_unique<fs::FileInfoProvider>();
+
+    ASSERT_TRUE(provider->Init(hasher, 50 * Time::cMilliseconds).IsNone());
+
+    hasher.Hold();
+
+    std::vector<Error>        errors(cFileInfoMaxConcurrent);
+    std::vector<fs::FileInfo> infos(cFileInfoMaxConcurrent);
+    std::vector<std::thread>  threads;
+
+    for (size_t i = 0; i < cFileInfoMaxConcurrent; i++) {
+        threads.emplace_back([&, i]() { errors[i] = provider->GetFileInfo(file.c_str(), infos[i]); });
+    }
+
+    EXPECT_TRUE(hasher.WaitNumHashes(cFileInfoMaxConcurrent));
+
+    fs::FileInfo info;
+
+    EXPECT_TRUE(provider->GetFileInfo(file.c_str(), info).Is(ErrorEnum::eTimeout));
+
+    hasher.Release();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& err : errors) {
+        EXPECT_TRUE(err.IsNone());
+    }
+
+    auto metrics = provider->GetMetrics();
+
+    EXPECT_EQ(metrics.mWaits, 1);
+    EXPECT_EQ(metrics.mTimeouts, 1);
+    EXPECT_GE(metrics.mMaxWaitTime, 50 * Time::cMilliseconds);
+
+    ASSERT_TRUE(provider->GetFileInfo(file.c_str(), info).IsNone());
+    EXPECT_EQ(info.mSize, strlen("test file"));
+}
+
+TEST_F(FSTest, FileReadSequential)
+{
+    const auto file = cBaseTestDir / "file-read-sequential.bin";
+
+    std::vector<uint8_t> content(3 * cFileDropCacheSize + 123);
+
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    ASSERT_TRUE(fs::WriteFile(file.c_str(), Array<uint8_t>(content.data(), content.size()), 0644).IsNone());
+
+    fs::File                   reader;
+    StaticArray<uint8_t, 4096> buffer;
+    std::vector<uint8_t>       result;
+
+    ASSERT_TRUE(reader.Open(file.c_str(), fs::File::Mode::ReadSequential).IsNone());
+
+    while (true) {
+        auto err = reader.ReadBlock(buffer);
+        ASSERT_TRUE(err.IsNone() || err.Is(ErrorEnum::eEOF));
+
+        if (buffer.IsEmpty()) {
+            break;
+        }
+
+        result.insert(result.end(), buffer.begin(), buffer.end());
+    }
+
+    EXPECT_TRUE(reader.Close().IsNone());
+    EXPECT_EQ(result, content);
+}
+
+TEST_F(FSTest, FileMapBlock)
+{
+    const auto file = cBaseTestDir / "file-map-block.bin";
+
+    std::vector<uint8_t> content(3 * 4096 + 123);
+
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    ASSERT_TRUE(fs::WriteFile(file.c_str(), Array<uint8_t>(content.data(), content.size()), 0644).IsNone());
+
+    fs::File                   reader;
+    Array<const uint8_t>       block;
+    StaticArray<uint8_t, 1000> buffer;
+    std::vector<uint8_t>       result;
+
+    ASSERT_TRUE(reader.Open(file.c_str(), fs::File::Mode::ReadSequential).IsNone());
+
+    // Block size is not page aligned to check unaligned mapping offsets.
+    ASSERT_TRUE(reader.MapBlock(5000, block).IsNone());
+    ASSERT_EQ(block.Size(), 5000);
+
+    result.insert(result.end(), block.begin(), block.end());
+
+    // Read and map calls share file position.
+    ASSERT_TRUE(reader.ReadBlock(buffer).IsNone());
+
+    result.insert(result.end(), buffer.begin(), buffer.end());
+
+    while (true) {
+        auto err = reader.MapBlock(5000, block);
+        ASSERT_TRUE(err.IsNone() || err.Is(ErrorEnum::eEOF));
+
+        if (block.IsEmpty()) {
+            break;
+        }
+
+        result.insert(result.end(), block.begin(), block.end());
+    }
+
+    EXPECT_TRUE(reader.Close().IsNone());
+    EXPECT_EQ(result, content);
+}
+
+TEST_F(FSTest, FileMapBlockEmpty)
+{
+    const auto file = cBaseTestDir / "file-map-block-empty.bin";
+
+    CreateFile(file.c_str(), "");
+
+    fs::File             reader;
+    Array<const uint8_t> block;
+
+    EXPECT_TRUE(reader.MapBlock(4096, block).Is(ErrorEnum::eWrongState));
+
+    ASSERT_TRUE(reader.Open(file.c_str(), fs::File::Mode::Read).IsNone());
+
+    EXPECT_TRUE(reader.MapBlock(4096, block).Is(ErrorEnum::eEOF));
+    EXPECT_TRUE(block.IsEmpty());
+}
+
 TEST_F(FSTest, BaseName)
 {
     auto check = [](const char* input, const char* expected) {
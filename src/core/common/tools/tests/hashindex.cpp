@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <core/common/tools/array.hpp>
+#include <core/common/tools/hashindex.hpp>
+
+using namespace aos;
+
+TEST(HashIndexTest, FindItems)
+{
+    constexpr size_t cNumItems = 64;
+
+    StaticArray<StaticString<16>, cNumItems> items;
+    HashIndex<cNumItems>                     index;
+
+    for (size_t i = 0; i < cNumItems; i++) {
+        StaticString<16> item;
+
+        ASSERT_TRUE(item.Format("item%zu", i).IsNone());
+        ASSERT_TRUE(items.PushBack(item).IsNone());
+        ASSERT_TRUE(index.Add(FNVHash(item), i).IsNone());
+    }
+
+    EXPECT_EQ(index.Size(), cNumItems);
+    EXPECT_TRUE(index.Add(FNVHash(String("extra")), 0).Is(ErrorEnum::eNoMemory));
+
+    for (size_t i = 0; i < cNumItems; i++) {
+        auto [position, err]
+            = index.Find(FNVHash(items[i]), [&items, i](size_t position) { return items[position] == items[i]; });
+
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(position, i);
+    }
+
+    StaticString<16> missing("missing");
+
+    auto [position, err]
+        = index.Find(FNVHash(missing), [&items, &missing](size_t position) { return items[position] == missing; });
+    (void)position;
+
+    EXPECT_TRUE(err.Is(ErrorEnum::eNotFound));
+
+    index.Clear();
+
+    EXPECT_EQ(index.Size(), 0);
+    EXPECT_TRUE(index.Find(FNVHash(items[0]), [](size_t) { return true; }).mError.Is(ErrorEnum::eNotFound));
+}
+
+TEST(HashIndexTest, ResolveCollisions)
+{
+    HashIndex<4> index;
+
+    // All items have the same hash, match functor selects the right one.
+    for (size_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(index.Add(42, i).IsNone());
+    }
+
+    for (size_t i = 0; i < 4; i++) {
+        auto [position, err] = index.Find(42, [i](size_t position) { return position == i; });
+
+        ASSERT_TRUE(err.IsNone());
+        EXPECT_EQ(position, i);
+    }
+
+    EXPECT_TRUE(index.Find(42, [](size_t) { return false; }).mError.Is(ErrorEnum::eNotFound));
+}
+
+TEST(HashIndexTest, FNVHash)
+{
+    EXPECT_EQ(FNVHash(String("")), cFNVOffsetBasis);
+    EXPECT_EQ(FNVHash(String("a")), 0xaf63dc4c8601ec8cULL);
+    EXPECT_EQ(FNVHash(String("b"), FNVHash(String("a"))), FNVHash(String("ab")));
+}
@@ -119,3 +119,27 @@ TEST(ListTest, Basic)
         }
     }
 }
+
+TEST(ListTest, Pop)
+{
+    StaticList<int, 4> list;
+
+    EXPECT_TRUE(list.PopBack().Is(ErrorEnum::eNotFound));
+    EXPECT_TRUE(list.PopFront().Is(ErrorEnum::eNotFound));
+
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(list.PushBack(i).IsNone());
+    }
+
+    EXPECT_TRUE(list.PopFront().IsNone());
+    EXPECT_TRUE(list.PopBack().IsNone());
+
+    ASSERT_EQ(list.Size(), 2);
+    EXPECT_EQ(*list.begin(), 1);
+    EXPECT_EQ(*(++list.begin()), 2);
+
+    // Freed nodes are reused.
+    EXPECT_TRUE(list.PushBack(4).IsNone());
+    EXPECT_TRUE(list.PushFront(5).IsNone());
+    EXPECT_TRUE(list.IsFull());
+}
@@ -161,3 +161,65 @@ TEST(LogTest, Basic)
     EXPECT_TRUE(testLog.CheckLog(
         "tools_test", LogLevelEnum::eError, "Download failed: path=/hello/world, err=failed (file.cpp:123)"));
 }
+
+TEST(LogTest, RuntimeLevels)
+{
+    Log::SetCallback(TestLog::LogCallback);
+
+    auto& testLog = TestLog::GetInstance();
+
+    class CountingStringer : public Stringer {
+    public:
+        const String ToString() const override
+        {
+            mCount++;
+
+            return "counting stringer";
+        }
+
+        mutable int mCount = 0;
+    };
+
+    CountingStringer stringer;
+
+    // Filtered log shouldn't be formatted
+
+    Log::SetLevel(LogLevelEnum::eInfo);
+
+    LOG_INF() << "Info log";
+    EXPECT_TRUE(testLog.CheckLog("tools_test", LogLevelEnum::eInfo, "Info log"));
+
+    LOG_DBG() << "Debug log" << stringer;
+    EXPECT_TRUE(testLog.CheckLog("tools_test", LogLevelEnum::eInfo, "Info log"));
+    EXPECT_EQ(stringer.mCount, 0);
+
+    // Module level overrides default level
+
+    ASSERT_TRUE(Log::SetModuleLevel("tools_test", LogLevelEnum::eDebug).IsNone());
+
+    LOG_DBG() << "Debug log" << stringer;
+    EXPECT_TRUE(testLog.CheckLog("tools_test", LogLevelEnum::eDebug, "Debug logcounting stringer"));
+    EXPECT_EQ(stringer.mCount, 1);
+
+    EXPECT_TRUE(Log::IsEnabled("tools_test", LogLevelEnum::eDebug));
+    EXPECT_FALSE(Log::IsEnabled("other", LogLevelEnum::eDebug));
+    EXPECT_TRUE(Log::IsEnabled("other", LogLevelEnum::eInfo));
+
+    ASSERT_TRUE(Log::SetModuleLevel("tools_test", LogLevelEnum::eError).IsNone());
+
+    LOG_WRN() << "Warning log";
+    EXPECT_TRUE(testLog.CheckLog("tools_test", LogLevelEnum::eDebug, "Debug logcounting stringer"));
+
+    LOG_ERR() << "Error log";
+    EXPECT_TRUE(testLog.CheckLog("tools_test", LogLevelEnum::eError, "Error log"));
+
+    EXPECT_TRUE(Log::IsEnabled("other", LogLevelEnum::eWarning));
+
+    // Reset levels
+
+    Log::ResetLevels();
+
+    LOG_DBG() << "Debug log";
+    EXPECT_TRUE(testLog.CheckLog("tools_test", LogLevelEnum::eDebug, "Debug log"));
+    EXPECT_TRUE(Log::IsEnabled("other", LogLevelEnum::eDebug));
+}
@@ -286,3 +286,71 @@ TEST(ThreadTest, SemaphoreTest)
 
     EXPECT_EQ(maxRunning, 2) << "At most 2 threads should run simultaneously";
 }
+
+TEST(ThreadTest, SharedMutexTest)
+{
+    SharedMutex mutex;
+    Mutex       maxMutex;
+
+    std::atomic<int> currentReaders {0};
+    std::atomic<int> currentWriters {0};
+    int              maxReaders = 0;
+    bool             overlapped = false;
+
+    auto reader = [&]() {
+        SharedLock lock {mutex};
+
+        int cur = ++currentReaders;
+
+        {
+            LockGuard maxLock {maxMutex};
+
+            maxReaders = std::max(maxReaders, cur);
+            overlapped = overlapped || currentWriters != 0;
+        }
+
+        usleep(100000);
+
+        --currentReaders;
+    };
+
+    auto writer = [&]() {
+        LockGuard lock {mutex};
+
+        ++currentWriters;
+
+        {
+            LockGuard maxLock {maxMutex};
+
+            overlapped = overlapped || currentReaders != 0 || currentWriters != 1;
+        }
+
+        usleep(100000);
+
+        --currentWriters;
+    };
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 3; i++) {
+        threads.emplace_back(reader);
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    threads.clear();
+
+    for (int i = 0; i < 2; i++) {
+        threads.emplace_back(writer);
+        threads.emplace_back(reader);
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(maxReaders, 3) << "Readers should run simultaneously";
+    EXPECT_FALSE(overlapped) << "Writer should run exclusively";
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <core/common/tools/utils.hpp>
+#include <core/common/tools/visitor.hpp>
+
+using namespace aos;
+
+namespace {
+
+struct OddFilter {
+    bool Match(int item) const { return item % 2 != 0; }
+};
+
+} // namespace
+
+TEST(VisitorTest, MakeVisitor)
+{
+    int sum = 0;
+
+    auto visitor = MakeVisitor<int>([&sum](int item) {
+        sum += item;
+
+        return item == 3 ? Error(ErrorEnum::eFailed) : Error(ErrorEnum::eNone);
+    });
+
+    VisitorItf<int>& visitorItf = visitor;
+
+    EXPECT_TRUE(visitorItf.Visit(1).IsNone());
+    EXPECT_TRUE(visitorItf.Visit(3).Is(ErrorEnum::eFailed));
+    EXPECT_EQ(sum, 4);
+}
+
+TEST(VisitorTest, VisitLoadedItems)
+{
+    int loadedItems[] = {1, 2, 3, 4, 5};
+
+    auto loader = [&loadedItems](Array<int>& items) {
+        return items.Assign(Array<int>(loadedItems, ArraySize(loadedItems)));
+    };
+
+    StaticArray<int, 8> visited;
+
+    auto visitor = MakeVisitor<int>([&visited](int item) { return visited.PushBack(item); });
+
+    ASSERT_TRUE((VisitLoadedItems<int, 8>(loader, OddFilter {}, visitor)).IsNone());
+
+    ASSERT_EQ(visited.Size(), 3);
+    EXPECT_EQ(visited[0], 1);
+    EXPECT_EQ(visited[1], 3);
+    EXPECT_EQ(visited[2], 5);
+
+    // Visiting stops on the first visitor error.
+    visited.Clear();
+
+    auto failVisitor = MakeVisitor<int>([&visited](int item) {
+        visited.PushBack(item);
+
+        return Error(ErrorEnum::eFailed);
+    });
+
+    EXPECT_TRUE((VisitLoadedItems<int, 8>(loader, OddFilter {}, failVisitor)).Is(ErrorEnum::eFailed));
+    EXPECT_EQ(visited.Size(), 1);
+
+    // Loader error is returned.
+    auto failLoader = [](Array<int>&) { return Error(ErrorEnum::eNotFound); };
+
+    EXPECT_TRUE((VisitLoadedItems<int, 8>(failLoader, OddFilter {}, visitor)).Is(ErrorEnum::eNotFound));
+}
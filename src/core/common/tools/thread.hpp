@@ -256,6 +256,55 @@ private:
     sem_t mSem;
 };
 
+/**
+ * Aos shared mutex.
+ *
+ * Allows multiple readers or single writer.
+ */
+class SharedMutex : private NonCopyable {
+public:
+    /**
+     * Constructs Aos shared mutex.
+     */
+    SharedMutex() { pthread_rwlock_init(&mRWLock, nullptr); }
+
+    /**
+     * Destroys Aos shared mutex.
+     */
+    ~SharedMutex() { pthread_rwlock_destroy(&mRWLock); }
+
+    /**
+     * Locks shared mutex exclusively.
+     *
+     * @return Error.
+     */
+    Error Lock() { return pthread_rwlock_wrlock(&mRWLock); }
+
+    /**
+     * Unlocks exclusively locked shared mutex.
+     *
+     * @return Error.
+     */
+    Error Unlock() { return pthread_rwlock_unlock(&mRWLock); }
+
+    /**
+     * Locks shared mutex for shared access.
+     *
+     * @return Error.
+     */
+    Error LockShared() { return pthread_rwlock_rdlock(&mRWLock); }
+
+    /**
+     * Unlocks shared mutex locked for shared access.
+     *
+     * @return Error.
+     */
+    Error UnlockShared() { return pthread_rwlock_unlock(&mRWLock); }
+
+private:
+    pthread_rwlock_t mRWLock;
+};
+
 /**
  * Aos lock guard.
  *
@@ -292,6 +341,42 @@ private:
     Error   mError;
 };
 
+/**
+ * Aos shared lock guard.
+ *
+ * @tparam Locker shared synchronization primitive.
+ */
+template <typename Locker = SharedMutex>
+class SharedLock : private NonCopyable {
+public:
+    /**
+     * Creates shared lock instance.
+     *
+     * @param locker shared mutex used to guard.
+     */
+    explicit SharedLock(Locker& locker)
+        : mLocker(locker)
+    {
+        mError = mLocker.LockShared();
+    }
+
+    /**
+     * Destroys shared lock instance.
+     */
+    ~SharedLock() { mLocker.UnlockShared(); }
+
+    /**
+     * Returns current shared lock error.
+     *
+     * @return Error.
+     */
+    Error GetError() { return mError; }
+
+private:
+    Locker& mLocker;
+    Error   mError;
+};
+
 /**
  * Aos unique lock.
  * @tparam Locker synchronization primitive(mutex, semaphore).
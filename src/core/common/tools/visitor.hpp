@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 EPAM Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef AOS_CORE_COMMON_TOOLS_VISITOR_HPP_
+#define AOS_CORE_COMMON_TOOLS_VISITOR_HPP_
+
+#include "allocator.hpp"
+#include "array.hpp"
+#include "error.hpp"
+#include "memory.hpp"
+#include "thread.hpp"
+
+namespace aos {
+
+/**
+ * Visitor interface.
+ */
+template <typename T>
+class VisitorItf {
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~VisitorItf() = default;
+
+    /**
+     * Visits item.
+     *
+     * @param item item to visit.
+     * @return Error. Any error stops visiting.
+     */
+    virtual Error Visit(const T& item) = 0;
+};
+
+/**
+ * Visitor which calls functor.
+ */
+template <typename T, typename F>
+class FunctorVisitor : public VisitorItf<T> {
+public:
+    /**
+     * Constructor.
+     *
+     * @param functor functor called for each visited item.
+     */
+    explicit FunctorVisitor(F functor)
+        : mFunctor(functor)
+    {
+    }
+
+    /**
+     * Visits item.
+     *
+     * @param item item to visit.
+     * @return Error.
+     */
+    Error Visit(const T& item) override { return mFunctor(item); }
+
+private:
+    F mFunctor;
+};
+
+/**
+ * Creates visitor which calls functor.
+ *
+ * @param functor functor called for each visited item.
+ * @return FunctorVisitor<T, F>.
+ */
+template <typename T, typename F>
+FunctorVisitor<T, F> MakeVisitor(F functor)
+{
+    return FunctorVisitor<T, F>(functor);
+}
+
+/**
+ * Visits items matching filter from an array loaded at once.
+ *
+ * It is a fallback for sources which can only load all items into an array. The array is allocated from a static
+ * buffer shared by all callers with the same item type and size, so such calls are serialized.
+ *
+ * @param loader functor which loads all items into array.
+ * @param filter filter with Match(const T&) method.
+ * @param visitor visitor.
+ * @return Error.
+ */
+template <typename T, size_t cMaxSize, typename Loader, typename Filter>
+Error VisitLoadedItems(Loader loader, const Filter& filter, VisitorItf<T>& visitor)
+{
+    static Mutex                                             sMutex;
+    static StaticAllocator<sizeof(StaticArray<T, cMaxSize>)> sAllocator;
+
+    LockGuard lock {sMutex};
+
+    auto items = MakeUnique<StaticArray<T, cMaxSize>>(&sAllocator);
+
+    if (auto err = loader(*items); !err.IsNone()) {
+        return err;
+    }
+
+    for (const auto& item : *items) {
+        if (!filter.Match(item)) {
+            continue;
+        }
+
+        if (auto err = visitor.Visit(item); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+} // namespace aos
+
+#endif
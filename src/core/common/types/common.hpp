@@ -11,6 +11,7 @@
 #include <core/common/consts.hpp>
 #include <core/common/crypto/itf/x509.hpp>
 #include <core/common/tools/enum.hpp>
+#include <core/common/tools/hashindex.hpp>
 #include <core/common/tools/log.hpp>
 #include <core/common/tools/optional.hpp>
 #include <core/common/tools/string.hpp>
@@ -553,6 +554,20 @@ struct InstanceIdent {
      */
     bool operator!=(const InstanceIdent& rhs) const { return !operator==(rhs); }
 
+    /**
+     * Returns instance ident hash to be used with hashed index.
+     *
+     * @return uint64_t.
+     */
+    uint64_t Hash() const
+    {
+        auto hash = FNVHash(mItemID);
+
+        hash = FNVHash(mSubjectID, hash);
+
+        return FNVHash(&mInstance, sizeof(mInstance), hash);
+    }
+
     /**
      * Outputs instance ident to log.
      *
@@ -18,6 +18,16 @@ namespace aos {
  */
 constexpr auto cStateLen = AOS_CONFIG_TYPES_STATE_LEN;
 
+/**
+ * State chunk size.
+ */
+constexpr size_t cStateChunkSize = AOS_CONFIG_TYPES_STATE_CHUNK_SIZE;
+
+/**
+ * Max number of state chunks.
+ */
+constexpr auto cMaxNumStateChunks = (cStateLen + cStateChunkSize - 1) / cStateChunkSize;
+
 /**
  * State reason length.
  */
@@ -103,6 +113,89 @@ struct UpdateState : public Protocol, public InstanceIdent {
     bool operator!=(const UpdateState& rhs) const { return !operator==(rhs); }
 };
 
+/**
+ * State delta.
+ *
+ * Contains state chunks changed against the base state. Chunk with index i covers state bytes
+ * [i * cStateChunkSize, (i + 1) * cStateChunkSize) truncated to the new state size. Data of changed chunks is stored
+ * in mData in the order of mChunks.
+ */
+struct StateDelta {
+    StaticArray<uint8_t, crypto::cSHA256Size> mBaseChecksum;
+    StaticArray<uint8_t, crypto::cSHA256Size> mChecksum;
+    size_t                                    mSize {};
+    StaticArray<size_t, cMaxNumStateChunks>   mChunks;
+    StaticString<cStateLen>                   mData;
+
+    /**
+     * Compares state delta.
+     *
+     * @param rhs state delta to compare with.
+     * @return bool.
+     */
+    bool operator==(const StateDelta& rhs) const
+    {
+        return mBaseChecksum == rhs.mBaseChecksum && mChecksum == rhs.mChecksum && mSize == rhs.mSize
+            && mChunks == rhs.mChunks && mData == rhs.mData;
+    }
+
+    /**
+     * Compares state delta.
+     *
+     * @param rhs state delta to compare with.
+     * @return bool.
+     */
+    bool operator!=(const StateDelta& rhs) const { return !operator==(rhs); }
+};
+
+/**
+ * New state delta.
+ */
+struct NewStateDelta : public Protocol, public InstanceIdent, public StateDelta {
+    /**
+     * Compares new state delta.
+     *
+     * @param rhs new state delta to compare with.
+     * @return bool.
+     */
+    bool operator==(const NewStateDelta& rhs) const
+    {
+        return Protocol::operator==(rhs) && InstanceIdent::operator==(rhs) && StateDelta::operator==(rhs);
+    }
+
+    /**
+     * Compares new state delta.
+     *
+     * @param rhs new state delta to compare with.
+     * @return bool.
+     */
+    bool operator!=(const NewStateDelta& rhs) const { return !operator==(rhs); }
+};
+
+/**
+ * Update state delta.
+ */
+struct UpdateStateDelta : public Protocol, public InstanceIdent, public StateDelta {
+    /**
+     * Compares update state delta.
+     *
+     * @param rhs update state delta to compare with.
+     * @return bool.
+     */
+    bool operator==(const UpdateStateDelta& rhs) const
+    {
+        return Protocol::operator==(rhs) && InstanceIdent::operator==(rhs) && StateDelta::operator==(rhs);
+    }
+
+    /**
+     * Compares update state delta.
+     *
+     * @param rhs update state delta to compare with.
+     * @return bool.
+     */
+    bool operator!=(const UpdateStateDelta& rhs) const { return !operator==(rhs); }
+};
+
 /**
  * State acceptance.
  */
@@ -65,18 +65,21 @@ Error PermHandler::UnregisterInstance(const InstanceIdent& instanceIdent)
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
+    // Removing shifts instances, so slots are reindexed.
+    RebuildSecretIndex();
+
     return ErrorEnum::eNone;
 }
 
 Error PermHandler::GetPermissions(const String& secret, const String& funcServerID, InstanceIdent& instanceIdent,
     Array<FunctionPermissions>& servicePermissions)
 {
-    LockGuard lock {mMutex};
+    SharedLock lock {mMutex};
 
     LOG_DBG() << "Get permission: secret=" << secret << ", funcServerID=" << funcServerID;
 
     const auto instance = FindBySecret(secret);
-    if (instance == mInstancesPerms.end()) {
+    if (instance == nullptr) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
@@ -109,12 +112,35 @@ Error PermHandler::AddSecret(const String& secret, const InstanceIdent& instance
         return AOS_ERROR_WRAP(err);
     }
 
+    IndexSecret(mInstancesPerms.Size() - 1);
+
     return ErrorEnum::eNone;
 }
 
-InstancePermissions* PermHandler::FindBySecret(const String& secret)
+void PermHandler::IndexSecret(size_t slot)
 {
-    return mInstancesPerms.FindIf([&secret](const auto& item) { return secret == item.mSecret; });
+    // Index has one position per instance slot, so adding can't fail.
+    mSecretIndex.Add(FNVHash(mInstancesPerms[slot].mSecret), slot);
+}
+
+void PermHandler::RebuildSecretIndex()
+{
+    mSecretIndex.Clear();
+
+    for (size_t slot = 0; slot < mInstancesPerms.Size(); slot++) {
+        IndexSecret(slot);
+    }
+}
+
+const InstancePermissions* PermHandler::FindBySecret(const String& secret) const
+{
+    auto [slot, err] = mSecretIndex.Find(
+        FNVHash(secret), [this, &secret](size_t i) { return mInstancesPerms[i].mSecret == secret; });
+    if (!err.IsNone()) {
+        return nullptr;
+    }
+
+    return &mInstancesPerms[slot];
 }
 
 InstancePermissions* PermHandler::FindByInstanceIdent(const InstanceIdent& instanceIdent)
@@ -137,7 +163,7 @@ RetWithError<StaticString<cSecretLen>> PermHandler::GenerateSecret()
 
         secret.Assign(uuid::UUIDToString(uuid));
 
-    } while (FindBySecret(secret) != mInstancesPerms.end());
+    } while (FindBySecret(secret) != nullptr);
 
     return {secret};
 }
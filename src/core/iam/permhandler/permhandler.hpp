@@ -9,6 +9,7 @@
 #define AOS_CORE_IAM_PERMHANDLER_PERMHANDLER_HPP_
 
 #include <core/common/crypto/itf/uuid.hpp>
+#include <core/common/tools/hashindex.hpp>
 #include <core/common/tools/thread.hpp>
 #include <core/common/tools/utils.hpp>
 
@@ -24,6 +25,9 @@ namespace aos::iam::permhandler {
 
 /**
  * Permission handler implements PermHandlerItf.
+ *
+ * Instances are indexed by secret in open addressing hash table. Permission requests are served under shared lock, so
+ * concurrent requests don't block each other.
  */
 class PermHandler : public PermHandlerItf {
 public:
@@ -68,13 +72,16 @@ public:
 private:
     Error                                  AddSecret(const String& secret, const InstanceIdent& instanceIdent,
                                          const Array<FunctionServicePermissions>& instancePermissions);
-    InstancePermissions*                   FindBySecret(const String& secret);
+    void                                   IndexSecret(size_t slot);
+    void                                   RebuildSecretIndex();
+    const InstancePermissions*             FindBySecret(const String& secret) const;
     InstancePermissions*                   FindByInstanceIdent(const InstanceIdent& instanceIdent);
     RetWithError<StaticString<cSecretLen>> GenerateSecret();
     RetWithError<StaticString<cSecretLen>> GetSecretForInstance(const InstanceIdent& instanceIdent);
 
-    Mutex                                              mMutex;
+    SharedMutex                                        mMutex;
     StaticArray<InstancePermissions, cMaxNumInstances> mInstancesPerms;
+    HashIndex<cMaxNumInstances>                        mSecretIndex;
     crypto::UUIDItf*                                   mUUIDProvider = {};
 };
 
@@ -6,6 +6,7 @@
  */
 
 #include <iostream>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -212,4 +213,51 @@ TEST_F(PermHandlerTest, TestInstancePermissions)
     ASSERT_TRUE(err.Is(ErrorEnum::eNotFound)) << err.Message();
 }
 
+TEST_F(PermHandlerTest, GetPermissionsAfterUnregister)
+{
+    FunctionServicePermissions servicePermissions;
+    servicePermissions.mName = "vis";
+    servicePermissions.mPermissions.PushBack({"*", "rw"});
+
+    StaticArray<FunctionServicePermissions, 1> funcServerPermissions;
+    funcServerPermissions.PushBack(servicePermissions);
+
+    InstanceIdent                         instanceIdent {"serviceID", "subjectID", 0, UpdateItemTypeEnum::eService};
+    std::vector<StaticString<cSecretLen>> secrets;
+    Error                                 err;
+    StaticString<cSecretLen>              secret;
+
+    for (size_t i = 0; i < cMaxNumInstances; ++i) {
+        instanceIdent.mInstance = i;
+
+        Tie(secret, err) = mPermHandler.RegisterInstance(instanceIdent, funcServerPermissions);
+        ASSERT_TRUE(err.IsNone()) << err.Message();
+
+        secrets.push_back(secret);
+    }
+
+    // Remove every second instance to shift remaining ones.
+    for (size_t i = 0; i < cMaxNumInstances; i += 2) {
+        instanceIdent.mInstance = i;
+
+        ASSERT_TRUE(mPermHandler.UnregisterInstance(instanceIdent).IsNone());
+    }
+
+    for (size_t i = 0; i < cMaxNumInstances; ++i) {
+        InstanceIdent                       resInstanceIdent;
+        StaticArray<FunctionPermissions, 1> permsResult;
+
+        err = mPermHandler.GetPermissions(secrets[i], "vis", resInstanceIdent, permsResult);
+
+        if (i % 2 == 0) {
+            EXPECT_TRUE(err.Is(ErrorEnum::eNotFound)) << err.Message();
+            continue;
+        }
+
+        ASSERT_TRUE(err.IsNone()) << err.Message();
+        EXPECT_EQ(resInstanceIdent.mInstance, i);
+        EXPECT_EQ(permsResult, servicePermissions.mPermissions);
+    }
+}
+
 } // namespace aos::iam::permhandler
@@ -46,6 +46,24 @@ public:
      * @return Error.
      */
     virtual Error RemoveInstanceInfo(const InstanceIdent& ident) = 0;
+
+    /**
+     * Begins storage transaction.
+     *
+     * Instance infos updated or removed until CommitTransaction are persisted with a single commit: after a crash,
+     * either all or none of the changes are present in the storage. Transactions are not nested.
+     * The default implementation doesn't support transactions: changes are persisted as they are made.
+     *
+     * @return Error.
+     */
+    virtual Error BeginTransaction() { return ErrorEnum::eNone; }
+
+    /**
+     * Commits storage transaction.
+     *
+     * @return Error.
+     */
+    virtual Error CommitTransaction() { return ErrorEnum::eNone; }
 };
 
 /** @}*/
@@ -577,6 +577,12 @@ void Launcher::UpdateInstancesImpl(Array<InstanceIdent>& stopInstances, const Ar
         return;
     }
 
+    // Collect network rules of all stopped and started instances into a single backend transaction.
+    auto networkBatchErr = mNetworkManager->BeginBatch();
+    if (!networkBatchErr.IsNone()) {
+        LOG_ERR() << "Failed to begin network batch" << Log::Field(AOS_ERROR_WRAP(networkBatchErr));
+    }
+
     if (auto err = AppendInstancesWithModifiedParams(startInstances, stopInstances); !err.IsNone()) {
         LOG_ERR() << "Failed to append instances with modified params to stop list" << Log::Field(AOS_ERROR_WRAP(err));
     }
@@ -605,12 +611,21 @@ void Launcher::UpdateInstancesImpl(Array<InstanceIdent>& stopInstances, const Ar
     }
 
     PrepareInstances(startInstances);
+    StoreInstancesInfos(stopInstances, startInstances);
     StartInstances(startInstances);
 
     if (auto err = mLaunchPool.Wait(); !err.IsNone()) {
         LOG_ERR() << "Thread pool wait failed" << Log::Field(AOS_ERROR_WRAP(err));
     }
 
+    // Runtimes start instance networks while starting instances, so the batch is kept open until all instances are
+    // started to apply their firewall, bandwidth and DNS changes at once.
+    if (networkBatchErr.IsNone()) {
+        if (auto err = mNetworkManager->CommitBatch(); !err.IsNone()) {
+            LOG_ERR() << "Failed to commit network batch" << Log::Field(AOS_ERROR_WRAP(err));
+        }
+    }
+
     if (auto err = mLaunchPool.Shutdown(); !err.IsNone()) {
         LOG_ERR() << "Thread pool shutdown failed" << Log::Field(AOS_ERROR_WRAP(err));
     }
@@ -1034,11 +1049,6 @@ RetWithError<Launcher::InstanceData*> Launcher::AddInstanceData(const InstanceIn
     LOG_DBG() << "Add instance data" << Log::Field("instance", instanceInfo)
               << Log::Field("runtimeID", instanceInfo.mRuntimeID);
 
-    if (auto err = mStorage->UpdateInstanceInfo(instanceInfo); !err.IsNone()) {
-        LOG_ERR() << "Failed to update instance info in storage" << Log::Field("instance", instanceInfo)
-                  << Log::Field(AOS_ERROR_WRAP(err));
-    }
-
     Duration offlineTTL = 0;
     Error    err;
 
@@ -1078,11 +1088,6 @@ Error Launcher::RemoveInstanceData(const InstanceIdent& instanceIdent)
 {
     LOG_DBG() << "Remove instance data" << Log::Field("instance", instanceIdent);
 
-    if (auto err = mStorage->RemoveInstanceInfo(instanceIdent); !err.IsNone()) {
-        LOG_ERR() << "Remove instance info from storage failed" << Log::Field("instance", instanceIdent)
-                  << Log::Field(AOS_ERROR_WRAP(err));
-    }
-
     if (auto count = mInstances.RemoveIf([this, &instanceIdent](const auto& instanceData) {
             return static_cast<const InstanceIdent&>(instanceData.mInfo) == instanceIdent;
         });
@@ -1117,6 +1122,47 @@ void Launcher::RemoveInstancesData(const Array<InstanceIdent>& instances)
     }
 }
 
+void Launcher::StoreInstancesInfos(const Array<InstanceIdent>& stopInstances, const Array<InstanceInfo>& startInstances)
+{
+    LockGuard lock {mMutex};
+
+    // Only launcher own instance infos are written within the transaction: storage is shared with other modules,
+    // which persist their changes independently.
+    auto transactionErr = mStorage->BeginTransaction();
+    if (!transactionErr.IsNone()) {
+        LOG_ERR() << "Failed to begin storage transaction" << Log::Field(AOS_ERROR_WRAP(transactionErr));
+    }
+
+    for (const auto& instanceIdent : stopInstances) {
+        // Instance is either not removed or started again with new info.
+        if (FindInstanceData(instanceIdent)) {
+            continue;
+        }
+
+        if (auto err = mStorage->RemoveInstanceInfo(instanceIdent); !err.IsNone() && !err.Is(ErrorEnum::eNotFound)) {
+            LOG_ERR() << "Remove instance info from storage failed" << Log::Field("instance", instanceIdent)
+                      << Log::Field(AOS_ERROR_WRAP(err));
+        }
+    }
+
+    for (const auto& instance : startInstances) {
+        if (!FindInstanceData(instance)) {
+            continue;
+        }
+
+        if (auto err = mStorage->UpdateInstanceInfo(instance); !err.IsNone()) {
+            LOG_ERR() << "Failed to update instance info in storage" << Log::Field("instance", instance)
+                      << Log::Field(AOS_ERROR_WRAP(err));
+        }
+    }
+
+    if (transactionErr.IsNone()) {
+        if (auto err = mStorage->CommitTransaction(); !err.IsNone()) {
+            LOG_ERR() << "Failed to commit storage transaction" << Log::Field(AOS_ERROR_WRAP(err));
+        }
+    }
+}
+
 void Launcher::SetInstanceState(InstanceData& instance, const InstanceState& state, const Error& error)
 {
     LockGuard lock {mMutex};
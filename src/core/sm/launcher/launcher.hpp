@@ -203,6 +203,8 @@ private:
     RetWithError<InstanceData*> AddInstanceData(const InstanceInfo& instanceInfo);
     Error                       RemoveInstanceData(const InstanceIdent& instanceIdent);
     void                        RemoveInstancesData(const Array<InstanceIdent>& instances);
+    void                        StoreInstancesInfos(
+                               const Array<InstanceIdent>& stopInstances, const Array<InstanceInfo>& startInstances);
     void  SetInstanceState(InstanceData& instance, const InstanceState& state, const Error& error = ErrorEnum::eNone);
     Error GetInstanceConfigs(const InstanceInfo& instance, oci::ItemConfig& itemConfig, oci::ImageConfig& imageConfig);
     Error GetInstanceNetworkConfig(const InstanceInfo& instance, const oci::ItemConfig& itemConfig,
@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <atomic>
 #include <future>
 #include <list>
+#include <mutex>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -190,6 +192,8 @@ protected:
         EXPECT_CALL(mInstanceIDProvider, GetInstanceID).WillRepeatedly(Return(ErrorEnum::eNone));
         EXPECT_CALL(mNetworkManager, CreateInstanceNetwork).WillRepeatedly(Return(ErrorEnum::eNone));
         EXPECT_CALL(mNetworkManager, ReleaseInstanceNetwork).WillRepeatedly(Return(ErrorEnum::eNone));
+        EXPECT_CALL(mNetworkManager, BeginBatch).WillRepeatedly(Return(ErrorEnum::eNone));
+        EXPECT_CALL(mNetworkManager, CommitBatch).WillRepeatedly(Return(ErrorEnum::eNone));
     }
 
     StaticArray<RuntimeItf*, cMaxNumNodeRuntimes> GetRuntimesArray()
@@ -585,6 +589,184 @@ TEST_F(LauncherTest, UpdateInstances)
     ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
 }
 
+TEST_F(LauncherTest, UpdateInstancesIsPersistedAtomically)
+{
+    const std::vector cStoredInfos = {
+        CreateInstanceInfo("item0", 0, "1.0.0", "runtime0"),
+    };
+    const std::vector cStartInstanceInfos = {
+        CreateInstanceInfo("item1", 1, "1.0.0", "runtime0"),
+        CreateInstanceInfo("item2", 2, "1.0.0", "runtime1"),
+    };
+    const Array<InstanceInfo>  cStartInstances(&cStartInstanceInfos.front(), cStartInstanceInfos.size());
+    const Array<InstanceIdent> cStopInstances(&static_cast<const InstanceIdent&>(cStoredInfos.front()), 1);
+
+    mStorage.Init(cStoredInfos);
+
+    auto err = mLauncher.Init(GetRuntimesArray(), mImageManager, mSender, mStorage, mOCISpec, mItemInfoProvider,
+        mCloudConnection, mNetworkManager, mInstanceIDProvider, mResourceInfoProvider);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    EXPECT_CALL(mRuntime0, StartInstance).WillOnce(Invoke([](const InstanceInfo& instance, InstanceStatus& status) {
+        SetInstanceStatus(instance, InstanceStateEnum::eActive, status);
+
+        return ErrorEnum::eNone;
+    }));
+
+    EXPECT_CALL(mImageManager, GetAllInstalledItems).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mLauncher.Start();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    // Wait for instances started on module start.
+    err = mLauncher.GetInstancesStatuses(mReceivedStatuses);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    EXPECT_CALL(mRuntime0, StopInstance).WillOnce(Invoke([](const InstanceIdent& instance, InstanceStatus& status) {
+        SetInstanceStatus(instance, InstanceStateEnum::eInactive, status);
+
+        return ErrorEnum::eNone;
+    }));
+
+    EXPECT_CALL(mRuntime0, StartInstance).WillOnce(Invoke([](const InstanceInfo& instance, InstanceStatus& status) {
+        SetInstanceStatus(instance, InstanceStateEnum::eActive, status);
+
+        return ErrorEnum::eNone;
+    }));
+
+    EXPECT_CALL(mRuntime1, StartInstance).WillOnce(Invoke([](const InstanceInfo& instance, InstanceStatus& status) {
+        SetInstanceStatus(instance, InstanceStateEnum::eActive, status);
+
+        return ErrorEnum::eNone;
+    }));
+
+    // Storage is shared with image manager and network manager: their changes are not a part of launcher transaction.
+    auto checkNoTransaction = [this]() {
+        EXPECT_FALSE(mStorage.IsInTransaction());
+
+        return ErrorEnum::eNone;
+    };
+
+    EXPECT_CALL(mImageManager, RemoveUpdateItem).WillOnce(InvokeWithoutArgs(checkNoTransaction));
+    EXPECT_CALL(mImageManager, InstallUpdateItem).WillRepeatedly(InvokeWithoutArgs(checkNoTransaction));
+    EXPECT_CALL(mNetworkManager, CreateInstanceNetwork).WillRepeatedly(InvokeWithoutArgs(checkNoTransaction));
+
+    // Crash on commit loses both removal of the stopped instance and addition of the started ones.
+    mStorage.SetCrashOnCommit(true);
+
+    err = mLauncher.UpdateInstances(cStopInstances, cStartInstances);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mSender.WaitStatuses(mReceivedStatuses, cWaitTimeout);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    auto storedData = std::make_unique<InstanceInfoArray>();
+
+    err = mStorage.GetAllInstancesInfos(*storedData);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    EXPECT_EQ(*storedData, Array<InstanceInfo>(&cStoredInfos.front(), cStoredInfos.size()));
+
+    EXPECT_CALL(mRuntime0, StopInstance).WillOnce(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mRuntime1, StopInstance).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mLauncher.Stop();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+}
+
+TEST_F(LauncherTest, UpdateInstancesAppliesNetworkChangesOnce)
+{
+    const std::vector cStartInstanceInfos = {
+        CreateInstanceInfo("item0", 0, "1.0.0", "runtime0"),
+        CreateInstanceInfo("item0", 1, "1.0.0", "runtime0"),
+        CreateInstanceInfo("item1", 0, "1.0.0", "runtime1"),
+        CreateInstanceInfo("item1", 1, "1.0.0", "runtime1"),
+    };
+    const Array<InstanceInfo> cStartInstances(&cStartInstanceInfos.front(), cStartInstanceInfos.size());
+
+    // Network manager applies firewall and bandwidth changes immediately outside of a batch and on the outermost
+    // commit inside of it.
+    std::mutex mutex;
+    size_t     batchDepth {};
+    bool       pendingChanges {};
+    size_t     numApplies {};
+
+    EXPECT_CALL(mNetworkManager, BeginBatch).WillRepeatedly(Invoke([&]() {
+        std::lock_guard lock {mutex};
+
+        batchDepth++;
+
+        return ErrorEnum::eNone;
+    }));
+    EXPECT_CALL(mNetworkManager, CommitBatch).WillRepeatedly(Invoke([&]() {
+        std::lock_guard lock {mutex};
+
+        if (--batchDepth == 0 && pendingChanges) {
+            pendingChanges = false;
+            numApplies++;
+        }
+
+        return ErrorEnum::eNone;
+    }));
+    EXPECT_CALL(mNetworkManager, StartInstanceNetwork).WillRepeatedly(Invoke([&](auto&&...) {
+        std::lock_guard lock {mutex};
+
+        if (batchDepth == 0) {
+            numApplies++;
+        } else {
+            pendingChanges = true;
+        }
+
+        return ErrorEnum::eNone;
+    }));
+
+    auto err = mLauncher.Init(GetRuntimesArray(), mImageManager, mSender, mStorage, mOCISpec, mItemInfoProvider,
+        mCloudConnection, mNetworkManager, mInstanceIDProvider, mResourceInfoProvider);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    EXPECT_CALL(mImageManager, GetAllInstalledItems).WillOnce(Return(ErrorEnum::eNone));
+
+    err = mLauncher.Start();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mLauncher.GetInstancesStatuses(mReceivedStatuses);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    // Runtimes start instance network while starting instance.
+    auto startInstance = [this](const InstanceInfo& instance, InstanceStatus& status) {
+        if (auto err = mNetworkManager.StartInstanceNetwork("", "", {}); !err.IsNone()) {
+            return err;
+        }
+
+        SetInstanceStatus(instance, InstanceStateEnum::eActive, status);
+
+        return Error(ErrorEnum::eNone);
+    };
+
+    EXPECT_CALL(mRuntime0, StartInstance).Times(2).WillRepeatedly(Invoke(startInstance));
+    EXPECT_CALL(mRuntime1, StartInstance).Times(2).WillRepeatedly(Invoke(startInstance));
+    EXPECT_CALL(mImageManager, InstallUpdateItem).WillRepeatedly(Return(ErrorEnum::eNone));
+
+    err = mLauncher.UpdateInstances(Array<InstanceIdent>(), cStartInstances);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    err = mSender.WaitStatuses(mReceivedStatuses, cWaitTimeout);
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+
+    {
+        std::lock_guard lock {mutex};
+
+        EXPECT_EQ(batchDepth, 0);
+        EXPECT_EQ(numApplies, 1);
+    }
+
+    EXPECT_CALL(mRuntime0, StopInstance).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
+    EXPECT_CALL(mRuntime1, StopInstance).Times(2).WillRepeatedly(Return(ErrorEnum::eNone));
+
+    err = mLauncher.Stop();
+    ASSERT_TRUE(err.IsNone()) << tests::utils::ErrorToStr(err);
+}
+
 TEST_F(LauncherTest, UpdateInstancesRestartsInstancesWithModifiedParams)
 {
     const std::vector cStoredInfos = {
@@ -7,6 +7,7 @@
 #ifndef AOS_CORE_SM_LAUNCHER_TESTS_STUBS_STORAGESTUB_HPP_
 #define AOS_CORE_SM_LAUNCHER_TESTS_STUBS_STORAGESTUB_HPP_
 
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -63,9 +64,58 @@ public:
             : ErrorEnum::eNotFound;
     }
 
+    Error BeginTransaction() override
+    {
+        std::lock_guard lock {mMutex};
+
+        if (mCommittedData) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "transaction already started"));
+        }
+
+        mCommittedData = std::make_unique<InstanceInfoArray>(mData);
+
+        return ErrorEnum::eNone;
+    }
+
+    Error CommitTransaction() override
+    {
+        std::lock_guard lock {mMutex};
+
+        if (!mCommittedData) {
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "transaction not started"));
+        }
+
+        auto committedData = std::move(mCommittedData);
+
+        // Simulates crash during commit: all changes of the transaction are lost.
+        if (mCrashOnCommit) {
+            mData = *committedData;
+
+            return AOS_ERROR_WRAP(Error(ErrorEnum::eFailed, "crash on commit"));
+        }
+
+        return ErrorEnum::eNone;
+    }
+
+    void SetCrashOnCommit(bool crashOnCommit)
+    {
+        std::lock_guard lock {mMutex};
+
+        mCrashOnCommit = crashOnCommit;
+    }
+
+    bool IsInTransaction()
+    {
+        std::lock_guard lock {mMutex};
+
+        return mCommittedData != nullptr;
+    }
+
 private:
-    std::mutex        mMutex;
-    InstanceInfoArray mData;
+    std::mutex                         mMutex;
+    InstanceInfoArray                  mData;
+    std::unique_ptr<InstanceInfoArray> mCommittedData;
+    bool                               mCrashOnCommit {};
 };
 
 } // namespace aos::sm::launcher
@@ -60,6 +60,22 @@ public:
      * @return Error.
      */
     virtual Error Clear(const String& ifName) = 0;
+
+    /**
+     * Begins batch of shaping changes.
+     *
+     * Until CommitBatch, the backend may collect Apply/Clear changes and submit them at once.
+     *
+     * @return Error.
+     */
+    virtual Error BeginBatch() { return ErrorEnum::eNone; }
+
+    /**
+     * Applies shaping changes collected since BeginBatch.
+     *
+     * @return Error.
+     */
+    virtual Error CommitBatch() { return ErrorEnum::eNone; }
 };
 
 /** @}*/
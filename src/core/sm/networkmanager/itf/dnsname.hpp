@@ -112,6 +112,22 @@ public:
      * @return Error.
      */
     virtual Error RemoveServer(const String& networkID) = 0;
+
+    /**
+     * Begins batch of host changes.
+     *
+     * Until CommitBatch, DNS servers may collect AddHost/RemoveHost changes and reload dnsmasq once per network.
+     *
+     * @return Error.
+     */
+    virtual Error BeginBatch() { return ErrorEnum::eNone; }
+
+    /**
+     * Applies host changes collected since BeginBatch.
+     *
+     * @return Error.
+     */
+    virtual Error CommitBatch() { return ErrorEnum::eNone; }
 };
 
 /** @}*/
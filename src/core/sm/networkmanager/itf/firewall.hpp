@@ -130,6 +130,23 @@ public:
      * @return Error.
      */
     virtual Error RemoveMasquerade(const String& subnet, const String& outIf) = 0;
+
+    /**
+     * Begins batch of instance rule changes.
+     *
+     * Until CommitBatch, the backend may collect AddInstance/RemoveInstance/UpdateInstance changes instead of
+     * applying each of them, so a whole launcher update is submitted as a single nft transaction.
+     *
+     * @return Error.
+     */
+    virtual Error BeginBatch() { return ErrorEnum::eNone; }
+
+    /**
+     * Applies instance rule changes collected since BeginBatch.
+     *
+     * @return Error.
+     */
+    virtual Error CommitBatch() { return ErrorEnum::eNone; }
 };
 
 /** @}*/
@@ -108,6 +108,24 @@ public:
      * @return Error.
      */
     virtual Error ReleaseInstanceNetwork(const String& instanceID, const String& networkID) = 0;
+
+    /**
+     * Begins network update batch.
+     *
+     * Firewall, bandwidth and DNS changes of instances started or stopped until CommitBatch are collected by the
+     * backends and applied as a single transaction. Batches may be nested, only the outermost CommitBatch applies
+     * the changes.
+     *
+     * @return Error.
+     */
+    virtual Error BeginBatch() { return ErrorEnum::eNone; }
+
+    /**
+     * Commits network update batch.
+     *
+     * @return Error.
+     */
+    virtual Error CommitBatch() { return ErrorEnum::eNone; }
 };
 
 /** @}*/
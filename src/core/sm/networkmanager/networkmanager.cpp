@@ -49,6 +49,10 @@ Error NetworkManager::Init(StorageItf& storage, BridgeNetworkItf& bridgeNet, Fir
         mInstanceNetworkInfos.Set(instanceNetworkInfo.mInstanceID, instanceNetworkInfo);
     }
 
+    if (auto err = IndexInstanceNetworkInfos(); !err.IsNone()) {
+        return err;
+    }
+
     auto networkInfos = MakeUnique<StaticArray<NetworkInfo, cMaxNumOwners>>(&mNetworkInfosAllocator);
 
     if (auto err = mStorage->GetNetworksInfo(*networkInfos); !err.IsNone()) {
@@ -189,7 +193,12 @@ Error NetworkManager::CreateInstanceNetwork(
     auto rollbackCache = DeferRelease(&instanceID, [this, &err](const String* id) {
         if (!err.IsNone()) {
             LockGuard lock {mMutex};
+
             mInstanceNetworkInfos.Remove(*id);
+
+            if (auto errIndex = IndexInstanceNetworkInfos(); !errIndex.IsNone()) {
+                LOG_ERR() << "Failed to index instance network infos" << Log::Field(errIndex);
+            }
         }
     });
 
@@ -231,7 +240,15 @@ Error NetworkManager::CreateInstanceNetwork(
     {
         LockGuard lock {mMutex};
 
-        mInstanceNetworkInfos.Set(instanceID, *info);
+        if (err = mInstanceNetworkInfos.Set(instanceID, *info); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+
+        // Instance network info is set in place of the emplaced one, so only its position is added to the index.
+        if (err = IndexInstanceNetworkInfo(mInstanceNetworkInfos.Find(instanceID) - mInstanceNetworkInfos.begin());
+            !err.IsNone()) {
+            return err;
+        }
     }
 
     return ErrorEnum::eNone;
@@ -325,7 +342,7 @@ Error NetworkManager::StopInstanceNetwork(const String& instanceID, const String
         LockGuard lock {mMutex};
 
         auto network = mRuntimeCache.Find(networkID);
-        if (network != mRuntimeCache.end() && !network->mSecond.IsEmpty()) {
+        if (network != mRuntimeCache.end() && !network->mSecond.mInstances.IsEmpty()) {
             return err;
         }
 
@@ -357,7 +374,7 @@ Error NetworkManager::ReleaseInstanceNetwork(const String& instanceID, const Str
         LockGuard lock {mMutex};
 
         auto network = mRuntimeCache.Find(networkID);
-        if (network != mRuntimeCache.end() && network->mSecond.Find(instanceID) != network->mSecond.end()) {
+        if (network != mRuntimeCache.end() && network->mSecond.HasInstance(instanceID)) {
             return AOS_ERROR_WRAP(Error(ErrorEnum::eInvalidArgument, "instance is still running, call Stop first"));
         }
 
@@ -370,6 +387,10 @@ Error NetworkManager::ReleaseInstanceNetwork(const String& instanceID, const Str
             instanceIdent = itInfo->mSecond.mNetworkConfig.mInstanceIdent;
             found         = true;
             mInstanceNetworkInfos.Remove(instanceID);
+
+            if (auto err = IndexInstanceNetworkInfos(); !err.IsNone()) {
+                LOG_ERR() << "Failed to index instance network infos" << Log::Field(err);
+            }
         }
     }
 
@@ -395,7 +416,7 @@ Error NetworkManager::ReleaseInstanceNetwork(const String& instanceID, const Str
         }
 
         auto runtimeNetwork = mRuntimeCache.Find(networkID);
-        if (runtimeNetwork != mRuntimeCache.end() && !runtimeNetwork->mSecond.IsEmpty()) {
+        if (runtimeNetwork != mRuntimeCache.end() && !runtimeNetwork->mSecond.mInstances.IsEmpty()) {
             return ErrorEnum::eNone;
         }
 
@@ -414,6 +435,82 @@ Error NetworkManager::ReleaseInstanceNetwork(const String& instanceID, const Str
     return ErrorEnum::eNone;
 }
 
+Error NetworkManager::BeginBatch()
+{
+    LockGuard lock {mBatchMutex};
+
+    LOG_DBG() << "Begin batch" << Log::Field("depth", mBatchDepth);
+
+    if (mBatchDepth++ != 0) {
+        return ErrorEnum::eNone;
+    }
+
+    Error err;
+
+    if (err = mFirewall->BeginBatch(); !err.IsNone()) {
+        mBatchDepth = 0;
+
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (err = mBandwidth->BeginBatch(); !err.IsNone()) {
+        mBatchDepth = 0;
+
+        if (auto errCommit = mFirewall->CommitBatch(); !errCommit.IsNone()) {
+            LOG_ERR() << "Failed to commit firewall batch" << Log::Field(errCommit);
+        }
+
+        return AOS_ERROR_WRAP(err);
+    }
+
+    if (err = mDNSName->BeginBatch(); !err.IsNone()) {
+        mBatchDepth = 0;
+
+        if (auto errCommit = mFirewall->CommitBatch(); !errCommit.IsNone()) {
+            LOG_ERR() << "Failed to commit firewall batch" << Log::Field(errCommit);
+        }
+
+        if (auto errCommit = mBandwidth->CommitBatch(); !errCommit.IsNone()) {
+            LOG_ERR() << "Failed to commit bandwidth batch" << Log::Field(errCommit);
+        }
+
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error NetworkManager::CommitBatch()
+{
+    LockGuard lock {mBatchMutex};
+
+    LOG_DBG() << "Commit batch" << Log::Field("depth", mBatchDepth);
+
+    if (mBatchDepth == 0) {
+        return AOS_ERROR_WRAP(Error(ErrorEnum::eWrongState, "batch not started"));
+    }
+
+    if (--mBatchDepth != 0) {
+        return ErrorEnum::eNone;
+    }
+
+    Error err;
+
+    if (auto errCommit = mFirewall->CommitBatch(); !errCommit.IsNone() && err.IsNone()) {
+        err = AOS_ERROR_WRAP(errCommit);
+    }
+
+    if (auto errCommit = mBandwidth->CommitBatch(); !errCommit.IsNone() && err.IsNone()) {
+        err = AOS_ERROR_WRAP(errCommit);
+    }
+
+    if (auto errCommit = mDNSName->CommitBatch(); !errCommit.IsNone() && err.IsNone()) {
+        err = AOS_ERROR_WRAP(errCommit);
+    }
+
+    return err;
+}
+
 Error NetworkManager::PrepareUpdateItemNetworkParams(
     const InstanceNetworkConfig& params, const String& networkID, UpdateItemNetworkParams& serviceData) const
 {
@@ -856,9 +953,9 @@ Error NetworkManager::IsInstanceInNetwork(const String& instanceID, const String
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
-    LOG_DBG() << "Network data: " << network->mSecond.Size();
+    LOG_DBG() << "Network data: " << network->mSecond.mInstances.Size();
 
-    if (auto instance = network->mSecond.Find(instanceID); instance == network->mSecond.end()) {
+    if (!network->mSecond.HasInstance(instanceID)) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
@@ -878,14 +975,21 @@ Error NetworkManager::UpdateInstanceNetworkCache(
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
-    auto instance = network->mSecond.Find(instanceID);
-    if (instance == network->mSecond.end()) {
+    auto instance = network->mSecond.mInstances.Find(instanceID);
+    if (instance == network->mSecond.mInstances.end()) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
+    // Replaced hosts can't be removed from the index, so it is rebuilt in this case.
+    if (!instance->mSecond.IsEmpty()) {
+        instance->mSecond = hosts;
+
+        return IndexHosts(network->mSecond);
+    }
+
     instance->mSecond = hosts;
 
-    return ErrorEnum::eNone;
+    return IndexInstanceHosts(network->mSecond, instance - network->mSecond.mInstances.begin());
 }
 
 Error NetworkManager::CleanupLeftoverInstances()
@@ -1009,11 +1113,11 @@ Error NetworkManager::AddInstanceToCache(const String& instanceID, const String&
         network = mRuntimeCache.Find(networkID);
     }
 
-    if (network->mSecond.Find(instanceID) != network->mSecond.end()) {
+    if (network->mSecond.HasInstance(instanceID)) {
         return AOS_ERROR_WRAP(ErrorEnum::eAlreadyExist);
     }
 
-    if (auto err = network->mSecond.Set(instanceID, InstanceHosts()); !err.IsNone()) {
+    if (auto err = network->mSecond.mInstances.Set(instanceID, InstanceHosts()); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
@@ -1032,17 +1136,19 @@ Error NetworkManager::RemoveInstanceFromCache(const String& instanceID, const St
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
-    if (auto err = network->mSecond.Remove(instanceID); !err.IsNone()) {
+    if (auto err = network->mSecond.mInstances.Remove(instanceID); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    if (network->mSecond.IsEmpty()) {
+    if (network->mSecond.mInstances.IsEmpty()) {
         if (auto err = mRuntimeCache.Remove(networkID); !err.IsNone()) {
             return AOS_ERROR_WRAP(err);
         }
+
+        return ErrorEnum::eNone;
     }
 
-    return ErrorEnum::eNone;
+    return IndexHosts(network->mSecond);
 }
 
 Error NetworkManager::ClearNetwork(const NetworkInfo& networkInfo)
@@ -1091,8 +1197,7 @@ Error NetworkManager::PrepareHosts(const String& instanceID, const String& netwo
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
-    auto instanceData = networkData->mSecond.Find(instanceID);
-    if (instanceData == networkData->mSecond.end()) {
+    if (!networkData->mSecond.HasInstance(instanceID)) {
         return AOS_ERROR_WRAP(ErrorEnum::eNotFound);
     }
 
@@ -1159,19 +1264,70 @@ Error NetworkManager::PushHostWithDomain(
 }
 
 Error NetworkManager::IsHostnameExist(
-    const InstanceCache& instanceCache, const Array<StaticString<cHostNameLen>>& hosts) const
+    const RuntimeNetwork& network, const Array<StaticString<cHostNameLen>>& hosts) const
 {
     for (const auto& host : hosts) {
-        for (const auto& instance : instanceCache) {
-            if (instance.mSecond.Find(host) != instance.mSecond.end()) {
-                return ErrorEnum::eAlreadyExist;
-            }
+        auto [position, err] = network.mHosts.Find(FNVHash(host), [&network, &host](size_t position) {
+            return (network.mInstances.begin() + position / cMaxNumHosts)->mSecond[position % cMaxNumHosts] == host;
+        });
+        if (err.IsNone()) {
+            return ErrorEnum::eAlreadyExist;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error NetworkManager::IndexHosts(RuntimeNetwork& network)
+{
+    network.mHosts.Clear();
+
+    for (size_t i = 0; i < network.mInstances.Size(); i++) {
+        if (auto err = IndexInstanceHosts(network, i); !err.IsNone()) {
+            return err;
         }
     }
 
     return ErrorEnum::eNone;
 }
 
+Error NetworkManager::IndexInstanceHosts(RuntimeNetwork& network, size_t position)
+{
+    const auto& hosts = (network.mInstances.begin() + position)->mSecond;
+
+    for (size_t i = 0; i < hosts.Size(); i++) {
+        if (auto err = network.mHosts.Add(FNVHash(hosts[i]), position * cMaxNumHosts + i); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error NetworkManager::IndexInstanceNetworkInfos()
+{
+    mInstanceIdentIndex.Clear();
+
+    for (size_t i = 0; i < mInstanceNetworkInfos.Size(); i++) {
+        if (auto err = IndexInstanceNetworkInfo(i); !err.IsNone()) {
+            return err;
+        }
+    }
+
+    return ErrorEnum::eNone;
+}
+
+Error NetworkManager::IndexInstanceNetworkInfo(size_t position)
+{
+    const auto& info = (mInstanceNetworkInfos.begin() + position)->mSecond;
+
+    if (auto err = mInstanceIdentIndex.Add(info.mNetworkConfig.mInstanceIdent.Hash(), position); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    return ErrorEnum::eNone;
+}
+
 Error NetworkManager::CreateResolvConfFile(const String& networkID, const String& resolvConfFilePath,
     const String& bridgeIP, const aos::InstanceNetworkAllocation& networkParams,
     const Array<StaticString<cIPLen>>& dns) const
@@ -1206,51 +1362,34 @@ Error NetworkManager::CreateResolvConfFile(const String& networkID, const String
         }
     }
 
-    return WriteResolvConfFile(resolvConfFilePath, mainServers, networkParams);
-}
+    auto content = MakeUnique<NetworkFileContent>(&mFileAllocator);
 
-Error NetworkManager::WriteResolvConfFile(const String& filePath, const Array<StaticString<cIPLen>>& mainServers,
-    const aos::InstanceNetworkAllocation& networkParams) const
-{
-    LOG_DBG() << "Write resolv.conf file" << Log::Field("filePath", filePath);
-
-    auto fd = open(filePath.CStr(), O_CREAT | O_WRONLY, 0644);
-    if (fd < 0) {
-        return Error(errno);
+    if (auto err = AppendNameServers(mainServers, *content); !err.IsNone()) {
+        return err;
     }
 
-    auto closeFile = DeferRelease(&fd, [](const int* fd) { close(*fd); });
-
-    auto writeNameServers = [&fd](const Array<StaticString<cIPLen>>& servers) -> Error {
-        for (const auto& server : servers) {
-            StaticString<cResolvConfLineLen> line;
-
-            if (auto err = line.Format("nameserver\t%s\n", server.CStr()); !err.IsNone()) {
-                return err;
-            }
-
-            const auto buff = Array<uint8_t>(reinterpret_cast<const uint8_t*>(line.Get()), line.Size());
+    if (auto err = AppendNameServers(networkParams.mDNSServers, *content); !err.IsNone()) {
+        return err;
+    }
 
-            size_t pos = 0;
+    return WriteFileIfChanged(resolvConfFilePath, *content);
+}
 
-            while (pos < buff.Size()) {
-                auto chunkSize = write(fd, buff.Get() + pos, buff.Size() - pos);
-                if (chunkSize < 0) {
-                    return Error(errno);
-                }
+Error NetworkManager::AppendNameServers(const Array<StaticString<cIPLen>>& servers, String& content) const
+{
+    for (const auto& server : servers) {
+        StaticString<cResolvConfLineLen> line;
 
-                pos += chunkSize;
-            }
+        if (auto err = line.Format("nameserver\t%s\n", server.CStr()); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
         }
 
-        return ErrorEnum::eNone;
-    };
-
-    if (auto err = writeNameServers(mainServers); !err.IsNone()) {
-        return err;
+        if (auto err = content.Insert(content.end(), line.begin(), line.end()); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
     }
 
-    return writeNameServers(networkParams.mDNSServers);
+    return ErrorEnum::eNone;
 }
 
 Error NetworkManager::CreateHostsFile(const String& networkID, const String& instanceIP,
@@ -1262,18 +1401,14 @@ Error NetworkManager::CreateHostsFile(const String& networkID, const String& ins
         return ErrorEnum::eNone;
     }
 
-    StaticArray<SharedPtr<Host>, cMaxNumHosts * 3> hosts;
+    auto content = MakeUnique<NetworkFileContent>(&mFileAllocator);
 
-    auto localhost = MakeShared<Host>(&mHostAllocator, String("127.0.0.1"), String("localhost"));
-
-    if (auto err = hosts.PushBack(localhost); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
+    if (auto err = AppendHost("127.0.0.1", "localhost", *content); !err.IsNone()) {
+        return err;
     }
 
-    auto localhost6 = MakeShared<Host>(&mHostAllocator, String("::1"), String("localhost ip6-localhost ip6-loopback"));
-
-    if (auto err = hosts.PushBack(localhost6); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
+    if (auto err = AppendHost("::1", "localhost ip6-localhost ip6-loopback", *content); !err.IsNone()) {
+        return err;
     }
 
     StaticString<cHostNameLen> ownHosts {networkID};
@@ -1282,78 +1417,52 @@ Error NetworkManager::CreateHostsFile(const String& networkID, const String& ins
         ownHosts.Append(" ").Append(network.mHostname);
     }
 
-    auto instanceHost = MakeShared<Host>(&mHostAllocator, instanceIP, ownHosts);
-
-    if (auto err = hosts.PushBack(instanceHost); !err.IsNone()) {
-        return AOS_ERROR_WRAP(err);
-    }
-
-    return WriteHostsFile(hostsFilePath, hosts, network.mHosts);
-}
-
-Error NetworkManager::WriteHostsFile(
-    const String& filePath, const Array<SharedPtr<Host>>& hosts, const Array<Host>& additionalHosts) const
-{
-    LOG_DBG() << "Write hosts file" << Log::Field("filePath", filePath);
-
-    auto fd = open(filePath.CStr(), O_CREAT | O_WRONLY, 0644);
-    if (fd < 0) {
-        return Error(errno);
+    if (auto err = AppendHost(instanceIP, ownHosts, *content); !err.IsNone()) {
+        return err;
     }
 
-    auto closeFile = DeferRelease(&fd, [](const int* fd) { close(*fd); });
-
-    if (auto err = WriteHosts(hosts, fd); !err.IsNone()) {
-        return err;
+    for (const auto& host : network.mHosts) {
+        if (auto err = AppendHost(host.mIP, host.mHostname, *content); !err.IsNone()) {
+            return err;
+        }
     }
 
-    return WriteHosts(additionalHosts, fd);
+    return WriteFileIfChanged(hostsFilePath, *content);
 }
 
-Error NetworkManager::WriteHost(const Host& host, int fd) const
+Error NetworkManager::AppendHost(const String& ip, const String& hostname, String& content) const
 {
-    StaticString<cHostNameLen> line;
+    StaticString<cHostsLineLen> line;
 
-    if (auto err = line.Format("%s\t%s\n", host.mIP.CStr(), host.mHostname.CStr()); !err.IsNone()) {
+    if (auto err = line.Format("%s\t%s\n", ip.CStr(), hostname.CStr()); !err.IsNone()) {
         return AOS_ERROR_WRAP(err);
     }
 
-    const auto buff = Array<uint8_t>(reinterpret_cast<const uint8_t*>(line.Get()), line.Size());
-
-    size_t pos = 0;
-    while (pos < buff.Size()) {
-        auto chunkSize = write(fd, buff.Get() + pos, buff.Size() - pos);
-        if (chunkSize < 0) {
-            return Error(errno);
-        }
-
-        pos += chunkSize;
+    if (auto err = content.Insert(content.end(), line.begin(), line.end()); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
     return ErrorEnum::eNone;
 }
 
-Error NetworkManager::WriteHosts(const Array<SharedPtr<Host>>& hosts, int fd) const
+Error NetworkManager::WriteFileIfChanged(const String& filePath, const String& content) const
 {
-    for (const auto& host : hosts) {
-        if (auto err = WriteHost(*host, fd); !err.IsNone()) {
-            return err;
-        }
+    auto current = MakeUnique<NetworkFileContent>(&mFileAllocator);
+
+    if (auto err = fs::ReadFileToString(filePath, *current); err.IsNone() && *current == content) {
+        LOG_DBG() << "File not changed" << Log::Field("filePath", filePath);
+
+        return ErrorEnum::eNone;
     }
 
-    return ErrorEnum::eNone;
-};
+    LOG_DBG() << "Write file" << Log::Field("filePath", filePath);
 
-Error NetworkManager::WriteHosts(const Array<Host>& hosts, int fd) const
-{
-    for (const auto& host : hosts) {
-        if (auto err = WriteHost(host, fd); !err.IsNone()) {
-            return err;
-        }
+    if (auto err = fs::WriteStringToFile(filePath, content, 0644); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
     }
 
     return ErrorEnum::eNone;
-};
+}
 
 Error NetworkManager::PrepareBridgeParams(
     const String& networkID, const aos::InstanceNetworkAllocation& networkParams, BridgeParams& params) const
@@ -1580,20 +1689,21 @@ void NetworkManager::OnPendingFirewallUpdate(
     {
         LockGuard lock {mMutex};
 
-        for (const auto& [id, info] : mInstanceNetworkInfos) {
-            if (info.mNetworkConfig.mInstanceIdent == update.mInstanceIdent) {
-                instanceID       = id;
-                networkID        = info.mNetworkID;
-                *networkConfig   = info.mNetworkConfig;
-                *allocatedParams = info.mAllocatedParams;
-                hostIfName       = info.mHostIfName;
-
-                auto network = mRuntimeCache.Find(networkID);
-                if (network != mRuntimeCache.end()) {
-                    isRunning = network->mSecond.Find(instanceID) != network->mSecond.end();
-                }
+        auto [position, err] = mInstanceIdentIndex.Find(update.mInstanceIdent.Hash(), [this, &update](size_t i) {
+            return (mInstanceNetworkInfos.begin() + i)->mSecond.mNetworkConfig.mInstanceIdent == update.mInstanceIdent;
+        });
+        if (err.IsNone()) {
+            const auto& [id, info] = *(mInstanceNetworkInfos.begin() + position);
+
+            instanceID       = id;
+            networkID        = info.mNetworkID;
+            *networkConfig   = info.mNetworkConfig;
+            *allocatedParams = info.mAllocatedParams;
+            hostIfName       = info.mHostIfName;
 
-                break;
+            auto network = mRuntimeCache.Find(networkID);
+            if (network != mRuntimeCache.end()) {
+                isRunning = network->mSecond.HasInstance(instanceID);
             }
         }
 
@@ -1641,7 +1751,7 @@ void NetworkManager::OnConnect()
         for (const auto& [id, info] : mInstanceNetworkInfos) {
             // Only sync running instances (present in runtime cache)
             auto network = mRuntimeCache.Find(info.mNetworkID);
-            if (network == mRuntimeCache.end() || network->mSecond.Find(id) == network->mSecond.end()) {
+            if (network == mRuntimeCache.end() || !network->mSecond.HasInstance(id)) {
                 continue;
             }
 
@@ -1655,11 +1765,100 @@ void NetworkManager::OnConnect()
         }
     }
 
-    if (auto err = mNetworkProvider->SyncNetworkState(mNodeID, *instances); !err.IsNone()) {
+    if (auto err = SyncNetworkState(*instances); !err.IsNone()) {
         LOG_ERR() << "Failed to sync network state with CM" << Log::Field(err);
     }
 }
 
+uint64_t NetworkManager::HashNetworkState(const InstanceNetworkStateInfo& instance)
+{
+    // Include terminating zero of strings and number of rules, so adjacent fields can't be shifted into each other.
+    auto hashField = [](const String& value, uint64_t hash) { return FNVHash(value.CStr(), value.Size() + 1, hash); };
+
+    auto hash     = hashField(instance.mNetworkID, instance.mInstanceIdent.Hash());
+    auto numRules = static_cast<uint64_t>(instance.mFirewallRules.Size());
+
+    hash = hashField(instance.mIP, hash);
+    hash = FNVHash(&numRules, sizeof(numRules), hash);
+
+    for (const auto& rule : instance.mFirewallRules) {
+        hash = hashField(rule.mDstIP, hash);
+        hash = hashField(rule.mDstPort, hash);
+        hash = hashField(rule.mProto, hash);
+        hash = hashField(rule.mSrcIP, hash);
+    }
+
+    return hash;
+}
+
+Error NetworkManager::SyncNetworkState(const Array<InstanceNetworkStateInfo>& instances)
+{
+    auto syncedInstances = MakeUnique<SyncedInstances>(&mAllocator);
+
+    for (const auto& instance : instances) {
+        if (auto err = syncedInstances->EmplaceBack(instance); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    if (mSyncedInstancesValid) {
+        auto err = SyncNetworkStateDelta(instances, *syncedInstances);
+        if (err.IsNone()) {
+            mSyncedInstances = *syncedInstances;
+
+            return ErrorEnum::eNone;
+        }
+
+        LOG_WRN() << "Can't sync network state delta, sync full state" << Log::Field(err);
+    }
+
+    mSyncedInstancesValid = false;
+
+    if (auto err = mNetworkProvider->SyncNetworkState(mNodeID, instances); !err.IsNone()) {
+        return AOS_ERROR_WRAP(err);
+    }
+
+    mSyncedInstances      = *syncedInstances;
+    mSyncedInstancesValid = true;
+
+    return ErrorEnum::eNone;
+}
+
+Error NetworkManager::SyncNetworkStateDelta(
+    const Array<InstanceNetworkStateInfo>& instances, const Array<SyncedInstance>& syncedInstances)
+{
+    auto updated = MakeUnique<StaticArray<InstanceNetworkStateInfo, cMaxNumInstances>>(&mAllocator);
+    auto removed = MakeUnique<StaticArray<InstanceIdent, cMaxNumInstances>>(&mAllocator);
+
+    for (size_t i = 0; i < instances.Size(); i++) {
+        if (mSyncedInstances.Find(syncedInstances[i]) != mSyncedInstances.end()) {
+            continue;
+        }
+
+        if (auto err = updated->PushBack(instances[i]); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    for (const auto& prevInstance : mSyncedInstances) {
+        auto it = syncedInstances.FindIf([&prevInstance](const SyncedInstance& instance) {
+            return instance.mState.mInstanceIdent == prevInstance.mState.mInstanceIdent;
+        });
+        if (it != syncedInstances.end()) {
+            continue;
+        }
+
+        if (auto err = removed->PushBack(prevInstance.mState.mInstanceIdent); !err.IsNone()) {
+            return AOS_ERROR_WRAP(err);
+        }
+    }
+
+    LOG_DBG() << "Sync network state delta" << Log::Field("updated", updated->Size())
+              << Log::Field("removed", removed->Size());
+
+    return mNetworkProvider->SyncNetworkStateDelta(mNodeID, *updated, *removed);
+}
+
 Error NetworkManager::UpdateInstanceFirewall(const String& instanceID, const String& networkID,
     const InstanceNetworkConfig& networkConfig, const aos::InstanceNetworkAllocation& networkParams)
 {
@@ -9,6 +9,7 @@
 
 #include <core/common/crypto/itf/rand.hpp>
 #include <core/common/tools/fs.hpp>
+#include <core/common/tools/hashindex.hpp>
 #include <core/common/tools/map.hpp>
 #include <core/common/tools/thread.hpp>
 
@@ -149,6 +150,20 @@ public:
      */
     Error ReleaseInstanceNetwork(const String& instanceID, const String& networkID) override;
 
+    /**
+     * Begins network update batch.
+     *
+     * @return Error.
+     */
+    Error BeginBatch() override;
+
+    /**
+     * Commits network update batch.
+     *
+     * @return Error.
+     */
+    Error CommitBatch() override;
+
     /**
      * Called when pending firewall rules are resolved for an instance.
      *
@@ -175,7 +190,16 @@ private:
 
     using InstanceHosts = StaticArray<StaticString<cHostNameLen>, cMaxNumHosts>;
     using InstanceCache = StaticMap<StaticString<cIDLen>, InstanceHosts, cMaxNumInstances>;
-    using NetworkCache  = StaticMap<StaticString<cIDLen>, InstanceCache, cMaxNumOwners>;
+    using HostIndex     = HashIndex<cMaxNumInstances * cMaxNumHosts>;
+
+    struct RuntimeNetwork {
+        InstanceCache mInstances;
+        HostIndex     mHosts;
+
+        bool HasInstance(const String& instanceID) const { return mInstances.Find(instanceID) != mInstances.end(); }
+    };
+
+    using NetworkCache = StaticMap<StaticString<cIDLen>, RuntimeNetwork, cMaxNumOwners>;
 
     static constexpr uint64_t cBurstLen              = 12800;
     static constexpr auto     cMaxExposedPort        = 2;
@@ -185,6 +209,29 @@ private:
     static constexpr auto     cVlanIfPrefix          = "vlan-";
     static constexpr auto     cNumAllocations        = 8 * cMaxNumConcurrentItems;
     static constexpr auto     cResolvConfLineLen     = AOS_CONFIG_NETWORKMANAGER_RESOLV_CONF_LINE_LEN;
+    static constexpr auto     cHostsLineLen          = cIPLen + cHostNameLen + 2;
+    static constexpr auto     cNetworkFileLen        = (cMaxNumHosts + 3) * cHostsLineLen;
+
+    using NetworkFileContent = StaticString<cNetworkFileLen>;
+
+    // Hash is used to skip full state comparison of changed instances, unchanged instances are detected by
+    // comparing the whole synced state, so hash collision can't hide a change.
+    struct SyncedInstance {
+        InstanceNetworkStateInfo mState;
+        uint64_t                 mHash {};
+
+        explicit SyncedInstance(const InstanceNetworkStateInfo& state)
+            : mState(state)
+            , mHash(HashNetworkState(state))
+        {
+        }
+
+        bool operator==(const SyncedInstance& rhs) const { return mHash == rhs.mHash && mState == rhs.mState; }
+    };
+
+    using SyncedInstances = StaticArray<SyncedInstance, cMaxNumInstances>;
+
+    static uint64_t HashNetworkState(const InstanceNetworkStateInfo& instance);
 
     Error IsInstanceInNetwork(const String& instanceID, const String& networkID) const;
     Error AddInstanceToCache(const String& instanceID, const String& networkID);
@@ -207,21 +254,23 @@ private:
         const String& networkID, UpdateItemNetworkParams& serviceData) const;
     Error PrepareHosts(const String& instanceID, const String& networkID, const InstanceNetworkConfig& network,
         Array<StaticString<cHostNameLen>>& hosts) const;
-    Error IsHostnameExist(const InstanceCache& instanceCache, const Array<StaticString<cHostNameLen>>& hosts) const;
+    Error IsHostnameExist(const RuntimeNetwork& network, const Array<StaticString<cHostNameLen>>& hosts) const;
+    Error IndexHosts(RuntimeNetwork& network);
+    Error IndexInstanceHosts(RuntimeNetwork& network, size_t position);
+    Error IndexInstanceNetworkInfos();
+    Error IndexInstanceNetworkInfo(size_t position);
     Error PushHostWithDomain(
         const String& host, const String& networkID, Array<StaticString<cHostNameLen>>& hosts) const;
     Error CreateHostsFile(const String& networkID, const String& instanceIP, const InstanceNetworkConfig& network,
         const String& hostsFilePath) const;
-    Error WriteHost(const Host& host, int fd) const;
-    Error WriteHosts(const Array<SharedPtr<Host>>& hosts, int fd) const;
-    Error WriteHosts(const Array<Host>& hosts, int fd) const;
-    Error WriteHostsFile(
-        const String& filePath, const Array<SharedPtr<Host>>& hosts, const Array<Host>& additionalHosts) const;
-
+    Error AppendHost(const String& ip, const String& hostname, String& content) const;
     Error CreateResolvConfFile(const String& networkID, const String& resolvConfFilePath, const String& bridgeIP,
         const aos::InstanceNetworkAllocation& networkParams, const Array<StaticString<cIPLen>>& dns) const;
-    Error WriteResolvConfFile(const String& filePath, const Array<StaticString<cIPLen>>& mainServers,
-        const aos::InstanceNetworkAllocation& networkParams) const;
+    Error AppendNameServers(const Array<StaticString<cIPLen>>& servers, String& content) const;
+    Error WriteFileIfChanged(const String& filePath, const String& content) const;
+    Error SyncNetworkState(const Array<InstanceNetworkStateInfo>& instances);
+    Error SyncNetworkStateDelta(
+        const Array<InstanceNetworkStateInfo>& instances, const Array<SyncedInstance>& syncedInstances);
 
     Error CreateNetwork(const NetworkInfo& network);
     Error DeleteInstanceNetworkConfig(const String& instanceID, const String& networkID);
@@ -259,20 +308,27 @@ private:
     StaticMap<StaticString<cIDLen>, NetworkInfo, cMaxNumOwners>                            mNetworkProviders;
     StaticMap<StaticString<cIDLen>, DNSServerItf*, cMaxNumOwners>                          mDNSServers;
     StaticMap<StaticString<cIDLen>, InstanceNetworkInfo, cMaxNumInstances * cMaxNumOwners> mInstanceNetworkInfos;
+    HashIndex<cMaxNumInstances * cMaxNumOwners>                                            mInstanceIdentIndex;
     StaticArray<StaticString<cIDLen>, cMaxNumOwners>                                       mPhysicalNetworks;
     StaticAllocator<sizeof(StaticArray<NetworkInfo, cMaxNumOwners>)>                       mNetworkInfosAllocator;
     StaticAllocator<sizeof(StaticArray<InstanceNetworkInfo, cMaxNumInstances>)> mInstanceNetworkInfosAllocator;
 
+    SyncedInstances                                                                        mSyncedInstances;
+    bool                                                                                   mSyncedInstancesValid {};
+
     mutable Mutex mMutex;
+    Mutex         mBatchMutex;
+    size_t        mBatchDepth {};
     StaticAllocator<(sizeof(InstanceFirewallParams) + sizeof(UpdateItemNetworkParams)
                         + sizeof(aos::InstanceNetworkAllocation) + sizeof(InstanceNetworkInfo)
                         + sizeof(InstanceNetworkStateInfo))
                 * cMaxNumConcurrentItems
             + sizeof(StaticArray<StaticString<cIDLen>, cMaxNumInstances>)
-            + sizeof(StaticArray<InstanceNetworkStateInfo, cMaxNumInstances>),
+            + 2 * sizeof(StaticArray<InstanceNetworkStateInfo, cMaxNumInstances>)
+            + sizeof(StaticArray<InstanceIdent, cMaxNumInstances>) + sizeof(SyncedInstances),
         cNumAllocations>
-                                                                                          mAllocator;
-    mutable StaticAllocator<(sizeof(Host) * 3) * cMaxNumConcurrentItems, cNumAllocations> mHostAllocator;
+                                                                                                      mAllocator;
+    mutable StaticAllocator<2 * sizeof(NetworkFileContent) * cMaxNumConcurrentItems, cNumAllocations> mFileAllocator;
 };
 
 /** @}*/
@@ -17,6 +17,8 @@ class BandwidthMock : public BandwidthItf {
 public:
     MOCK_METHOD(Error, Apply, (const String&, const BandwidthParams&), (override));
     MOCK_METHOD(Error, Clear, (const String&), (override));
+    MOCK_METHOD(Error, BeginBatch, (), (override));
+    MOCK_METHOD(Error, CommitBatch, (), (override));
 };
 
 } // namespace aos::sm::networkmanager
@@ -24,6 +24,8 @@ public:
     MOCK_METHOD(Error, RemoveOrphans, (const Array<StaticString<cIDLen>>&), (override));
     MOCK_METHOD((RetWithError<DNSServerItf*>), CreateServer, (const String&, const DNSServerParams&), (override));
     MOCK_METHOD(Error, RemoveServer, (const String&), (override));
+    MOCK_METHOD(Error, BeginBatch, (), (override));
+    MOCK_METHOD(Error, CommitBatch, (), (override));
 };
 
 } // namespace aos::sm::networkmanager
@@ -23,6 +23,9 @@ public:
     MOCK_METHOD(aos::Error, ReleaseNodeNetwork, (const aos::String&, const aos::String&), (override));
     MOCK_METHOD(aos::Error, SyncNetworkState, (const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>&),
         (override));
+    MOCK_METHOD(aos::Error, SyncNetworkStateDelta,
+        (const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>&, const aos::Array<aos::InstanceIdent>&),
+        (override));
 };
 
 #endif
@@ -487,10 +487,16 @@ TEST_F(NetworkManagerTest, CreateAndStartInstanceNetwork_VerifyResolvConfFile)
     InstanceNetworkRuntimeParams runtimeParams;
     runtimeParams.mResolvConfFilePath = aos::fs::JoinPath(mWorkingDir, "resolv.conf");
 
+    // Stale file content should be replaced completely.
+    std::ofstream(runtimeParams.mResolvConfFilePath.CStr()) << std::string(1024, '#');
+
     ASSERT_EQ(mNetManager->StartInstanceNetwork(instanceID, networkID, runtimeParams), aos::ErrorEnum::eNone);
 
     std::string resolvContent = ReadFile(runtimeParams.mResolvConfFilePath.CStr());
 
+    EXPECT_THAT(resolvContent, Not(HasSubstr("#")));
+    EXPECT_FALSE(std::filesystem::exists(std::string(runtimeParams.mResolvConfFilePath.CStr()) + ".tmp"));
+
     // Per-bridge dnsmasq listens on the bridge IP — must be the primary nameserver.
     EXPECT_THAT(resolvContent, HasSubstr("nameserver\t192.168.1.1"));
     EXPECT_THAT(resolvContent, HasSubstr("nameserver\t8.8.8.8"));
@@ -1238,6 +1244,86 @@ TEST_F(NetworkManagerTest, OnPendingFirewallUpdate_RunningInstance_CallsFirewall
     mNetManager->OnPendingFirewallUpdate("test-node", update);
 }
 
+TEST_F(NetworkManagerTest, OnConnect_SyncsNetworkStateDeltaOnShiftedFirewallRuleFields)
+{
+    auto params          = CreateTestInstanceNetworkConfig();
+    auto allocatedParams = CreateTestAllocatedParams();
+
+    SetupEnsureNodeNetworkCreateMocks("test-network", "192.168.1.0/24", "192.168.1.1", 100);
+
+    EXPECT_CALL(mNetworkProvider, AllocateInstanceNetwork(_, _, _, _, _))
+        .WillOnce(DoAll(SetArgReferee<4>(allocatedParams), Return(aos::ErrorEnum::eNone)));
+    EXPECT_CALL(mStorage, AddInstanceNetworkInfo(_)).WillOnce(Return(aos::ErrorEnum::eNone));
+
+    auto err = mNetManager->CreateInstanceNetwork("test-instance", "test-network", params);
+    ASSERT_EQ(err, aos::ErrorEnum::eNone);
+
+    SetupEnsureNodeNetworkPhysicalMocks("192.168.1.1", "192.168.1.0/24", 100);
+
+    EXPECT_CALL(mNetns, CreateNetworkNamespace(_)).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mNetns, GetNetworkNamespacePath(_))
+        .WillOnce(Return(aos::RetWithError<aos::StaticString<aos::cFilePathLen>> {{}, aos::ErrorEnum::eNone}));
+    ExpectAddInstanceCalls();
+    ExpectPersistInstanceCalls();
+    EXPECT_CALL(mTrafficMonitor, StartInstanceMonitoring(_, _, _, _)).WillOnce(Return(aos::ErrorEnum::eNone));
+
+    InstanceNetworkRuntimeParams runtimeParams;
+    runtimeParams.mHostsFilePath      = "/tmp/networkmanager_test/hosts";
+    runtimeParams.mResolvConfFilePath = "/tmp/networkmanager_test/resolv.conf";
+
+    err = mNetManager->StartInstanceNetwork("test-instance", "test-network", runtimeParams);
+    ASSERT_EQ(err, aos::ErrorEnum::eNone);
+
+    EXPECT_CALL(mStorage, UpdateInstanceNetworkInfo(_)).WillRepeatedly(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mFirewall, UpdateInstance(_, _)).WillRepeatedly(Return(aos::ErrorEnum::eNone));
+
+    aos::networkmanager::PendingFirewallUpdate update;
+    update.mInstanceIdent = params.mInstanceIdent;
+
+    aos::FirewallRule rule;
+    rule.mDstIP   = "10.0.0.1";
+    rule.mDstPort = "80";
+    rule.mProto   = "tcp";
+    rule.mSrcIP   = "192.168.1.2";
+    update.mFirewallRules.PushBack(rule);
+
+    mNetManager->OnPendingFirewallUpdate("test-node", update);
+
+    EXPECT_CALL(mNetworkProvider, SyncNetworkState(aos::String("test-node"), _))
+        .WillOnce(Return(aos::ErrorEnum::eNone));
+
+    mNetManager->OnConnect();
+
+    // Same concatenated content with shifted field boundary should be detected as change.
+    update.mFirewallRules[0].mDstIP   = "10.0.0.18";
+    update.mFirewallRules[0].mDstPort = "0";
+
+    mNetManager->OnPendingFirewallUpdate("test-node", update);
+
+    EXPECT_CALL(mNetworkProvider, SyncNetworkStateDelta(aos::String("test-node"), _, _))
+        .WillOnce(Invoke([&](const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>& updated,
+                             const aos::Array<aos::InstanceIdent>& removed) {
+            EXPECT_EQ(updated.Size(), 1);
+            EXPECT_TRUE(removed.IsEmpty());
+
+            if (!updated.IsEmpty()) {
+                EXPECT_EQ(updated[0].mFirewallRules, update.mFirewallRules);
+            }
+
+            return aos::ErrorEnum::eNone;
+        }))
+        .WillOnce(Invoke([](const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>& updated,
+                             const aos::Array<aos::InstanceIdent>& removed) {
+            EXPECT_TRUE(updated.IsEmpty());
+            EXPECT_TRUE(removed.IsEmpty());
+
+            return aos::ErrorEnum::eNone;
+        }));
+
+    mNetManager->OnConnect();
+    mNetManager->OnConnect();
+}
+
 TEST_F(NetworkManagerTest, OnConnect_SyncsNetworkStateWithCM)
 {
     const aos::String instanceID = "test-instance";
@@ -1363,3 +1449,129 @@ TEST_F(NetworkManagerTest, Start_AdoptsDNSForLeftoverInstancesAndCleansHosts)
 
     ASSERT_EQ(mNetManager->Start(), aos::ErrorEnum::eNone);
 }
+
+TEST_F(NetworkManagerTest, BatchAppliesInstanceRulesOnOutermostCommit)
+{
+    const aos::String instanceID = "test-instance";
+    const aos::String networkID  = "test-network";
+    auto              params     = CreateTestInstanceNetworkConfig();
+    auto              allocated  = CreateTestAllocatedParams();
+
+    SetupEnsureNodeNetworkCreateMocks(networkID, allocated.mSubnet, "192.168.1.1", 100ULL);
+
+    EXPECT_CALL(mNetworkProvider, AllocateInstanceNetwork(_, networkID, aos::String("test-node"), _, _))
+        .WillOnce(DoAll(SetArgReferee<4>(allocated), Return(aos::ErrorEnum::eNone)));
+    EXPECT_CALL(mStorage, AddInstanceNetworkInfo(_)).WillOnce(Return(aos::ErrorEnum::eNone));
+
+    ASSERT_EQ(mNetManager->CreateInstanceNetwork(instanceID, networkID, params), aos::ErrorEnum::eNone);
+
+    Sequence firewall, bandwidth, dns;
+
+    EXPECT_CALL(mFirewall, BeginBatch()).InSequence(firewall).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mBandwidth, BeginBatch()).InSequence(bandwidth).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mDNSName, BeginBatch()).InSequence(dns).WillOnce(Return(aos::ErrorEnum::eNone));
+
+    ASSERT_EQ(mNetManager->BeginBatch(), aos::ErrorEnum::eNone);
+    ASSERT_EQ(mNetManager->BeginBatch(), aos::ErrorEnum::eNone);
+
+    SetupEnsureNodeNetworkPhysicalMocks("192.168.1.1", allocated.mSubnet, 100ULL);
+
+    BridgeAttachResult attachResult;
+    attachResult.mHostIfName      = "veth-test";
+    attachResult.mContainerIfName = "eth0";
+
+    EXPECT_CALL(mBridgeNetwork, Attach(_, _, _))
+        .WillOnce(DoAll(SetArgReferee<2>(attachResult), Return(aos::ErrorEnum::eNone)));
+    EXPECT_CALL(mFirewall, AddInstance(_, _)).InSequence(firewall).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mBandwidth, Apply(_, _)).InSequence(bandwidth).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mDNSServer, AddHost(_, _)).InSequence(dns).WillOnce(Return(aos::ErrorEnum::eNone));
+    ExpectPersistInstanceCalls();
+    EXPECT_CALL(mTrafficMonitor, StartInstanceMonitoring(_, _, _, _)).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mNetns, CreateNetworkNamespace(_)).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mNetns, GetNetworkNamespacePath(_))
+        .WillOnce(Return(aos::RetWithError<aos::StaticString<aos::cFilePathLen>> {
+            {"/var/run/netns/test-instance"}, aos::ErrorEnum::eNone}));
+
+    InstanceNetworkRuntimeParams runtimeParams;
+    ASSERT_EQ(mNetManager->StartInstanceNetwork(instanceID, networkID, runtimeParams), aos::ErrorEnum::eNone);
+
+    // Nested commit doesn't apply changes.
+    ASSERT_EQ(mNetManager->CommitBatch(), aos::ErrorEnum::eNone);
+
+    EXPECT_CALL(mFirewall, CommitBatch()).InSequence(firewall).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mBandwidth, CommitBatch()).InSequence(bandwidth).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mDNSName, CommitBatch()).InSequence(dns).WillOnce(Return(aos::ErrorEnum::eNone));
+
+    ASSERT_EQ(mNetManager->CommitBatch(), aos::ErrorEnum::eNone);
+    EXPECT_TRUE(mNetManager->CommitBatch().Is(aos::ErrorEnum::eWrongState));
+}
+
+TEST_F(NetworkManagerTest, OnConnect_SyncsNetworkStateDeltaOnReconnect)
+{
+    const aos::String instanceID = "test-instance";
+    const aos::String networkID  = "test-network";
+    auto              params     = CreateTestInstanceNetworkConfig();
+    auto              allocated  = CreateTestAllocatedParams();
+
+    SetupEnsureNodeNetworkCreateMocks(networkID, allocated.mSubnet, "192.168.1.1", 100ULL);
+
+    EXPECT_CALL(mNetworkProvider, AllocateInstanceNetwork(_, networkID, aos::String("test-node"), _, _))
+        .WillOnce(DoAll(SetArgReferee<4>(allocated), Return(aos::ErrorEnum::eNone)));
+    EXPECT_CALL(mStorage, AddInstanceNetworkInfo(_)).WillOnce(Return(aos::ErrorEnum::eNone));
+
+    ASSERT_EQ(mNetManager->CreateInstanceNetwork(instanceID, networkID, params), aos::ErrorEnum::eNone);
+
+    // First sync sends full state.
+    EXPECT_CALL(mNetworkProvider, SyncNetworkState(aos::String("test-node"), _))
+        .WillOnce(Invoke([](const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>& instances) {
+            EXPECT_TRUE(instances.IsEmpty());
+
+            return aos::ErrorEnum::eNone;
+        }));
+
+    mNetManager->OnConnect();
+
+    SetupEnsureNodeNetworkPhysicalMocks("192.168.1.1", allocated.mSubnet, 100ULL);
+
+    ExpectAddInstanceCalls();
+    ExpectPersistInstanceCalls();
+    EXPECT_CALL(mTrafficMonitor, StartInstanceMonitoring(_, _, _, _)).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mNetns, CreateNetworkNamespace(_)).WillOnce(Return(aos::ErrorEnum::eNone));
+    EXPECT_CALL(mNetns, GetNetworkNamespacePath(_))
+        .WillOnce(Return(aos::RetWithError<aos::StaticString<aos::cFilePathLen>> {
+            {"/var/run/netns/test-instance"}, aos::ErrorEnum::eNone}));
+
+    InstanceNetworkRuntimeParams runtimeParams;
+    ASSERT_EQ(mNetManager->StartInstanceNetwork(instanceID, networkID, runtimeParams), aos::ErrorEnum::eNone);
+
+    // Reconnect sends only started instance.
+    EXPECT_CALL(mNetworkProvider, SyncNetworkStateDelta(aos::String("test-node"), _, _))
+        .WillOnce(Invoke([&](const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>& updated,
+                             const aos::Array<aos::InstanceIdent>& removed) {
+            EXPECT_EQ(updated.Size(), 1);
+            EXPECT_EQ(updated[0].mInstanceIdent, params.mInstanceIdent);
+            EXPECT_TRUE(removed.IsEmpty());
+
+            return aos::ErrorEnum::eNone;
+        }));
+
+    mNetManager->OnConnect();
+
+    // CM lost previous state: delta is rejected and full state is sent.
+    EXPECT_CALL(mNetworkProvider, SyncNetworkStateDelta(aos::String("test-node"), _, _))
+        .WillOnce(Invoke([](const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>& updated,
+                             const aos::Array<aos::InstanceIdent>& removed) {
+            EXPECT_TRUE(updated.IsEmpty());
+            EXPECT_TRUE(removed.IsEmpty());
+
+            return aos::ErrorEnum::eNotFound;
+        }));
+    EXPECT_CALL(mNetworkProvider, SyncNetworkState(aos::String("test-node"), _))
+        .WillOnce(Invoke([](const aos::String&, const aos::Array<aos::InstanceNetworkStateInfo>& instances) {
+            EXPECT_EQ(instances.Size(), 1);
+
+            return aos::ErrorEnum::eNone;
+        }));
+
+    mNetManager->OnConnect();
+}
@@ -27,6 +27,8 @@ public:
         (override));
     MOCK_METHOD(Error, StopInstanceNetwork, (const String& instanceID, const String& networkID), (override));
     MOCK_METHOD(Error, ReleaseInstanceNetwork, (const String& instanceID, const String& networkID), (override));
+    MOCK_METHOD(Error, BeginBatch, (), (override));
+    MOCK_METHOD(Error, CommitBatch, (), (override));
     MOCK_METHOD(void, OnPendingFirewallUpdate,
         (const String& nodeID, const aos::networkmanager::PendingFirewallUpdate& update), (override));
     MOCK_METHOD(void, OnConnect, (), (override));